@@ -0,0 +1,666 @@
+/*
+#
+# CDDL HEADER START
+#
+# The contents of this file are subject to the terms of the
+# Common Development and Distribution License (the "License").
+# You may not use this file except in compliance with the License.
+#
+# You can obtain a copy of the license at usr/src/OPENSOLARIS.LICENSE
+# or http://www.opensolaris.org/os/licensing.
+# See the License for the specific language governing permissions
+# and limitations under the License.
+#
+# When distributing Covered Code, include this CDDL HEADER in each
+# file and include the License file at usr/src/OPENSOLARIS.LICENSE.
+# If applicable, add the following below this CDDL HEADER, with the
+# fields enclosed by brackets "[]" replaced with your own identifying
+# information: Portions Copyright [yyyy] [name of copyright owner]
+#
+# CDDL HEADER END
+#
+
+COMMON DEVELOPMENT AND DISTRIBUTION LICENSE Version 1.0
+
+1. Definitions.
+
+    1.1. "Contributor" means each individual or entity that creates
+         or contributes to the creation of Modifications.
+
+    1.2. "Contributor Version" means the combination of the Original
+         Software, prior Modifications used by a Contributor (if any),
+         and the Modifications made by that particular Contributor.
+
+    1.3. "Covered Software" means (a) the Original Software, or (b)
+         Modifications, or (c) the combination of files containing
+         Original Software with files containing Modifications, in
+         each case including portions thereof.
+
+    1.4. "Executable" means the Covered Software in any form other
+         than Source Code.
+
+    1.5. "Initial Developer" means the individual or entity that first
+         makes Original Software available under this License.
+
+    1.6. "Larger Work" means a work which combines Covered Software or
+         portions thereof with code not governed by the terms of this
+         License.
+
+    1.7. "License" means this document.
+
+    1.8. "Licensable" means having the right to grant, to the maximum
+         extent possible, whether at the time of the initial grant or
+         subsequently acquired, any and all of the rights conveyed
+         herein.
+
+    1.9. "Modifications" means the Source Code and Executable form of
+         any of the following:
+
+        A. Any file that results from an addition to, deletion from or
+           modification of the contents of a file containing Original
+           Software or previous Modifications;
+
+        B. Any new file that contains any part of the Original
+           Software or previous Modifications; or
+
+        C. Any new file that is contributed or otherwise made
+           available under the terms of this License.
+
+    1.10. "Original Software" means the Source Code and Executable
+          form of computer software code that is originally released
+          under this License.
+
+    1.11. "Patent Claims" means any patent claim(s), now owned or
+          hereafter acquired, including without limitation, method,
+          process, and apparatus claims, in any patent Licensable by
+          grantor.
+
+    1.12. "Source Code" means (a) the common form of computer software
+          code in which modifications are made and (b) associated
+          documentation included in or with such code.
+
+    1.13. "You" (or "Your") means an individual or a legal entity
+          exercising rights under, and complying with all of the terms
+          of, this License.  For legal entities, "You" includes any
+          entity which controls, is controlled by, or is under common
+          control with You.  For purposes of this definition,
+          "control" means (a) the power, direct or indirect, to cause
+          the direction or management of such entity, whether by
+          contract or otherwise, or (b) ownership of more than fifty
+          percent (50%) of the outstanding shares or beneficial
+          ownership of such entity.
+
+2. License Grants.
+
+    2.1. The Initial Developer Grant.
+
+    Conditioned upon Your compliance with Section 3.1 below and
+    subject to third party intellectual property claims, the Initial
+    Developer hereby grants You a world-wide, royalty-free,
+    non-exclusive license:
+
+        (a) under intellectual property rights (other than patent or
+            trademark) Licensable by Initial Developer, to use,
+            reproduce, modify, display, perform, sublicense and
+            distribute the Original Software (or portions thereof),
+            with or without Modifications, and/or as part of a Larger
+            Work; and
+
+        (b) under Patent Claims infringed by the making, using or
+            selling of Original Software, to make, have made, use,
+            practice, sell, and offer for sale, and/or otherwise
+            dispose of the Original Software (or portions thereof).
+
+        (c) The licenses granted in Sections 2.1(a) and (b) are
+            effective on the date Initial Developer first distributes
+            or otherwise makes the Original Software available to a
+            third party under the terms of this License.
+
+        (d) Notwithstanding Section 2.1(b) above, no patent license is
+            granted: (1) for code that You delete from the Original
+            Software, or (2) for infringements caused by: (i) the
+            modification of the Original Software, or (ii) the
+            combination of the Original Software with other software
+            or devices.
+
+    2.2. Contributor Grant.
+
+    Conditioned upon Your compliance with Section 3.1 below and
+    subject to third party intellectual property claims, each
+    Contributor hereby grants You a world-wide, royalty-free,
+    non-exclusive license:
+
+        (a) under intellectual property rights (other than patent or
+            trademark) Licensable by Contributor to use, reproduce,
+            modify, display, perform, sublicense and distribute the
+            Modifications created by such Contributor (or portions
+            thereof), either on an unmodified basis, with other
+            Modifications, as Covered Software and/or as part of a
+            Larger Work; and
+
+        (b) under Patent Claims infringed by the making, using, or
+            selling of Modifications made by that Contributor either
+            alone and/or in combination with its Contributor Version
+            (or portions of such combination), to make, use, sell,
+            offer for sale, have made, and/or otherwise dispose of:
+            (1) Modifications made by that Contributor (or portions
+            thereof); and (2) the combination of Modifications made by
+            that Contributor with its Contributor Version (or portions
+            of such combination).
+
+        (c) The licenses granted in Sections 2.2(a) and 2.2(b) are
+            effective on the date Contributor first distributes or
+            otherwise makes the Modifications available to a third
+            party.
+
+        (d) Notwithstanding Section 2.2(b) above, no patent license is
+            granted: (1) for any code that Contributor has deleted
+            from the Contributor Version; (2) for infringements caused
+            by: (i) third party modifications of Contributor Version,
+            or (ii) the combination of Modifications made by that
+            Contributor with other software (except as part of the
+            Contributor Version) or other devices; or (3) under Patent
+            Claims infringed by Covered Software in the absence of
+            Modifications made by that Contributor.
+
+3. Distribution Obligations.
+
+    3.1. Availability of Source Code.
+
+    Any Covered Software that You distribute or otherwise make
+    available in Executable form must also be made available in Source
+    Code form and that Source Code form must be distributed only under
+    the terms of this License.  You must include a copy of this
+    License with every copy of the Source Code form of the Covered
+    Software You distribute or otherwise make available.  You must
+    inform recipients of any such Covered Software in Executable form
+    as to how they can obtain such Covered Software in Source Code
+    form in a reasonable manner on or through a medium customarily
+    used for software exchange.
+
+    3.2. Modifications.
+
+    The Modifications that You create or to which You contribute are
+    governed by the terms of this License.  You represent that You
+    believe Your Modifications are Your original creation(s) and/or
+    You have sufficient rights to grant the rights conveyed by this
+    License.
+
+    3.3. Required Notices.
+
+    You must include a notice in each of Your Modifications that
+    identifies You as the Contributor of the Modification.  You may
+    not remove or alter any copyright, patent or trademark notices
+    contained within the Covered Software, or any notices of licensing
+    or any descriptive text giving attribution to any Contributor or
+    the Initial Developer.
+
+    3.4. Application of Additional Terms.
+
+    You may not offer or impose any terms on any Covered Software in
+    Source Code form that alters or restricts the applicable version
+    of this License or the recipients' rights hereunder.  You may
+    choose to offer, and to charge a fee for, warranty, support,
+    indemnity or liability obligations to one or more recipients of
+    Covered Software.  However, you may do so only on Your own behalf,
+    and not on behalf of the Initial Developer or any Contributor.
+    You must make it absolutely clear that any such warranty, support,
+    indemnity or liability obligation is offered by You alone, and You
+    hereby agree to indemnify the Initial Developer and every
+    Contributor for any liability incurred by the Initial Developer or
+    such Contributor as a result of warranty, support, indemnity or
+    liability terms You offer.
+
+    3.5. Distribution of Executable Versions.
+
+    You may distribute the Executable form of the Covered Software
+    under the terms of this License or under the terms of a license of
+    Your choice, which may contain terms different from this License,
+    provided that You are in compliance with the terms of this License
+    and that the license for the Executable form does not attempt to
+    limit or alter the recipient's rights in the Source Code form from
+    the rights set forth in this License.  If You distribute the
+    Covered Software in Executable form under a different license, You
+    must make it absolutely clear that any terms which differ from
+    this License are offered by You alone, not by the Initial
+    Developer or Contributor.  You hereby agree to indemnify the
+    Initial Developer and every Contributor for any liability incurred
+    by the Initial Developer or such Contributor as a result of any
+    such terms You offer.
+
+    3.6. Larger Works.
+
+    You may create a Larger Work by combining Covered Software with
+    other code not governed by the terms of this License and
+    distribute the Larger Work as a single product.  In such a case,
+    You must make sure the requirements of this License are fulfilled
+    for the Covered Software.
+
+4. Versions of the License.
+
+    4.1. New Versions.
+
+    Sun Microsystems, Inc. is the initial license steward and may
+    publish revised and/or new versions of this License from time to
+    time.  Each version will be given a distinguishing version number.
+    Except as provided in Section 4.3, no one other than the license
+    steward has the right to modify this License.
+
+    4.2. Effect of New Versions.
+
+    You may always continue to use, distribute or otherwise make the
+    Covered Software available under the terms of the version of the
+    License under which You originally received the Covered Software.
+    If the Initial Developer includes a notice in the Original
+    Software prohibiting it from being distributed or otherwise made
+    available under any subsequent version of the License, You must
+    distribute and make the Covered Software available under the terms
+    of the version of the License under which You originally received
+    the Covered Software.  Otherwise, You may also choose to use,
+    distribute or otherwise make the Covered Software available under
+    the terms of any subsequent version of the License published by
+    the license steward.
+
+    4.3. Modified Versions.
+
+    When You are an Initial Developer and You want to create a new
+    license for Your Original Software, You may create and use a
+    modified version of this License if You: (a) rename the license
+    and remove any references to the name of the license steward
+    (except to note that the license differs from this License); and
+    (b) otherwise make it clear that the license contains terms which
+    differ from this License.
+
+5. DISCLAIMER OF WARRANTY.
+
+    COVERED SOFTWARE IS PROVIDED UNDER THIS LICENSE ON AN "AS IS"
+    BASIS, WITHOUT WARRANTY OF ANY KIND, EITHER EXPRESSED OR IMPLIED,
+    INCLUDING, WITHOUT LIMITATION, WARRANTIES THAT THE COVERED
+    SOFTWARE IS FREE OF DEFECTS, MERCHANTABLE, FIT FOR A PARTICULAR
+    PURPOSE OR NON-INFRINGING.  THE ENTIRE RISK AS TO THE QUALITY AND
+    PERFORMANCE OF THE COVERED SOFTWARE IS WITH YOU.  SHOULD ANY
+    COVERED SOFTWARE PROVE DEFECTIVE IN ANY RESPECT, YOU (NOT THE
+    INITIAL DEVELOPER OR ANY OTHER CONTRIBUTOR) ASSUME THE COST OF ANY
+    NECESSARY SERVICING, REPAIR OR CORRECTION.  THIS DISCLAIMER OF
+    WARRANTY CONSTITUTES AN ESSENTIAL PART OF THIS LICENSE.  NO USE OF
+    ANY COVERED SOFTWARE IS AUTHORIZED HEREUNDER EXCEPT UNDER THIS
+    DISCLAIMER.
+
+6. TERMINATION.
+
+    6.1. This License and the rights granted hereunder will terminate
+    automatically if You fail to comply with terms herein and fail to
+    cure such breach within 30 days of becoming aware of the breach.
+    Provisions which, by their nature, must remain in effect beyond
+    the termination of this License shall survive.
+
+    6.2. If You assert a patent infringement claim (excluding
+    declaratory judgment actions) against Initial Developer or a
+    Contributor (the Initial Developer or Contributor against whom You
+    assert such claim is referred to as "Participant") alleging that
+    the Participant Software (meaning the Contributor Version where
+    the Participant is a Contributor or the Original Software where
+    the Participant is the Initial Developer) directly or indirectly
+    infringes any patent, then any and all rights granted directly or
+    indirectly to You by such Participant, the Initial Developer (if
+    the Initial Developer is not the Participant) and all Contributors
+    under Sections 2.1 and/or 2.2 of this License shall, upon 60 days
+    notice from Participant terminate prospectively and automatically
+    at the expiration of such 60 day notice period, unless if within
+    such 60 day period You withdraw Your claim with respect to the
+    Participant Software against such Participant either unilaterally
+    or pursuant to a written agreement with Participant.
+
+    6.3. In the event of termination under Sections 6.1 or 6.2 above,
+    all end user licenses that have been validly granted by You or any
+    distributor hereunder prior to termination (excluding licenses
+    granted to You by any distributor) shall survive termination.
+
+7. LIMITATION OF LIABILITY.
+
+    UNDER NO CIRCUMSTANCES AND UNDER NO LEGAL THEORY, WHETHER TORT
+    (INCLUDING NEGLIGENCE), CONTRACT, OR OTHERWISE, SHALL YOU, THE
+    INITIAL DEVELOPER, ANY OTHER CONTRIBUTOR, OR ANY DISTRIBUTOR OF
+    COVERED SOFTWARE, OR ANY SUPPLIER OF ANY OF SUCH PARTIES, BE
+    LIABLE TO ANY PERSON FOR ANY INDIRECT, SPECIAL, INCIDENTAL, OR
+    CONSEQUENTIAL DAMAGES OF ANY CHARACTER INCLUDING, WITHOUT
+    LIMITATION, DAMAGES FOR LOST PROFITS, LOSS OF GOODWILL, WORK
+    STOPPAGE, COMPUTER FAILURE OR MALFUNCTION, OR ANY AND ALL OTHER
+    COMMERCIAL DAMAGES OR LOSSES, EVEN IF SUCH PARTY SHALL HAVE BEEN
+    INFORMED OF THE POSSIBILITY OF SUCH DAMAGES.  THIS LIMITATION OF
+    LIABILITY SHALL NOT APPLY TO LIABILITY FOR DEATH OR PERSONAL
+    INJURY RESULTING FROM SUCH PARTY'S NEGLIGENCE TO THE EXTENT
+    APPLICABLE LAW PROHIBITS SUCH LIMITATION.  SOME JURISDICTIONS DO
+    NOT ALLOW THE EXCLUSION OR LIMITATION OF INCIDENTAL OR
+    CONSEQUENTIAL DAMAGES, SO THIS EXCLUSION AND LIMITATION MAY NOT
+    APPLY TO YOU.
+
+8. U.S. GOVERNMENT END USERS.
+
+    The Covered Software is a "commercial item," as that term is
+    defined in 48 C.F.R. 2.101 (Oct. 1995), consisting of "commercial
+    computer software" (as that term is defined at 48
+    C.F.R. 252.227-7014(a)(1)) and "commercial computer software
+    documentation" as such terms are used in 48 C.F.R. 12.212
+    (Sept. 1995).  Consistent with 48 C.F.R. 12.212 and 48
+    C.F.R. 227.7202-1 through 227.7202-4 (June 1995), all
+    U.S. Government End Users acquire Covered Software with only those
+    rights set forth herein.  This U.S. Government Rights clause is in
+    lieu of, and supersedes, any other FAR, DFAR, or other clause or
+    provision that addresses Government rights in computer software
+    under this License.
+
+9. MISCELLANEOUS.
+
+    This License represents the complete agreement concerning subject
+    matter hereof.  If any provision of this License is held to be
+    unenforceable, such provision shall be reformed only to the extent
+    necessary to make it enforceable.  This License shall be governed
+    by the law of the jurisdiction specified in a notice contained
+    within the Original Software (except to the extent applicable law,
+    if any, provides otherwise), excluding such jurisdiction's
+    conflict-of-law provisions.  Any litigation relating to this
+    License shall be subject to the jurisdiction of the courts located
+    in the jurisdiction and venue specified in a notice contained
+    within the Original Software, with the losing party responsible
+    for costs, including, without limitation, court costs and
+    reasonable attorneys' fees and expenses.  The application of the
+    United Nations Convention on Contracts for the International Sale
+    of Goods is expressly excluded.  Any law or regulation which
+    provides that the language of a contract shall be construed
+    against the drafter shall not apply to this License.  You agree
+    that You alone are responsible for compliance with the United
+    States export administration regulations (and the export control
+    laws and regulation of any other countries) when You use,
+    distribute or otherwise make available any Covered Software.
+
+10. RESPONSIBILITY FOR CLAIMS.
+
+    As between Initial Developer and the Contributors, each party is
+    responsible for claims and damages arising, directly or
+    indirectly, out of its utilization of rights under this License
+    and You agree to work with Initial Developer and Contributors to
+    distribute such responsibility on an equitable basis.  Nothing
+    herein is intended or shall be deemed to constitute any admission
+    of liability.
+
+--------------------------------------------------------------------
+
+NOTICE PURSUANT TO SECTION 9 OF THE COMMON DEVELOPMENT AND
+DISTRIBUTION LICENSE (CDDL)
+
+For Covered Software in this distribution, this License shall
+be governed by the laws of the State of California (excluding
+conflict-of-law provisions).
+
+Any litigation relating to this License shall be subject to the
+jurisdiction of the Federal Courts of the Northern District of
+California and the state courts of the State of California, with
+venue lying in Santa Clara County, California.
+
+*/
+
+/*
+ * Copyright 2006 Sun Microsystems, Inc.  All rights reserved.
+ * Use is subject to license terms.
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+
+/* BEGIN CSTYLED */
+/* This is a derivation of a BDF font from the X consolidation */
+/* COMMENT Originally a BSD vfont. */
+/* FONT -Sun-Gallant-Demi-R-Normal--19-190-72-72-M-120-ISO8859-1 */
+/* Generated by FontPack.py from 12x22.c, do not edit */
+/* 9152 bytes packed into 2930 */
+
+UINT8 FONTDATA_12x22_LZ4[] = {
+0x15, 0x00, 0x01, 0x00, 0xf6, 0x09, 0x06, 0x00, 0x0f, 0xc0, 0x1f, 0x80,
+0x3f, 0xc0, 0x7f, 0xe0, 0xff, 0xf0, 0xff, 0xf0, 0x7f, 0xe0, 0x3f, 0xc0,
+0x1f, 0x80, 0x0f, 0xc0, 0x06, 0x80, 0x22, 0x00, 0x4f, 0x33, 0x30, 0xcc,
+0xc0, 0x04, 0x00, 0x15, 0x4c, 0x06, 0x00, 0x06, 0x80, 0x02, 0x00, 0x36,
+0xfe, 0x00, 0xfe, 0x4d, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x00, 0x2c, 0x00,
+0x1f, 0x06, 0x02, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x4f, 0x07, 0xf0,
+0x07, 0xf0, 0x2c, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x01, 0x00, 0x2c, 0x00,
+0x0f, 0x44, 0x00, 0x01, 0x00, 0xf4, 0x00, 0x0f, 0x9d, 0x00, 0x16, 0x0f,
+0x38, 0x00, 0x2c, 0x0f, 0x34, 0x00, 0x55, 0x04, 0x38, 0x00, 0x0f, 0x08,
+0x01, 0x01, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x34, 0x01, 0x05, 0x0f, 0x2c,
+0x00, 0x15, 0x0f, 0xb8, 0x01, 0x05, 0x0f, 0x84, 0x00, 0x05, 0x0f, 0xc8,
+0x00, 0x2d, 0x0f, 0x02, 0x00, 0x17, 0x0f, 0x01, 0x00, 0x1d, 0x0f, 0x46,
+0x00, 0x07, 0x0e, 0x4e, 0x00, 0x26, 0x19, 0x80, 0x02, 0x00, 0x0f, 0x58,
+0x00, 0x0d, 0x20, 0x03, 0x30, 0x02, 0x00, 0xa0, 0x06, 0x60, 0x1f, 0xf0,
+0x1f, 0xf0, 0x0c, 0xc0, 0x0c, 0xc0, 0x34, 0x00, 0x9d, 0x7f, 0xc0, 0x7f,
+0xc0, 0x33, 0x00, 0x66, 0x00, 0x66, 0x84, 0x00, 0x00, 0x92, 0x03, 0xfe,
+0x07, 0x66, 0xe0, 0x66, 0x60, 0x66, 0x00, 0x3e, 0x00, 0x1f, 0x80, 0x07,
+0xc0, 0x06, 0x60, 0x06, 0x60, 0x66, 0x60, 0x7f, 0xc0, 0x3f, 0x80, 0xd2,
+0x00, 0xb1, 0x38, 0xc0, 0x4c, 0xc0, 0x45, 0x80, 0x65, 0x80, 0x3b, 0x00,
+0x03, 0xa4, 0x00, 0xcb, 0x0c, 0x00, 0x0d, 0xc0, 0x1a, 0x60, 0x1a, 0x20,
+0x33, 0x20, 0x31, 0xc0, 0x32, 0x03, 0x50, 0x00, 0x0f, 0x80, 0x18, 0xc0,
+0x02, 0x00, 0xfa, 0x05, 0x0f, 0x80, 0x1e, 0x00, 0x3e, 0x00, 0x77, 0x00,
+0x63, 0x60, 0x61, 0xe0, 0x61, 0xc0, 0x61, 0x80, 0x3f, 0xe0, 0x1e, 0x60,
+0x2c, 0x00, 0x53, 0x0c, 0x00, 0x1e, 0x00, 0x1e, 0x50, 0x00, 0x3f, 0x18,
+0x00, 0x10, 0xdc, 0x00, 0x0a, 0x24, 0x01, 0x80, 0x7a, 0x00, 0x08, 0x02,
+0x00, 0x00, 0x12, 0x00, 0x3b, 0x03, 0x00, 0x01, 0x1a, 0x01, 0x15, 0x18,
+0x1a, 0x00, 0x08, 0x02, 0x00, 0x04, 0x68, 0x00, 0x0f, 0x01, 0x00, 0x03,
+0x80, 0x0f, 0x00, 0x06, 0x00, 0x66, 0x60, 0x76, 0xe0, 0x66, 0x01, 0x9f,
+0x19, 0x80, 0x76, 0xe0, 0x66, 0x60, 0x06, 0x00, 0x0f, 0xc2, 0x01, 0x0e,
+0x4f, 0x7f, 0xe0, 0x7f, 0xe0, 0x06, 0x02, 0x1b, 0x0f, 0xf4, 0x00, 0x13,
+0x00, 0x58, 0x00, 0x0f, 0x52, 0x02, 0x19, 0x02, 0x56, 0x00, 0x1c, 0x0c,
+0x17, 0x00, 0x70, 0x60, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0x80, 0x3c, 0x01,
+0x06, 0x3e, 0x01, 0x8a, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00,
+0x8d, 0x01, 0x00, 0xb8, 0x01, 0x5a, 0x11, 0x80, 0x10, 0xc0, 0x30, 0x02,
+0x00, 0x6b, 0x80, 0x18, 0x80, 0x1f, 0x00, 0x0e, 0x57, 0x00, 0x9f, 0x02,
+0x00, 0x06, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x36, 0xc6, 0x02, 0x00, 0x1b,
+0x3f, 0x10, 0x02, 0x80, 0x1f, 0x00, 0x3f, 0x80, 0x61, 0xc0, 0x40, 0xc0,
+0x8a, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x88, 0x00, 0x00, 0x84, 0x00, 0x2e,
+0x30, 0x20, 0xe4, 0x00, 0xfe, 0x0e, 0x0f, 0x80, 0x1f, 0xc0, 0x20, 0xe0,
+0x40, 0x60, 0x00, 0x60, 0x00, 0xe0, 0x07, 0xc0, 0x0f, 0xc0, 0x00, 0xe0,
+0x00, 0x60, 0x00, 0x60, 0x40, 0x60, 0x60, 0x40, 0x3f, 0x80, 0x1f, 0x10,
+0x02, 0xf0, 0x06, 0x80, 0x03, 0x80, 0x05, 0x80, 0x05, 0x80, 0x09, 0x80,
+0x09, 0x80, 0x11, 0x80, 0x11, 0x80, 0x21, 0x80, 0x3f, 0xe0, 0x7f, 0xe0,
+0xee, 0x00, 0x0c, 0x10, 0x02, 0xd3, 0x0f, 0xc0, 0x0f, 0xc0, 0x10, 0x00,
+0x10, 0x00, 0x20, 0x00, 0x3f, 0x80, 0x31, 0x56, 0x00, 0x01, 0x58, 0x00,
+0x4b, 0x60, 0x30, 0xc0, 0x1f, 0x2c, 0x00, 0x12, 0x07, 0x9e, 0x00, 0x01,
+0x20, 0x01, 0x71, 0x67, 0x80, 0x6f, 0xc0, 0x70, 0xe0, 0x60, 0x01, 0x00,
+0x1f, 0x70, 0x84, 0x00, 0x00, 0xd0, 0x1f, 0xe0, 0x3f, 0xe0, 0x60, 0x40,
+0x00, 0x40, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x78, 0x00, 0x61, 0x00, 0x01,
+0x00, 0x03, 0x00, 0x02, 0x20, 0x01, 0x1d, 0x04, 0x60, 0x02, 0x22, 0x11,
+0x80, 0x54, 0x01, 0x77, 0x18, 0x80, 0x0d, 0x00, 0x06, 0x00, 0x0b, 0x10,
+0x00, 0x0c, 0x68, 0x02, 0x54, 0x0f, 0x80, 0x11, 0xc0, 0x20, 0x78, 0x00,
+0x40, 0xe0, 0x3f, 0x60, 0x1e, 0xb0, 0x00, 0x01, 0x3e, 0x01, 0x3f, 0x07,
+0x00, 0x3c, 0x04, 0x02, 0x12, 0x0f, 0x10, 0x02, 0x04, 0x0f, 0x2e, 0x00,
+0x0a, 0x0f, 0x94, 0x02, 0x06, 0xfb, 0x02, 0x60, 0x01, 0xc0, 0x07, 0x00,
+0x1c, 0x00, 0x70, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0,
+0x3b, 0x02, 0x0f, 0xbc, 0x02, 0x04, 0x0f, 0xc4, 0x02, 0x0d, 0xfd, 0x02,
+0x60, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0xe0,
+0x03, 0x80, 0x0e, 0x00, 0x38, 0x57, 0x00, 0x79, 0x0f, 0x00, 0x1f, 0x80,
+0x39, 0xc0, 0x20, 0x3a, 0x02, 0x04, 0xb2, 0x00, 0x0f, 0xdc, 0x00, 0x03,
+0xfb, 0x0a, 0x0f, 0x80, 0x3f, 0xc0, 0x30, 0x60, 0x60, 0x60, 0x67, 0x20,
+0x6f, 0xa0, 0x6c, 0xa0, 0x6c, 0xa0, 0x67, 0xe0, 0x60, 0x00, 0x30, 0x00,
+0x3f, 0xe0, 0x0f, 0x8a, 0x00, 0x00, 0xec, 0x00, 0x60, 0x0b, 0x00, 0x0b,
+0x00, 0x09, 0x00, 0x3a, 0x02, 0xdd, 0x10, 0x80, 0x3f, 0xc0, 0x20, 0xc0,
+0x20, 0x40, 0x40, 0x60, 0x40, 0x60, 0xe0, 0x38, 0x06, 0x60, 0xff, 0x00,
+0x60, 0x80, 0x60, 0xc0, 0x02, 0x00, 0x30, 0x61, 0x80, 0x7f, 0x0a, 0x00,
+0x04, 0x01, 0x00, 0x2d, 0xc0, 0xff, 0x92, 0x05, 0x72, 0x0f, 0xc0, 0x10,
+0x60, 0x20, 0x20, 0x20, 0x61, 0x02, 0x03, 0x02, 0x00, 0x7d, 0x20, 0x00,
+0x30, 0x20, 0x18, 0x40, 0x0f, 0x2c, 0x00, 0x30, 0xff, 0x00, 0x61, 0x56,
+0x00, 0x0c, 0x01, 0x00, 0x3e, 0x40, 0x61, 0x80, 0xcc, 0x08, 0x60, 0x7f,
+0xc0, 0x30, 0x40, 0x30, 0x40, 0x96, 0x02, 0x61, 0x30, 0x80, 0x3f, 0x80,
+0x30, 0x80, 0x0a, 0x00, 0x30, 0x00, 0x30, 0x20, 0x46, 0x03, 0x0f, 0x2c,
+0x00, 0x14, 0x4e, 0x00, 0x30, 0x00, 0x78, 0x30, 0x01, 0x0b, 0xb0, 0x00,
+0xae, 0x61, 0xf0, 0x60, 0x60, 0x20, 0x60, 0x30, 0x60, 0x18, 0x60, 0xb0,
+0x00, 0x26, 0xf0, 0xf0, 0xa5, 0x00, 0x13, 0x7f, 0x9e, 0x02, 0x02, 0x01,
+0x00, 0x1d, 0xf0, 0x34, 0x01, 0x2f, 0x1f, 0x80, 0x2c, 0x07, 0x05, 0x0c,
+0x70, 0x03, 0x0f, 0x2c, 0x00, 0x09, 0x02, 0x02, 0x00, 0x54, 0x04, 0x00,
+0x38, 0x00, 0x30, 0x84, 0x00, 0xfc, 0x0c, 0xe0, 0x61, 0x80, 0x63, 0x00,
+0x66, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7c, 0x00, 0x6e, 0x00,
+0x67, 0x00, 0x63, 0x80, 0x61, 0xc0, 0x60, 0xe0, 0xf0, 0x70, 0x58, 0x00,
+0x15, 0x78, 0xf8, 0x00, 0x09, 0x02, 0x00, 0x0f, 0x34, 0x01, 0x02, 0x51,
+0xe0, 0x70, 0x60, 0xe0, 0x70, 0x02, 0x00, 0x20, 0x59, 0x60, 0x02, 0x00,
+0xbd, 0x4d, 0x60, 0x4e, 0x60, 0x4e, 0x60, 0x44, 0x60, 0x44, 0x60, 0xe4,
+0xdc, 0x00, 0xf4, 0x0c, 0xc0, 0x70, 0x60, 0x20, 0x70, 0x20, 0x78, 0x20,
+0x58, 0x20, 0x4c, 0x20, 0x46, 0x20, 0x47, 0x20, 0x43, 0x20, 0x41, 0xa0,
+0x40, 0xe0, 0x40, 0xe0, 0x40, 0x60, 0xe0, 0xa7, 0x00, 0x08, 0xf6, 0x03,
+0x00, 0x5a, 0x02, 0x09, 0xe1, 0x01, 0x4e, 0x20, 0x40, 0x30, 0x40, 0xf4,
+0x03, 0x30, 0x00, 0x00, 0x7f, 0x10, 0x04, 0x11, 0x60, 0x02, 0x00, 0x27,
+0xc0, 0x37, 0xb6, 0x01, 0x0f, 0xb8, 0x01, 0x02, 0x0f, 0x58, 0x00, 0x00,
+0xd7, 0x30, 0x40, 0x38, 0x40, 0x1f, 0x80, 0x0e, 0x00, 0x1f, 0x00, 0x23,
+0x90, 0x01, 0xe2, 0x00, 0x33, 0xff, 0x00, 0x61, 0xc0, 0x02, 0x3f, 0x60,
+0x80, 0x7f, 0x34, 0x01, 0x0c, 0x30, 0x1f, 0xe0, 0x30, 0x01, 0x02, 0xd0,
+0x20, 0x70, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x07, 0x80, 0x01, 0xc0, 0x00,
+0xe0, 0x16, 0x03, 0x3d, 0x60, 0xc0, 0x7f, 0xb8, 0x01, 0x4f, 0x7f, 0xe0,
+0x46, 0x20, 0xe4, 0x01, 0x15, 0x20, 0xf0, 0x70, 0x56, 0x00, 0x0c, 0x02,
+0x00, 0x20, 0x70, 0x40, 0x0a, 0x0c, 0x0d, 0x8c, 0x01, 0x40, 0xe0, 0x60,
+0x40, 0x30, 0xb8, 0x02, 0x30, 0x80, 0x19, 0x00, 0x02, 0x00, 0x71, 0x0a,
+0x00, 0x0e, 0x00, 0x0e, 0x00, 0x04, 0x02, 0x00, 0x0d, 0xcc, 0x0b, 0x30,
+0xf0, 0x66, 0x20, 0x02, 0x00, 0xbf, 0x76, 0x20, 0x77, 0x40, 0x33, 0x40,
+0x37, 0x40, 0x3b, 0xc0, 0x3b, 0x2e, 0x09, 0x06, 0x00, 0x84, 0x00, 0x42,
+0x30, 0x40, 0x38, 0x80, 0x80, 0x05, 0x02, 0x82, 0x05, 0x00, 0x46, 0x01,
+0x0f, 0xf4, 0x03, 0x01, 0x02, 0x2c, 0x00, 0x15, 0x18, 0x2c, 0x00, 0x06,
+0x02, 0x00, 0x0e, 0xb8, 0x01, 0x20, 0x3f, 0xe0, 0xa2, 0x04, 0x0f, 0x66,
+0x07, 0x00, 0x2d, 0x20, 0x3f, 0xe0, 0x06, 0x2a, 0x0f, 0x80, 0xc0, 0x08,
+0x04, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x0c, 0x1e, 0x05, 0x00, 0xfa, 0x01,
+0x00, 0xac, 0x07, 0x06, 0xe8, 0x08, 0x00, 0xea, 0x08, 0x21, 0x01, 0x80,
+0x4a, 0x07, 0x09, 0x2b, 0x05, 0x3b, 0x1f, 0x00, 0x1f, 0xec, 0x08, 0x04,
+0x02, 0x00, 0x00, 0x1a, 0x00, 0x0a, 0x01, 0x00, 0x9b, 0x04, 0x00, 0x0e,
+0x00, 0x1b, 0x00, 0x31, 0x80, 0x60, 0xa8, 0x07, 0x0f, 0xa2, 0x0c, 0x2d,
+0x00, 0xfa, 0x06, 0x01, 0xd2, 0x0b, 0x4f, 0x80, 0x07, 0x80, 0x03, 0x42,
+0x00, 0x16, 0x00, 0x2c, 0x0a, 0x53, 0x10, 0xc0, 0x03, 0xc0, 0x1c, 0x70,
+0x08, 0x3b, 0x39, 0xc0, 0x1e, 0x34, 0x01, 0x00, 0x9c, 0x04, 0x02, 0xb1,
+0x07, 0x08, 0x8e, 0x07, 0x7f, 0x60, 0x60, 0x70, 0x60, 0x78, 0xc0, 0x4f,
+0x12, 0x0b, 0x06, 0x64, 0x1f, 0x80, 0x31, 0xc0, 0x20, 0xc0, 0xd6, 0x04,
+0x2e, 0x70, 0x40, 0xe8, 0x07, 0x05, 0x57, 0x00, 0x54, 0x60, 0x0f, 0x60,
+0x31, 0xe0, 0x6e, 0x07, 0x00, 0x70, 0x07, 0x3d, 0x39, 0x60, 0x1e, 0x18,
+0x03, 0x06, 0x78, 0x03, 0x11, 0x30, 0xb2, 0x05, 0x20, 0x7f, 0xe0, 0x3b,
+0x00, 0x2e, 0x30, 0x00, 0x28, 0x05, 0x64, 0x03, 0x80, 0x04, 0xc0, 0x04,
+0xc0, 0xd8, 0x01, 0x19, 0x3f, 0xf0, 0x01, 0x1f, 0x1e, 0x08, 0x01, 0x06,
+0x42, 0x1f, 0x20, 0x31, 0xe0, 0xa4, 0x03, 0xf0, 0x01, 0x31, 0x80, 0x3f,
+0x00, 0x60, 0x00, 0x7f, 0xc0, 0x3f, 0xe0, 0x20, 0x60, 0x40, 0x20, 0x40,
+0x20, 0x90, 0x0b, 0x00, 0x22, 0x00, 0x51, 0x10, 0x00, 0x30, 0x00, 0x70,
+0x14, 0x02, 0x3b, 0x37, 0x80, 0x39, 0xa6, 0x09, 0x1d, 0x79, 0xd0, 0x04,
+0x04, 0x90, 0x0a, 0x02, 0xd6, 0x07, 0x0f, 0x9c, 0x03, 0x0b, 0x01, 0x50,
+0x02, 0x00, 0xba, 0x00, 0x03, 0xa4, 0x09, 0x08, 0x02, 0x00, 0x55, 0x20,
+0xc0, 0x30, 0xc0, 0x38, 0x02, 0x0a, 0x05, 0x33, 0x01, 0x30, 0x00, 0x61,
+0xc0, 0x86, 0x05, 0x17, 0x7c, 0x84, 0x05, 0x1b, 0xf1, 0x84, 0x00, 0x0e,
+0x7a, 0x00, 0x0f, 0x84, 0x00, 0x0a, 0x03, 0x01, 0x00, 0x30, 0xdd, 0xc0,
+0x6e, 0x92, 0x0c, 0x07, 0x02, 0x00, 0x1f, 0xef, 0x8c, 0x01, 0x06, 0x3f,
+0x27, 0x80, 0x79, 0x08, 0x01, 0x0e, 0x0f, 0x52, 0x09, 0x01, 0x00, 0xcc,
+0x09, 0x00, 0xd4, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x56, 0xef, 0x80, 0x71,
+0xc0, 0x60, 0xe0, 0x06, 0x45, 0x40, 0x70, 0x80, 0x7f, 0x20, 0x07, 0x0c,
+0x29, 0x04, 0x38, 0x0f, 0x20, 0x11, 0x3c, 0x02, 0x44, 0x60, 0x38, 0xe0,
+0x1f, 0x23, 0x01, 0x0d, 0x2d, 0x00, 0x6f, 0x73, 0x80, 0x34, 0xc0, 0x38,
+0xc0, 0xd8, 0x05, 0x0b, 0x05, 0x10, 0x02, 0x00, 0xd0, 0x00, 0x23, 0x40,
+0x38, 0x84, 0x05, 0x00, 0x86, 0x01, 0x02, 0x06, 0x02, 0x0c, 0xcc, 0x03,
+0x55, 0x04, 0x00, 0x0c, 0x00, 0x7f, 0x6e, 0x02, 0x01, 0x02, 0x00, 0x4f,
+0x20, 0x0e, 0x40, 0x07, 0x60, 0x01, 0x06, 0x2a, 0x79, 0xe0, 0x32, 0x01,
+0x2c, 0x39, 0xc0, 0x94, 0x0d, 0x0c, 0x04, 0x05, 0x04, 0x06, 0x05, 0x02,
+0x08, 0x05, 0x0f, 0x0a, 0x04, 0x06, 0x12, 0x70, 0x88, 0x05, 0x6f, 0x37,
+0x40, 0x3b, 0x40, 0x3b, 0x40, 0xae, 0x0e, 0x0b, 0x20, 0xf8, 0xf0, 0x80,
+0x01, 0x71, 0x1d, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x0b, 0x98, 0x01, 0x1f,
+0xf1, 0xac, 0x0f, 0x06, 0x2e, 0xf0, 0xf0, 0x84, 0x00, 0x00, 0xf4, 0x00,
+0x4c, 0x08, 0x00, 0x78, 0x00, 0x19, 0x02, 0xfc, 0x03, 0x7f, 0xe0, 0x60,
+0xe0, 0x41, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38,
+0x20, 0x70, 0x60, 0xe8, 0x07, 0x17, 0x03, 0x6a, 0x08, 0x33, 0x0c, 0x00,
+0x38, 0x58, 0x05, 0x02, 0x02, 0x00, 0x1b, 0x03, 0xb0, 0x00, 0x0f, 0xfc,
+0x0f, 0x19, 0x18, 0x1c, 0x48, 0x00, 0x32, 0x00, 0x01, 0xc0, 0x0a, 0x05,
+0x02, 0x02, 0x00, 0x1f, 0x1c, 0xd6, 0x00, 0x00, 0x7f, 0x1c, 0x20, 0x3e,
+0x60, 0x67, 0xc0, 0x43, 0xd0, 0x0f, 0x0e, 0x0f, 0x54, 0x10, 0x1d, 0x0f,
+0x5c, 0x10, 0x0b, 0x0f, 0x32, 0x00, 0x01, 0x60, 0x1f, 0x80, 0x36, 0xc0,
+0x26, 0xc0, 0x1e, 0x10, 0x00, 0x02, 0x00, 0x42, 0x76, 0x40, 0x36, 0xc0,
+0x8e, 0x09, 0x0a, 0x3c, 0x03, 0x10, 0x1c, 0xd0, 0x0f, 0x01, 0x8c, 0x06,
+0x31, 0x7e, 0x00, 0x7e, 0x08, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x3e, 0x20,
+0x7f, 0xe0, 0x61, 0x46, 0x06, 0x04, 0x53, 0x60, 0x60, 0x2f, 0x40, 0x1f,
+0xe0, 0x0c, 0x00, 0x7c, 0x05, 0x3d, 0x2f, 0x40, 0x60, 0x68, 0x02, 0x01,
+0xb4, 0x08, 0x01, 0xa4, 0x10, 0x00, 0x7c, 0x0f, 0x00, 0x8c, 0x00, 0x06,
+0x0a, 0x0a, 0x0f, 0x8c, 0x01, 0x0d, 0x0f, 0x16, 0x00, 0x07, 0x00, 0x0e,
+0x07, 0x31, 0x31, 0x80, 0x31, 0x40, 0x09, 0x02, 0x0a, 0x00, 0x11, 0x1f,
+0x36, 0x07, 0x02, 0x0a, 0x00, 0x0e, 0x01, 0x00, 0x0f, 0x58, 0x11, 0x11,
+0x0c, 0x5c, 0x06, 0xff, 0x01, 0x20, 0x40, 0x4f, 0x20, 0x59, 0xa0, 0x58,
+0x20, 0x58, 0x20, 0x59, 0xa0, 0x4f, 0x20, 0x20, 0x40, 0xd4, 0x0a, 0x00,
+0x81, 0x00, 0x31, 0x80, 0x01, 0x80, 0x07, 0x80, 0x19, 0x78, 0x00, 0x5d,
+0x33, 0x80, 0x1d, 0xc0, 0x00, 0x1a, 0x0f, 0x0f, 0x92, 0x01, 0x00, 0x10,
+0x60, 0xb4, 0x11, 0x00, 0xae, 0x11, 0x7f, 0x33, 0x00, 0x19, 0x80, 0x0c,
+0xc0, 0x06, 0x9c, 0x03, 0x02, 0x34, 0x3f, 0xc0, 0x3f, 0xa0, 0x05, 0x0f,
+0x01, 0x00, 0x1a, 0x0f, 0x54, 0x10, 0x11, 0x00, 0xdc, 0x00, 0x62, 0x5f,
+0x20, 0x59, 0xa0, 0x59, 0xa0, 0x06, 0x00, 0x0f, 0xdc, 0x00, 0x01, 0x00,
+0x26, 0x00, 0x0f, 0xc2, 0x05, 0x07, 0x0a, 0x2e, 0x07, 0x02, 0x0a, 0x04,
+0x0f, 0x48, 0x11, 0x07, 0x0f, 0x58, 0x11, 0x13, 0x0c, 0xba, 0x00, 0x00,
+0x18, 0x0e, 0x34, 0x31, 0x80, 0x21, 0x4c, 0x10, 0x11, 0x40, 0x12, 0x01,
+0x0f, 0x84, 0x00, 0x06, 0x91, 0x1b, 0x80, 0x21, 0x80, 0x01, 0x80, 0x0f,
+0x00, 0x03, 0x06, 0x02, 0x0e, 0xc6, 0x0f, 0x09, 0x22, 0x04, 0x01, 0x52,
+0x00, 0x0f, 0x01, 0x00, 0x1b, 0x0b, 0x32, 0x11, 0x5c, 0xc0, 0x39, 0xc0,
+0x36, 0xe0, 0x60, 0x11, 0x51, 0x1f, 0xf0, 0x3c, 0xc0, 0x7c, 0x02, 0x00,
+0x40, 0x3c, 0xc0, 0x1c, 0xc0, 0x9c, 0x13, 0x04, 0x02, 0x00, 0x1f, 0x1c,
+0x94, 0x01, 0x0c, 0x00, 0x72, 0x0a, 0x00, 0x20, 0x03, 0x0f, 0x12, 0x04,
+0x21, 0x00, 0x30, 0x0a, 0x04, 0x7c, 0x01, 0x02, 0xb4, 0x11, 0x1f, 0x16,
+0x86, 0x07, 0x12, 0x00, 0x06, 0x11, 0x16, 0x19, 0x0c, 0x12, 0x30, 0x80,
+0x19, 0x80, 0x00, 0x08, 0x0f, 0xc0, 0x02, 0x0f, 0x06, 0xb8, 0x02, 0x04,
+0xc8, 0x02, 0x0c, 0x01, 0x00, 0x00, 0xc6, 0x08, 0xf0, 0x06, 0x10, 0x00,
+0x10, 0x40, 0x10, 0x80, 0x11, 0x00, 0x3a, 0x40, 0x04, 0xc0, 0x09, 0x40,
+0x12, 0x40, 0x24, 0x40, 0x47, 0xe0, 0x00, 0x46, 0x11, 0x0f, 0x2c, 0x00,
+0x09, 0xed, 0x00, 0x05, 0xc0, 0x0a, 0x20, 0x10, 0x20, 0x20, 0xc0, 0x41,
+0x00, 0x02, 0x00, 0x03, 0x34, 0x01, 0xbf, 0x38, 0x00, 0x44, 0x00, 0x04,
+0x00, 0x18, 0x40, 0x04, 0x80, 0x45, 0x58, 0x00, 0x0c, 0x00, 0x16, 0x0b,
+0x04, 0x08, 0x00, 0x03, 0x8a, 0x12, 0x00, 0x02, 0x00, 0x20, 0x40, 0x39,
+0x94, 0x18, 0x0d, 0x24, 0x11, 0x00, 0x44, 0x01, 0x06, 0x2e, 0x10, 0x31,
+0x19, 0x80, 0x11, 0x2a, 0x10, 0x1f, 0x60, 0x28, 0x10, 0x00, 0x04, 0x3a,
+0x02, 0x0f, 0x2c, 0x00, 0x11, 0x00, 0xd4, 0x01, 0x00, 0x76, 0x04, 0x0f,
+0x2c, 0x00, 0x11, 0x5f, 0x1c, 0x40, 0x3f, 0xc0, 0x23, 0x2c, 0x00, 0x14,
+0x02, 0xcc, 0x04, 0x1f, 0x04, 0x2c, 0x00, 0x12, 0x00, 0x82, 0x00, 0x1f,
+0x0f, 0x2c, 0x00, 0x14, 0x80, 0x00, 0x00, 0x03, 0xf0, 0x07, 0x10, 0x07,
+0x10, 0x28, 0x00, 0xfd, 0x02, 0x0b, 0x20, 0x13, 0xe0, 0x13, 0x20, 0x3f,
+0x00, 0x23, 0x00, 0x23, 0x00, 0x43, 0x10, 0x43, 0x10, 0xe7, 0x2c, 0x00,
+0x0f, 0x04, 0x11, 0x09, 0x0a, 0x94, 0x02, 0x00, 0x60, 0x01, 0x6b, 0x01,
+0x00, 0x7f, 0xe0, 0x30, 0x20, 0xae, 0x10, 0x0f, 0xa4, 0x0f, 0x00, 0x00,
+0x60, 0x01, 0x1f, 0x08, 0x2c, 0x00, 0x14, 0x40, 0x07, 0x00, 0x0d, 0x80,
+0x36, 0x04, 0x0f, 0x2c, 0x00, 0x11, 0x02, 0x34, 0x01, 0x0f, 0x2c, 0x00,
+0x13, 0x00, 0x8c, 0x0d, 0x1f, 0x02, 0xb0, 0x10, 0x04, 0x0c, 0x4e, 0x03,
+0x00, 0x0e, 0x0e, 0x1f, 0x04, 0x2c, 0x00, 0x14, 0x04, 0x10, 0x02, 0x0f,
+0x2e, 0x00, 0x01, 0x0c, 0x2c, 0x00, 0x02, 0xb0, 0x00, 0x0f, 0x58, 0x00,
+0x13, 0x50, 0x00, 0x00, 0x7f, 0x00, 0x31, 0xc2, 0x03, 0x01, 0x56, 0x10,
+0x32, 0xfc, 0x60, 0xfc, 0x5e, 0x10, 0x6c, 0x60, 0x30, 0x40, 0x31, 0x80,
+0x7e, 0x94, 0x08, 0x01, 0x68, 0x02, 0x04, 0xdc, 0x10, 0x30, 0x5c, 0x20,
+0x4e, 0xda, 0x10, 0x2f, 0xa0, 0x41, 0xd8, 0x10, 0x02, 0x02, 0xb8, 0x01,
+0x01, 0x54, 0x0b, 0x07, 0x84, 0x10, 0x0f, 0xd8, 0x10, 0x03, 0x02, 0x08,
+0x01, 0x0f, 0x2c, 0x00, 0x13, 0x6c, 0x06, 0x00, 0x09, 0x00, 0x10, 0x80,
+0xdc, 0x10, 0x0f, 0x2c, 0x00, 0x03, 0x6f, 0x1c, 0x60, 0x3f, 0xc0, 0x22,
+0x80, 0x58, 0x00, 0x13, 0x02, 0x34, 0x01, 0x0f, 0x2c, 0x00, 0x13, 0x0a,
+0xa2, 0x08, 0x00, 0xa0, 0x08, 0x00, 0x7e, 0x05, 0x00, 0xa0, 0x01, 0x00,
+0xfa, 0x0d, 0x0d, 0x23, 0x00, 0x01, 0x82, 0x00, 0x91, 0x21, 0xc0, 0x22,
+0x60, 0x62, 0x60, 0x62, 0x60, 0x64, 0x02, 0x00, 0x40, 0x28, 0x40, 0x38,
+0x40, 0x36, 0x17, 0x0a, 0x48, 0x15, 0x00, 0x34, 0x01, 0x2f, 0xe3, 0x30,
+0x04, 0x11, 0x13, 0x00, 0x34, 0x01, 0x1f, 0xe6, 0x2c, 0x00, 0x14, 0x00,
+0xec, 0x02, 0x2f, 0xe8, 0xb0, 0x2c, 0x00, 0x13, 0x00, 0x08, 0x01, 0x1f,
+0xe0, 0x84, 0x00, 0x19, 0x03, 0x06, 0x11, 0x0f, 0x04, 0x11, 0x0d, 0x00,
+0x6a, 0x13, 0x17, 0x3f, 0xbe, 0x12, 0x1f, 0x3f, 0x74, 0x14, 0x0b, 0x01,
+0x4c, 0x01, 0x00, 0x02, 0x00, 0x30, 0x31, 0x80, 0x37, 0xaa, 0x09, 0x03,
+0x68, 0x06, 0x3f, 0x31, 0x80, 0x77, 0xa6, 0x16, 0x00, 0x02, 0x82, 0x05,
+0x0f, 0x28, 0x10, 0x0f, 0x04, 0x22, 0x1a, 0x0f, 0x2c, 0x00, 0x11, 0x11,
+0x02, 0x36, 0x01, 0x2f, 0x18, 0xc0, 0x2c, 0x00, 0x11, 0x51, 0x0e, 0x40,
+0x1f, 0xc0, 0x13, 0x1c, 0x01, 0x0f, 0x84, 0x00, 0x11, 0x04, 0x4e, 0x0a,
+0x0f, 0x2c, 0x00, 0x0f, 0x00, 0x82, 0x00, 0x3f, 0x0d, 0x80, 0x07, 0x58,
+0x00, 0x14, 0x04, 0x01, 0x00, 0xff, 0x04, 0x3d, 0xe0, 0x66, 0x30, 0x46,
+0x30, 0x06, 0x30, 0x3f, 0xf0, 0x66, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe7,
+0x30, 0x7d, 0x2c, 0x00, 0x06, 0x0f, 0x04, 0x11, 0x01, 0x0a, 0x80, 0x05,
+0x07, 0x60, 0x01, 0x0f, 0xd8, 0x10, 0x0e, 0x07, 0x60, 0x01, 0x0f, 0x2c,
+0x00, 0x0e, 0x07, 0x60, 0x01, 0x0f, 0x58, 0x00, 0x10, 0x05, 0x34, 0x01,
+0x0f, 0x2c, 0x00, 0x10, 0x02, 0xda, 0x1b, 0x0f, 0xd8, 0x10, 0x13, 0x04,
+0xb0, 0x00, 0x0f, 0x2c, 0x00, 0x0f, 0x04, 0x14, 0x13, 0x0f, 0x58, 0x00,
+0x13, 0x04, 0xb0, 0x00, 0x0f, 0x2c, 0x00, 0x0f, 0x50, 0x1c, 0x00, 0x06,
+0xc0, 0x03, 0x8c, 0x06, 0x01, 0xb2, 0x13, 0x43, 0x0f, 0x60, 0x18, 0xe0,
+0x22, 0x03, 0x3d, 0x60, 0x18, 0xc0, 0xd0, 0x04, 0x03, 0xe8, 0x07, 0x0f,
+0xd8, 0x10, 0x13, 0x06, 0x18, 0x03, 0x0f, 0xd8, 0x10, 0x0f, 0x06, 0x18,
+0x03, 0x0f, 0x2c, 0x00, 0x0d, 0x08, 0x18, 0x03, 0x0f, 0x2c, 0x00, 0x0d,
+0x06, 0xb0, 0x00, 0x0f, 0x84, 0x00, 0x11, 0x06, 0x18, 0x03, 0x0f, 0x88,
+0x11, 0x17, 0x04, 0xd2, 0x0d, 0x04, 0xfe, 0x0b, 0x0f, 0x80, 0x10, 0x08,
+0x30, 0x10, 0x0f, 0xa0, 0x58, 0x00, 0x11, 0x61, 0x84, 0x05, 0x11, 0x68,
+0x58, 0x00, 0x2c, 0x5f, 0x00, 0xb9, 0x01, 0x04, 0x3c, 0x02, 0x0f, 0x04,
+0x11, 0x11, 0x04, 0x34, 0x01, 0x0f, 0x2c, 0x00, 0x0f, 0x06, 0x34, 0x01,
+0x0f, 0x58, 0x00, 0x11, 0x04, 0x08, 0x01, 0x0f, 0x84, 0x00, 0x19, 0x0f,
+0x04, 0x11, 0x19, 0x02, 0xf4, 0x18, 0x05, 0x8c, 0x05, 0x0f, 0x8a, 0x05,
+0x02, 0x04, 0x84, 0x00, 0x0f, 0x58, 0x00, 0x08, 0x50, 0x00, 0x70, 0x00,
+0x00, 0x00,
+};
+
+UINTN FONTDATA_12x22_LZ4_SIZE = sizeof(FONTDATA_12x22_LZ4);
@@ -0,0 +1,490 @@
+/*
+ * BLAKE3
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+#if defined (_M_X64) || defined (_M_AMD64) || defined(__x86_64__)
+#include <immintrin.h>
+#define BLAKE3_AVX2
+#endif
+
+#ifdef __GNUC__
+#define BLAKE3_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define BLAKE3_AVX2_TARGET
+#endif
+
+/*
+ * BLAKE3 hashes 1 KB chunks into a binary tree. Any aligned power of two
+ * run of chunks is a subtree whose chaining value only depends on its
+ * bytes and position, so large updates are cut into 64 KB subtrees that
+ * all processors hash at once, and the BSP folds their chaining values.
+ */
+
+#define BLAKE3_BLOCK_LEN 64
+#define BLAKE3_CHUNK_LEN 1024
+
+#define BLAKE3_CHUNK_START 0x01
+#define BLAKE3_CHUNK_END 0x02
+#define BLAKE3_PARENT 0x04
+#define BLAKE3_ROOT 0x08
+
+/* Chunks per subtree handed to a processor, and the most per round */
+#define BLAKE3_JOB_CHUNKS 64
+#define BLAKE3_ROUND_CHUNKS 65536
+
+#define ROR32(Value, Count) (((Value) >> (Count)) | ((Value) << (32 - (Count))))
+
+UINT32 Blake3Iv[8] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+UINT8 Blake3Permutation[16] = { 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 };
+
+#define BLAKE3_G(V, A, B, C, D, X, Y) do {			\
+	V[A] = V[A] + V[B] + (X); V[D] = ROR32(V[D] ^ V[A], 16);	\
+	V[C] = V[C] + V[D];       V[B] = ROR32(V[B] ^ V[C], 12);	\
+	V[A] = V[A] + V[B] + (Y); V[D] = ROR32(V[D] ^ V[A], 8);	\
+	V[C] = V[C] + V[D];       V[B] = ROR32(V[B] ^ V[C], 7);	\
+} while(0)
+
+VOID boot_blake3_compress(UINT32 *Cv, CONST UINT8 *Block, UINT8 BlockLen, UINT64 Counter, UINT8 Flags, UINT32 *Out)
+{
+	UINT32 M[16], T[16], V[16];
+
+	for(UINTN Index = 0; Index < 16; Index++)
+		M[Index] = Block[4 * Index] | (Block[4 * Index + 1] << 8) | (Block[4 * Index + 2] << 16) | ((UINT32)Block[4 * Index + 3] << 24);
+
+	for(UINTN Index = 0; Index < 8; Index++) {
+		V[Index] = Cv[Index];
+		V[Index + 8] = Blake3Iv[Index];
+	}
+	V[12] = (UINT32)Counter;
+	V[13] = (UINT32)(Counter >> 32);
+	V[14] = BlockLen;
+	V[15] = Flags;
+
+	for(UINTN Round = 0; Round < 7; Round++) {
+		BLAKE3_G(V, 0, 4, 8, 12, M[0], M[1]);
+		BLAKE3_G(V, 1, 5, 9, 13, M[2], M[3]);
+		BLAKE3_G(V, 2, 6, 10, 14, M[4], M[5]);
+		BLAKE3_G(V, 3, 7, 11, 15, M[6], M[7]);
+		BLAKE3_G(V, 0, 5, 10, 15, M[8], M[9]);
+		BLAKE3_G(V, 1, 6, 11, 12, M[10], M[11]);
+		BLAKE3_G(V, 2, 7, 8, 13, M[12], M[13]);
+		BLAKE3_G(V, 3, 4, 9, 14, M[14], M[15]);
+
+		for(UINTN Index = 0; Index < 16; Index++)
+			T[Index] = M[Blake3Permutation[Index]];
+		for(UINTN Index = 0; Index < 16; Index++)
+			M[Index] = T[Index];
+	}
+
+	for(UINTN Index = 0; Index < 8; Index++)
+		Out[Index] = V[Index] ^ V[Index + 8];
+}
+
+VOID boot_blake3_parent(UINT32 *Left, UINT32 *Right, UINT8 Flags, UINT32 *Out)
+{
+	UINT8 Block[BLAKE3_BLOCK_LEN];
+
+	for(UINTN Index = 0; Index < 8; Index++) {
+		UINT32 L = Left[Index], R = Right[Index];
+
+		Block[4 * Index] = (UINT8)L;
+		Block[4 * Index + 1] = (UINT8)(L >> 8);
+		Block[4 * Index + 2] = (UINT8)(L >> 16);
+		Block[4 * Index + 3] = (UINT8)(L >> 24);
+		Block[32 + 4 * Index] = (UINT8)R;
+		Block[32 + 4 * Index + 1] = (UINT8)(R >> 8);
+		Block[32 + 4 * Index + 2] = (UINT8)(R >> 16);
+		Block[32 + 4 * Index + 3] = (UINT8)(R >> 24);
+	}
+
+	boot_blake3_compress(Blake3Iv, Block, BLAKE3_BLOCK_LEN, 0, BLAKE3_PARENT | Flags, Out);
+}
+
+/* Chaining values of Chunks full chunks, one per chunk, starting at chunk number Counter */
+VOID boot_blake3_chunks_generic(CONST UINT8 *Data, UINTN Chunks, UINT64 Counter, UINT32 (*Cvs)[8])
+{
+	for(; Chunks; Chunks--, Data += BLAKE3_CHUNK_LEN, Counter++, Cvs++) {
+		CopyMem(*Cvs, Blake3Iv, sizeof(Blake3Iv));
+		for(UINTN Block = 0; Block < BLAKE3_CHUNK_LEN / BLAKE3_BLOCK_LEN; Block++) {
+			UINT8 Flags = (Block == 0 ? BLAKE3_CHUNK_START : 0) | (Block == BLAKE3_CHUNK_LEN / BLAKE3_BLOCK_LEN - 1 ? BLAKE3_CHUNK_END : 0);
+
+			boot_blake3_compress(*Cvs, Data + Block * BLAKE3_BLOCK_LEN, BLAKE3_BLOCK_LEN, Counter, Flags, *Cvs);
+		}
+	}
+}
+
+#ifdef BLAKE3_AVX2
+/* Rows of eight 32-bit words become columns */
+BLAKE3_AVX2_TARGET
+VOID boot_blake3_transpose_avx2(__m256i *V)
+{
+	__m256i Ab0145 = _mm256_unpacklo_epi32(V[0], V[1]);
+	__m256i Ab2367 = _mm256_unpackhi_epi32(V[0], V[1]);
+	__m256i Cd0145 = _mm256_unpacklo_epi32(V[2], V[3]);
+	__m256i Cd2367 = _mm256_unpackhi_epi32(V[2], V[3]);
+	__m256i Ef0145 = _mm256_unpacklo_epi32(V[4], V[5]);
+	__m256i Ef2367 = _mm256_unpackhi_epi32(V[4], V[5]);
+	__m256i Gh0145 = _mm256_unpacklo_epi32(V[6], V[7]);
+	__m256i Gh2367 = _mm256_unpackhi_epi32(V[6], V[7]);
+	__m256i Abcd04 = _mm256_unpacklo_epi64(Ab0145, Cd0145);
+	__m256i Abcd15 = _mm256_unpackhi_epi64(Ab0145, Cd0145);
+	__m256i Abcd26 = _mm256_unpacklo_epi64(Ab2367, Cd2367);
+	__m256i Abcd37 = _mm256_unpackhi_epi64(Ab2367, Cd2367);
+	__m256i Efgh04 = _mm256_unpacklo_epi64(Ef0145, Gh0145);
+	__m256i Efgh15 = _mm256_unpackhi_epi64(Ef0145, Gh0145);
+	__m256i Efgh26 = _mm256_unpacklo_epi64(Ef2367, Gh2367);
+	__m256i Efgh37 = _mm256_unpackhi_epi64(Ef2367, Gh2367);
+
+	V[0] = _mm256_permute2x128_si256(Abcd04, Efgh04, 0x20);
+	V[1] = _mm256_permute2x128_si256(Abcd15, Efgh15, 0x20);
+	V[2] = _mm256_permute2x128_si256(Abcd26, Efgh26, 0x20);
+	V[3] = _mm256_permute2x128_si256(Abcd37, Efgh37, 0x20);
+	V[4] = _mm256_permute2x128_si256(Abcd04, Efgh04, 0x31);
+	V[5] = _mm256_permute2x128_si256(Abcd15, Efgh15, 0x31);
+	V[6] = _mm256_permute2x128_si256(Abcd26, Efgh26, 0x31);
+	V[7] = _mm256_permute2x128_si256(Abcd37, Efgh37, 0x31);
+}
+
+#define BLAKE3_ROR_AVX2(Value, Count) _mm256_or_si256(_mm256_srli_epi32(Value, Count), _mm256_slli_epi32(Value, 32 - (Count)))
+
+#define BLAKE3_G_AVX2(V, A, B, C, D, X, Y) do {								\
+	V[A] = _mm256_add_epi32(_mm256_add_epi32(V[A], V[B]), X);					\
+	V[D] = _mm256_shuffle_epi8(_mm256_xor_si256(V[D], V[A]), Ror16);				\
+	V[C] = _mm256_add_epi32(V[C], V[D]);								\
+	V[B] = BLAKE3_ROR_AVX2(_mm256_xor_si256(V[B], V[C]), 12);					\
+	V[A] = _mm256_add_epi32(_mm256_add_epi32(V[A], V[B]), Y);					\
+	V[D] = _mm256_shuffle_epi8(_mm256_xor_si256(V[D], V[A]), Ror8);					\
+	V[C] = _mm256_add_epi32(V[C], V[D]);								\
+	V[B] = BLAKE3_ROR_AVX2(_mm256_xor_si256(V[B], V[C]), 7);					\
+} while(0)
+
+/*
+ * Eight chunks at once, lane N of every vector belongs to chunk N. Each
+ * block is loaded as eight rows and transposed so a vector holds the same
+ * message word of all eight chunks. Leftover chunks go the generic way.
+ */
+BLAKE3_AVX2_TARGET
+VOID boot_blake3_chunks_avx2(CONST UINT8 *Data, UINTN Chunks, UINT64 Counter, UINT32 (*Cvs)[8])
+{
+	__m256i Ror16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+					 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+	__m256i Ror8 = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+					1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+	for(; Chunks >= 8; Chunks -= 8, Data += 8 * BLAKE3_CHUNK_LEN, Counter += 8, Cvs += 8) {
+		__m256i H[8], M[16], T[16], V[16];
+		__m256i CounterLow, CounterHigh;
+		UINT32 Low[8], High[8];
+
+		for(UINTN Lane = 0; Lane < 8; Lane++) {
+			Low[Lane] = (UINT32)(Counter + Lane);
+			High[Lane] = (UINT32)((Counter + Lane) >> 32);
+		}
+		CounterLow = _mm256_loadu_si256((__m256i*)Low);
+		CounterHigh = _mm256_loadu_si256((__m256i*)High);
+
+		for(UINTN Index = 0; Index < 8; Index++)
+			H[Index] = _mm256_set1_epi32((INT32)Blake3Iv[Index]);
+
+		for(UINTN Block = 0; Block < BLAKE3_CHUNK_LEN / BLAKE3_BLOCK_LEN; Block++) {
+			UINT8 Flags = (Block == 0 ? BLAKE3_CHUNK_START : 0) | (Block == BLAKE3_CHUNK_LEN / BLAKE3_BLOCK_LEN - 1 ? BLAKE3_CHUNK_END : 0);
+
+			for(UINTN Lane = 0; Lane < 8; Lane++) {
+				CONST UINT8 *Bytes = Data + Lane * BLAKE3_CHUNK_LEN + Block * BLAKE3_BLOCK_LEN;
+
+				M[Lane] = _mm256_loadu_si256((__m256i*)Bytes);
+				M[Lane + 8] = _mm256_loadu_si256((__m256i*)(Bytes + 32));
+			}
+			boot_blake3_transpose_avx2(M);
+			boot_blake3_transpose_avx2(M + 8);
+
+			for(UINTN Index = 0; Index < 8; Index++)
+				V[Index] = H[Index];
+			for(UINTN Index = 0; Index < 4; Index++)
+				V[Index + 8] = _mm256_set1_epi32((INT32)Blake3Iv[Index]);
+			V[12] = CounterLow;
+			V[13] = CounterHigh;
+			V[14] = _mm256_set1_epi32(BLAKE3_BLOCK_LEN);
+			V[15] = _mm256_set1_epi32(Flags);
+
+			for(UINTN Round = 0; Round < 7; Round++) {
+				BLAKE3_G_AVX2(V, 0, 4, 8, 12, M[0], M[1]);
+				BLAKE3_G_AVX2(V, 1, 5, 9, 13, M[2], M[3]);
+				BLAKE3_G_AVX2(V, 2, 6, 10, 14, M[4], M[5]);
+				BLAKE3_G_AVX2(V, 3, 7, 11, 15, M[6], M[7]);
+				BLAKE3_G_AVX2(V, 0, 5, 10, 15, M[8], M[9]);
+				BLAKE3_G_AVX2(V, 1, 6, 11, 12, M[10], M[11]);
+				BLAKE3_G_AVX2(V, 2, 7, 8, 13, M[12], M[13]);
+				BLAKE3_G_AVX2(V, 3, 4, 9, 14, M[14], M[15]);
+
+				for(UINTN Index = 0; Index < 16; Index++)
+					T[Index] = M[Blake3Permutation[Index]];
+				for(UINTN Index = 0; Index < 16; Index++)
+					M[Index] = T[Index];
+			}
+
+			for(UINTN Index = 0; Index < 8; Index++)
+				H[Index] = _mm256_xor_si256(V[Index], V[Index + 8]);
+		}
+
+		boot_blake3_transpose_avx2(H);
+		for(UINTN Lane = 0; Lane < 8; Lane++)
+			_mm256_storeu_si256((__m256i*)Cvs[Lane], H[Lane]);
+	}
+
+	boot_blake3_chunks_generic(Data, Chunks, Counter, Cvs);
+}
+
+/* AVX2 also needs the OS, here the firmware, to have enabled the YMM state */
+BOOLEAN boot_blake3_avx2_supported()
+{
+	UINT32 Ebx, Ecx;
+
+	AsmCpuid(1, NULL, NULL, &Ecx, NULL);
+	if((Ecx & (BIT27 | BIT28)) != (BIT27 | BIT28))
+		return FALSE;
+	if((AsmXGetBv(0) & (BIT1 | BIT2)) != (BIT1 | BIT2))
+		return FALSE;
+	AsmCpuidEx(7, 0, NULL, &Ebx, NULL, NULL);
+	return (Ebx & BIT5) != 0;
+}
+#endif
+
+/*
+ * Chaining value of Chunks full chunks starting at chunk number Counter.
+ * Up to a job the chunks are hashed side by side and folded pairwise.
+ */
+VOID boot_blake3_subtree(BLAKE3_CONTEXT *Context, CONST UINT8 *Data, UINT64 Chunks, UINT64 Counter, UINT32 *Cv)
+{
+	UINT32 Cvs[BLAKE3_JOB_CHUNKS][8];
+
+	if(Chunks > BLAKE3_JOB_CHUNKS) {
+		UINT32 Left[8], Right[8];
+
+		boot_blake3_subtree(Context, Data, Chunks / 2, Counter, Left);
+		boot_blake3_subtree(Context, Data + Chunks / 2 * BLAKE3_CHUNK_LEN, Chunks / 2, Counter + Chunks / 2, Right);
+		boot_blake3_parent(Left, Right, 0, Cv);
+		return;
+	}
+
+	Context->Chunks(Data, (UINTN)Chunks, Counter, Cvs);
+	for(UINTN Width = (UINTN)Chunks; Width > 1; Width /= 2) {
+		for(UINTN Index = 0; Index < Width / 2; Index++)
+			boot_blake3_parent(Cvs[2 * Index], Cvs[2 * Index + 1], 0, Cvs[Index]);
+	}
+
+	CopyMem(Cv, Cvs[0], 32);
+}
+
+typedef struct {
+	BLAKE3_CONTEXT *Context;
+	CONST UINT8 *Data;
+	UINT64 Counter;       /* Chunk number of the first job */
+	UINT32 Jobs;
+	UINT32 (*Cvs)[8];
+	volatile UINT32 Next;
+} BLAKE3_WORK;
+
+VOID EFIAPI boot_blake3_worker(VOID *Argument)
+{
+	BLAKE3_WORK *Work = Argument;
+
+	for(;;) {
+		UINT32 Index = InterlockedIncrement(&Work->Next) - 1;
+
+		if(Index >= Work->Jobs)
+			return;
+
+		boot_blake3_subtree(Work->Context, Work->Data + (UINTN)Index * BLAKE3_JOB_CHUNKS * BLAKE3_CHUNK_LEN, BLAKE3_JOB_CHUNKS,
+				    Work->Counter + (UINT64)Index * BLAKE3_JOB_CHUNKS, Work->Cvs[Index]);
+	}
+}
+
+/*
+ * Subtree chaining value on every processor. The jobs are 64 chunk
+ * subtrees, their chaining values are folded pairwise in place.
+ */
+VOID boot_blake3_subtree_mp(BLAKE3_CONTEXT *Context, CONST UINT8 *Data, UINT64 Chunks, UINT64 Counter, UINT32 *Cv)
+{
+	BLAKE3_WORK Work;
+	EFI_EVENT Done;
+
+	if(Chunks < 2 * BLAKE3_JOB_CHUNKS || boot_mp_processors() < 2 ||
+	   EFI_ERROR(gBS->AllocatePool(EfiLoaderData, Chunks / BLAKE3_JOB_CHUNKS * sizeof(*Work.Cvs), (VOID**)&Work.Cvs))) {
+		boot_blake3_subtree(Context, Data, Chunks, Counter, Cv);
+		return;
+	}
+
+	Work.Context = Context;
+	Work.Data = Data;
+	Work.Counter = Counter;
+	Work.Jobs = (UINT32)(Chunks / BLAKE3_JOB_CHUNKS);
+	Work.Next = 0;
+
+	boot_mp_start(boot_blake3_worker, &Work, &Done);
+	boot_blake3_worker(&Work);
+	boot_mp_wait(Done);
+
+	for(UINTN Width = Work.Jobs; Width > 1; Width /= 2) {
+		for(UINTN Index = 0; Index < Width / 2; Index++)
+			boot_blake3_parent(Work.Cvs[2 * Index], Work.Cvs[2 * Index + 1], 0, Work.Cvs[Index]);
+	}
+
+	CopyMem(Cv, Work.Cvs[0], 32);
+	gBS->FreePool(Work.Cvs);
+}
+
+VOID boot_blake3_init(BLAKE3_CONTEXT *Context)
+{
+	SetMem(Context, sizeof(BLAKE3_CONTEXT), 0);
+	CopyMem(Context->ChunkCv, Blake3Iv, sizeof(Blake3Iv));
+
+	Context->Chunks = boot_blake3_chunks_generic;
+#ifdef BLAKE3_AVX2
+	if(boot_blake3_avx2_supported())
+		Context->Chunks = boot_blake3_chunks_avx2;
+#endif
+}
+
+/* Fold in a finished subtree of 2^Level chunks ending at chunk TotalChunks */
+VOID boot_blake3_push(BLAKE3_CONTEXT *Context, UINT32 *Cv, UINT64 TotalChunks, UINTN Level)
+{
+	UINT32 Merged[8];
+
+	CopyMem(Merged, Cv, sizeof(Merged));
+	for(TotalChunks >>= Level; (TotalChunks & 1) == 0; TotalChunks >>= 1)
+		boot_blake3_parent(Context->Stack[--Context->StackSize], Merged, 0, Merged);
+
+	CopyMem(Context->Stack[Context->StackSize++], Merged, sizeof(Merged));
+}
+
+VOID boot_blake3_chunk_update(BLAKE3_CONTEXT *Context, CONST UINT8 *Data, UINTN Size)
+{
+	while(Size) {
+		UINTN Length;
+
+		/* Keep the last block buffered, it may turn out to end the chunk */
+		if(Context->BlockLen == BLAKE3_BLOCK_LEN) {
+			boot_blake3_compress(Context->ChunkCv, Context->Block, BLAKE3_BLOCK_LEN, Context->Chunk,
+					     Context->BlocksCompressed == 0 ? BLAKE3_CHUNK_START : 0, Context->ChunkCv);
+			Context->BlocksCompressed++;
+			Context->BlockLen = 0;
+		}
+
+		Length = MIN(BLAKE3_BLOCK_LEN - Context->BlockLen, Size);
+		CopyMem(Context->Block + Context->BlockLen, Data, Length);
+		Context->BlockLen += Length;
+		Data += Length;
+		Size -= Length;
+	}
+}
+
+UINTN boot_blake3_chunk_length(BLAKE3_CONTEXT *Context)
+{
+	return Context->BlocksCompressed * BLAKE3_BLOCK_LEN + Context->BlockLen;
+}
+
+VOID boot_blake3_update(BLAKE3_CONTEXT *Context, CONST VOID *Data, UINTN Size)
+{
+	CONST UINT8 *Bytes = Data;
+
+	while(Size) {
+		/* A full chunk is only closed once more input shows it is not the root */
+		if(boot_blake3_chunk_length(Context) == BLAKE3_CHUNK_LEN) {
+			UINT32 Cv[8];
+
+			boot_blake3_compress(Context->ChunkCv, Context->Block, BLAKE3_BLOCK_LEN, Context->Chunk,
+					     BLAKE3_CHUNK_END | (Context->BlocksCompressed == 0 ? BLAKE3_CHUNK_START : 0), Cv);
+			Context->Chunk++;
+			boot_blake3_push(Context, Cv, Context->Chunk, 0);
+
+			CopyMem(Context->ChunkCv, Blake3Iv, sizeof(Blake3Iv));
+			Context->BlocksCompressed = 0;
+			Context->BlockLen = 0;
+		}
+
+		/* Whole aligned subtrees, leaving at least one byte for the last chunk */
+		if(boot_blake3_chunk_length(Context) == 0 && Size > BLAKE3_CHUNK_LEN) {
+			UINT64 Chunks = GetPowerOfTwo64(MIN((Size - 1) / BLAKE3_CHUNK_LEN, BLAKE3_ROUND_CHUNKS));
+			UINT32 Cv[8];
+
+			while(Context->Chunk & (Chunks - 1))
+				Chunks /= 2;
+
+			boot_blake3_subtree_mp(Context, Bytes, Chunks, Context->Chunk, Cv);
+			Context->Chunk += Chunks;
+			boot_blake3_push(Context, Cv, Context->Chunk, (UINTN)HighBitSet64(Chunks));
+
+			Bytes += Chunks * BLAKE3_CHUNK_LEN;
+			Size -= Chunks * BLAKE3_CHUNK_LEN;
+			continue;
+		}
+
+		UINTN Length = MIN(BLAKE3_CHUNK_LEN - boot_blake3_chunk_length(Context), Size);
+
+		boot_blake3_chunk_update(Context, Bytes, Length);
+		Bytes += Length;
+		Size -= Length;
+	}
+}
+
+VOID boot_blake3_final(BLAKE3_CONTEXT *Context, UINT8 *Digest)
+{
+	UINT32 Cv[8];
+	UINT32 Out[8];
+	UINT8 Block[BLAKE3_BLOCK_LEN];
+	UINT8 Flags = BLAKE3_CHUNK_END | (Context->BlocksCompressed == 0 ? BLAKE3_CHUNK_START : 0);
+
+	SetMem(Block, sizeof(Block), 0);
+	CopyMem(Block, Context->Block, Context->BlockLen);
+
+	if(Context->StackSize == 0) {
+		boot_blake3_compress(Context->ChunkCv, Block, (UINT8)Context->BlockLen, Context->Chunk, Flags | BLAKE3_ROOT, Out);
+	} else {
+		/* The chunk in progress is the rightmost leaf, fold the stack onto it */
+		boot_blake3_compress(Context->ChunkCv, Block, (UINT8)Context->BlockLen, Context->Chunk, Flags, Cv);
+		for(UINTN Index = Context->StackSize; Index > 0; Index--)
+			boot_blake3_parent(Context->Stack[Index - 1], Cv, Index == 1 ? BLAKE3_ROOT : 0, Index == 1 ? Out : Cv);
+	}
+
+	for(UINTN Index = 0; Index < 32; Index++)
+		Digest[Index] = (UINT8)(Out[Index / 4] >> (8 * (Index & 3)));
+}
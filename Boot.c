@@ -29,6 +29,8 @@
 #include <Library/PcdLib.h>
 #include <Library/UefiLib.h>
 #include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/PrintLib.h>
 #include <Library/UefiApplicationEntryPoint.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
@@ -39,73 +41,290 @@
 #include "Elf.h"
 #include "Boot.h"
 
-typedef struct {
-	UINTN Pa;             /* Physical address of page range */
-	UINTN Va;             /* Virtual address of page range */
-	UINTN NumberOfPages;  /* Number of pages in range */
-	UINTN AddrOffset;     /* Offset from image base */
-	UINTN ElfPermFlags;   /* Page range permission flags */
-} ELF_SEGMENT_DESCRIPTOR;
-
 EFI_HANDLE BootImageHandle;
 EFI_SYSTEM_TABLE *BootSystemTable;
 
 EFI_STATUS
-boot_load_elf(
-  CHAR16 *FileName,
-  EFI_FILE_PROTOCOL *Volume
+boot_read_elf(
+  BOOT_STREAM *ElfFile,
+  UINT64 Offset,
+  UINTN Size,
+  VOID *Buffer
   )
 {
 	EFI_STATUS Status = EFI_SUCCESS;
-	EFI_FILE *ElfFile;
-	VOID *FileBuffer;
-	UINTN FileSize;
-	ELF_HEADER64 *ElfHeader;
-	ELF_PH64 *ElfProgramHeader;
-
-	return Status;
+	UINTN ReadSize = Size;
 
-	Status = Volume->Open(
-			Volume,
-			&ElfFile,
-			FileName,
-			EFI_FILE_MODE_READ,
-			0);
+	Status = boot_stream_read(ElfFile, Offset, &ReadSize, Buffer);
 	if(EFI_ERROR(Status))
-	{
-		Print(L"Error while opening ELF file: %S, %lx\n", FileName, Status);
 		return Status;
+
+	if(ReadSize != Size) {
+		Print(L"Error while reading ELF file, not all bytes were read, expected: %lx, actually read: %lx\n", Size, ReadSize);
+		return EFI_LOAD_ERROR;
 	}
-	
-	ElfFile->SetPosition(ElfFile, 0xFFFFFFFFFFFFFFFF);
-	ElfFile->GetPosition(ElfFile, &FileSize);
-	ElfFile->SetPosition(ElfFile, 0x0);
-	
-	/* EfiLoaderCode perhaps? */
-	Status = gBS->AllocatePool(EfiLoaderData, FileSize, &FileBuffer);
-	if(EFI_ERROR(Status))
+
+	return Status;
+}
+
+/*
+ * Look for BOOT_NOTE_NAME notes in the PT_NOTE segments, once the PT_LOAD
+ * segments are in place. A note inside one of them is read from the
+ * image, where it was hashed, the others are small enough to be read
+ * whole into a temporary buffer.
+ */
+EFI_STATUS
+boot_read_elf_notes(
+  CHAR16 *FileName,
+  BOOT_STREAM *ElfFile,
+  ELF_PH64 *ElfProgramHeader,
+  UINTN NumberOfHeaders,
+  ELF_PH64 *LoadHeader,
+  UINTN NumberOfLoadHeaders,
+  ELF_IMAGE *Image
+  )
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT8 *NoteBuffer;
+
+	Image->PagingLevels = 0;
+
+	for(UINTN Index = 0; Index < NumberOfHeaders; Index++) {
+		UINTN Size = ElfProgramHeader[Index].FileSz;
+		UINT64 NoteOffset = ElfProgramHeader[Index].Offset;
+		UINTN Offset = 0;
+		BOOLEAN Loaded = FALSE;
+
+		if(ElfProgramHeader[Index].Type != PT_NOTE || Size < sizeof(ELF_NOTE64) || Size > SIZE_64KB)
+			continue;
+
+		for(UINTN Load = 0; Load < NumberOfLoadHeaders && !Loaded; Load++) {
+			if(NoteOffset >= LoadHeader[Load].Offset && NoteOffset - LoadHeader[Load].Offset <= LoadHeader[Load].FileSz &&
+			   Size <= LoadHeader[Load].FileSz - (NoteOffset - LoadHeader[Load].Offset)) {
+				NoteBuffer = (UINT8*)(Image->Pa + (LoadHeader[Load].VAddr - Image->Va) + (NoteOffset - LoadHeader[Load].Offset));
+				Loaded = TRUE;
+			}
+		}
+
+		if(!Loaded) {
+			Status = gBS->AllocatePool(EfiLoaderData, Size, (VOID**)&NoteBuffer);
+			if(EFI_ERROR(Status)) {
+				Print(L"Error while allocating memory: %S, %lx\n", FileName, Status);
+				return Status;
+			}
+
+			Status = boot_read_elf(ElfFile, NoteOffset, Size, NoteBuffer);
+			if(EFI_ERROR(Status)) {
+				Print(L"Error while reading ELF notes: %S, %lx\n", FileName, Status);
+				gBS->FreePool(NoteBuffer);
+				return Status;
+			}
+		}
+
+		while(Offset + sizeof(ELF_NOTE64) <= Size) {
+			ELF_NOTE64 *Note = (ELF_NOTE64*)(NoteBuffer + Offset);
+			UINTN NameSize = ALIGN_VALUE(Note->NameSz, 4);
+			UINTN DescSize = ALIGN_VALUE(Note->DescSz, 4);
+			CHAR8 *Name = (CHAR8*)(Note + 1);
+			UINT8 *Desc = (UINT8*)Name + NameSize;
+
+			if(NameSize > Size || DescSize > Size || Offset + sizeof(ELF_NOTE64) + NameSize + DescSize > Size)
+				break;
+
+			if(Note->NameSz == sizeof(BOOT_NOTE_NAME) && AsciiStrCmp(Name, BOOT_NOTE_NAME) == 0) {
+				if(Note->Type == BOOT_NOTE_PAGING_LEVELS && Note->DescSz == sizeof(UINT32))
+					Image->PagingLevels = *(UINT32*)Desc;
+			}
+
+			Offset += sizeof(ELF_NOTE64) + NameSize + DescSize;
+		}
+
+		if(!Loaded)
+			gBS->FreePool(NoteBuffer);
+	}
+
+	return Status;
+}
+
+/*
+ * Collect the PT_LOAD headers sorted by VAddr and make sure they can share
+ * one allocation: no overlapping ranges and no address overflow.
+ */
+EFI_STATUS
+boot_plan_elf_segments(
+  CHAR16 *FileName,
+  ELF_PH64 *ElfProgramHeader,
+  UINTN NumberOfHeaders,
+  ELF_PH64 **LoadHeaders,
+  UINTN *NumberOfLoadHeaders
+  )
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	ELF_PH64 *Plan;
+	UINTN PlanSize = 0;
+
+	Status = gBS->AllocatePool(EfiLoaderData, NumberOfHeaders * sizeof(ELF_PH64), (VOID**)&Plan);
+	if(EFI_ERROR(Status) || !Plan)
 	{
 		Print(L"Error while allocating memory: %S, %lx\n", FileName, Status);
 		return Status;
 	}
 
-	UINTN FileSizeCopy = FileSize;
+	for(UINTN Index = 0; Index < NumberOfHeaders; Index++) {
+		ELF_PH64 Header = ElfProgramHeader[Index];
 
-	Status = ElfFile->Read(ElfFile, &FileSize, FileBuffer);
-	if(EFI_ERROR(Status))
-	{
-		Print(L"Error while reading ELF file: %S, %lx\n", FileName, Status);
-		return Status;
+		if(Header.Type != PT_LOAD || Header.MemSz == 0)
+			continue;
+
+		if(Header.FileSz > Header.MemSz || Header.VAddr + Header.MemSz < Header.VAddr) {
+			Print(L"Invalid ELF segment size: %S\n", FileName);
+			gBS->FreePool(Plan);
+			return EFI_LOAD_ERROR;
+		}
+
+		/* Program headers are nearly always sorted, insertion sort is enough */
+		UINTN Slot = PlanSize;
+		while(Slot > 0 && Plan[Slot - 1].VAddr > Header.VAddr) {
+			Plan[Slot] = Plan[Slot - 1];
+			Slot--;
+		}
+		Plan[Slot] = Header;
+		PlanSize++;
 	}
 
-	if(FileSize != FileSizeCopy)
-	{
-		Print(L"Error while reading ELF file, not all bytes were read, expected: %lx, actually read: %lx, %S, %lx\n", FileSizeCopy, FileSize, FileName, Status);
+	if(PlanSize == 0) {
+		Print(L"No loadable ELF segments: %S\n", FileName);
+		gBS->FreePool(Plan);
 		return EFI_LOAD_ERROR;
 	}
 
+	for(UINTN Index = 1; Index < PlanSize; Index++) {
+		if(Plan[Index - 1].VAddr + Plan[Index - 1].MemSz > Plan[Index].VAddr) {
+			Print(L"Overlapping ELF segments at %lx: %S\n", Plan[Index].VAddr, FileName);
+			gBS->FreePool(Plan);
+			return EFI_LOAD_ERROR;
+		}
+	}
+
+	*LoadHeaders = Plan;
+	*NumberOfLoadHeaders = PlanSize;
+
+	return Status;
+}
+
+UINTN
+boot_elf_image_alignment(
+  ELF_PH64 *LoadHeader,
+  UINTN NumberOfLoadHeaders
+  )
+{
+	UINTN Alignment = EFI_PAGE_SIZE;
+
+	for(UINTN Index = 0; Index < NumberOfLoadHeaders; Index++) {
+		UINT64 Align = LoadHeader[Index].Align;
+
+		/* Honor power of two p_align up to 1 GB */
+		if(Align > Alignment && Align <= SIZE_1GB && (Align & (Align - 1)) == 0)
+			Alignment = Align;
+
+		if(BootConfig.HugePages) {
+			if(Alignment < SIZE_2MB)
+				Alignment = SIZE_2MB;
+			if(LoadHeader[Index].MemSz >= SIZE_1GB)
+				Alignment = SIZE_1GB;
+		}
+	}
+
+	return Alignment;
+}
 
-	ElfHeader = (ELF_HEADER64*)FileBuffer;
+EFI_STATUS
+boot_allocate_elf_image(
+  CHAR16 *FileName,
+  ELF_HEADER64 *ElfHeader,
+  ELF_PH64 *LoadHeader,
+  UINTN NumberOfLoadHeaders,
+  ELF_IMAGE *Image
+  )
+{
+	EFI_STATUS Status = EFI_NOT_FOUND;
+	UINTN Alignment;
+	UINTN PAddrDelta = LoadHeader[0].PAddr - LoadHeader[0].VAddr;
+	BOOLEAN FixedPAddr = ElfHeader->Type == ET_EXEC;
+
+	/* A single allocation can only honor PAddr when it mirrors the VAddr layout */
+	for(UINTN Index = 1; Index < NumberOfLoadHeaders; Index++) {
+		if(LoadHeader[Index].PAddr - LoadHeader[Index].VAddr != PAddrDelta)
+			FixedPAddr = FALSE;
+	}
+
+	if(FixedPAddr) {
+		Image->Pa = Image->Va + PAddrDelta;
+		Status = gBS->AllocatePages(AllocateAddress, BOOT_MEMORY_TYPE_LOADED, Image->NumberOfPages, (EFI_PHYSICAL_ADDRESS *)&Image->Pa);
+		if(!EFI_ERROR(Status)) {
+			Image->Placement = ELF_PLACED_AT_PADDR;
+			Image->Alignment = EFI_PAGE_SIZE;
+			Print(L"Loading %S at its physical address %lx\n", FileName, Image->Pa);
+			return Status;
+		}
+	}
+
+	/*
+	 * Large pages need Pa and Va to agree modulo the page size, so the
+	 * image base is aligned relative to Va rather than to zero.
+	 */
+	Alignment = boot_elf_image_alignment(LoadHeader, NumberOfLoadHeaders);
+	Image->Alignment = Alignment;
+
+	if(ElfHeader->Type == ET_DYN && BootConfig.Kaslr) {
+		Status = boot_kaslr_allocate_pages(BOOT_MEMORY_TYPE_LOADED, Image->NumberOfPages, Alignment, Image->Va & (Alignment - 1), (EFI_PHYSICAL_ADDRESS *)&Image->Pa);
+		if(!EFI_ERROR(Status)) {
+			Image->Placement = ELF_PLACED_ANYWHERE;
+			Print(L"Loading %S at random physical address %lx\n", FileName, Image->Pa);
+			return Status;
+		}
+	}
+
+	Status = boot_allocate_aligned_pages(BOOT_MEMORY_TYPE_LOADED, Image->NumberOfPages, Alignment, Image->Va & (Alignment - 1), (EFI_PHYSICAL_ADDRESS *)&Image->Pa);
+	if(EFI_ERROR(Status) && Alignment > EFI_PAGE_SIZE) {
+		Print(L"No room for %lx aligned image, loading %S unaligned\n", Alignment, FileName);
+		Image->Alignment = EFI_PAGE_SIZE;
+		Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, Image->NumberOfPages, (EFI_PHYSICAL_ADDRESS *)&Image->Pa);
+	}
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating image memory\n");
+		return Status;
+	}
+
+	Image->Placement = ELF_PLACED_ANYWHERE;
+	if(ElfHeader->Type == ET_EXEC) {
+		Print(L"Physical address %lx unavailable, loading %S at %lx\n", Image->Va + PAddrDelta, FileName, Image->Pa);
+	}
+
+	return Status;
+}
+
+EFI_STATUS
+boot_load_elf_segments(
+  CHAR16 *FileName,
+  BOOT_STREAM *ElfFile,
+  ELF_IMAGE *Image
+  )
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	ELF_HEADER64 ElfHeaderBuffer;
+	ELF_HEADER64 *ElfHeader = &ElfHeaderBuffer;
+	ELF_PH64 *ElfProgramHeader;
+	ELF_PH64 *LoadHeader;
+	UINTN NumberOfLoadHeaders;
+
+	/* Only the headers are read up front, segments go straight to their pages */
+	Status = boot_read_elf(ElfFile, 0, sizeof(ELF_HEADER64), ElfHeader);
+	if(EFI_ERROR(Status))
+	{
+		Print(L"Error while reading ELF file: %S, %lx\n", FileName, Status);
+		return Status;
+	}
 
 	if(ElfHeader->IdentMag[0] != 0x7F ||
 	   ElfHeader->IdentMag[1] != 0x45 ||
@@ -147,54 +366,256 @@ boot_load_elf(
 		return EFI_LOAD_ERROR;
 	}
 
-	ElfProgramHeader = (ELF_PH64*)((UINTN)ElfHeader + ElfHeader->PhOff);
-	
+	if(ElfHeader->EhEntSize != sizeof(ELF_PH64))
+	{
+		Print(L"Unsupported ELF program header size: %S\n", FileName);
+		return EFI_LOAD_ERROR;
+	}
+
+	Status = gBS->AllocatePool(EfiLoaderData, ElfHeader->PhNum * sizeof(ELF_PH64), (VOID**)&ElfProgramHeader);
+	if(EFI_ERROR(Status) || !ElfProgramHeader)
+	{
+		Print(L"Error while allocating memory: %S, %lx\n", FileName, Status);
+		return Status;
+	}
+
+	Status = boot_read_elf(ElfFile, ElfHeader->PhOff, ElfHeader->PhNum * sizeof(ELF_PH64), ElfProgramHeader);
+	if(EFI_ERROR(Status))
+	{
+		Print(L"Error while reading ELF program headers: %S, %lx\n", FileName, Status);
+		gBS->FreePool(ElfProgramHeader);
+		return Status;
+	}
+
+	Image->Relocatable = ElfHeader->Type == ET_DYN;
+	Image->DynamicVa = 0;
+	Image->DynamicSize = 0;
+	for(UINTN Index = 0; Index < ElfHeader->PhNum; Index++) {
+		if(ElfProgramHeader[Index].Type == PT_DYNAMIC) {
+			Image->DynamicVa = ElfProgramHeader[Index].VAddr;
+			Image->DynamicSize = ElfProgramHeader[Index].MemSz;
+		}
+	}
+
+	Status = boot_plan_elf_segments(FileName, ElfProgramHeader, ElfHeader->PhNum, &LoadHeader, &NumberOfLoadHeaders);
+	if(EFI_ERROR(Status)) {
+		gBS->FreePool(ElfProgramHeader);
+		return Status;
+	}
+
 	ELF_SEGMENT_DESCRIPTOR *SegmentArray = NULL;
-	UINTN SegmentArrayUsedSize = 0;
 	
-	Status = gBS->AllocatePool(EfiLoaderData, ElfHeader->PhNum * sizeof(ELF_SEGMENT_DESCRIPTOR), (VOID**)&SegmentArray);
+	Status = gBS->AllocatePool(EfiLoaderData, NumberOfLoadHeaders * sizeof(ELF_SEGMENT_DESCRIPTOR), (VOID**)&SegmentArray);
 	if(EFI_ERROR(Status) || !SegmentArray)
 	{
 		Print(L"Error while allocating memory: %S, %lx\n", FileName, Status);
+		gBS->FreePool(ElfProgramHeader);
+		gBS->FreePool(LoadHeader);
+		return Status;
+	}
+
+	/* One allocation spans the image, segments keep their VAddr distances */
+	UINTN ImageStart = LoadHeader[0].VAddr & ~(UINTN)EFI_PAGE_MASK;
+	UINTN ImageEnd = LoadHeader[NumberOfLoadHeaders - 1].VAddr + LoadHeader[NumberOfLoadHeaders - 1].MemSz;
+
+	Image->Va = ImageStart;
+	Image->NumberOfPages = EFI_SIZE_TO_PAGES(ImageEnd - ImageStart);
+	Image->Entry = ElfHeader->Entry;
+	Image->Segments = SegmentArray;
+	Image->NumberOfSegments = NumberOfLoadHeaders;
+
+	Status = boot_allocate_elf_image(FileName, ElfHeader, LoadHeader, NumberOfLoadHeaders, Image);
+	if(EFI_ERROR(Status)) {
+		gBS->FreePool(ElfProgramHeader);
+		gBS->FreePool(LoadHeader);
+		gBS->FreePool(SegmentArray);
 		return Status;
 	}
 	
-	
-	for(UINTN Index = 0; Index < ElfHeader->PhNum; Index++) {
+	for(UINTN Index = 0; Index < NumberOfLoadHeaders; Index++) {
+		ELF_PH64 *Header = &LoadHeader[Index];
+		ELF_SEGMENT_DESCRIPTOR *Segment = &SegmentArray[Index];
+
 		Print(L"Type: %x, Flags: %x, Offset: %lx, Vaddr: %lx, Paddr: %lx, FileSz: %lu, MemSz: %lu, Align: %lu\n", 
-				ElfProgramHeader[Index].Type,
-				ElfProgramHeader[Index].Flags,
-				ElfProgramHeader[Index].Offset,
-				ElfProgramHeader[Index].VAddr,
-				ElfProgramHeader[Index].PAddr,
-				ElfProgramHeader[Index].FileSz,
-				ElfProgramHeader[Index].MemSz,
-				ElfProgramHeader[Index].Align);
+				Header->Type,
+				Header->Flags,
+				Header->Offset,
+				Header->VAddr,
+				Header->PAddr,
+				Header->FileSz,
+				Header->MemSz,
+				Header->Align);
 				
-		UINTN BytesToWrite = ElfProgramHeader[Index].FileSz;
-		UINTN BytesToZero = ElfProgramHeader[Index].MemSz - ElfProgramHeader[Index].FileSz;
-		UINTN SegmentPages = (ElfProgramHeader[Index].MemSz + 4096 - 1) / 4096;
+		UINTN BytesToRead = Header->FileSz;
+		UINTN BytesToZero = Header->MemSz - Header->FileSz;
+		UINTN Destination = Image->Pa + (Header->VAddr - ImageStart);
+
+		Segment->Va = Header->VAddr & ~(UINTN)EFI_PAGE_MASK;
+		Segment->AddrOffset = Segment->Va - ImageStart;
+		Segment->Pa = Image->Pa + Segment->AddrOffset;
+		Segment->NumberOfPages = EFI_SIZE_TO_PAGES(Header->VAddr + Header->MemSz - Segment->Va);
+		Segment->ElfPermFlags = Header->Flags;
 		
-		Status = gBS->AllocatePages(AllocateAnyPages, EfiLoaderData, SegmentPages, (EFI_PHYSICAL_ADDRESS *)&SegmentArray[SegmentArrayUsedSize].Pa);
+		Status = boot_read_elf(ElfFile, Header->Offset, BytesToRead, (VOID*)Destination);
 		if(EFI_ERROR(Status)) {
-			Print(L"Error while allocating image memory\n");
+			Print(L"Error while reading ELF segment: %S, %lx\n", FileName, Status);
+			gBS->FreePages(Image->Pa, Image->NumberOfPages);
+			gBS->FreePool(ElfProgramHeader);
+			gBS->FreePool(LoadHeader);
+			gBS->FreePool(SegmentArray);
 			return Status;
 		}
-		SegmentArray[SegmentArrayUsedSize].NumberOfPages = SegmentPages;
-		SegmentArray[SegmentArrayUsedSize].AddrOffset = ElfProgramHeader[Index].Offset;
-		SegmentArray[SegmentArrayUsedSize].ElfPermFlags = ElfProgramHeader[Index].Flags;
-		
-		gBS->CopyMem((VOID*)SegmentArray[SegmentArrayUsedSize].Pa, (VOID*)((UINTN)ElfHeader + ElfProgramHeader[Index].Offset), BytesToWrite);
-		gBS->SetMem((VOID*)(SegmentArray[SegmentArrayUsedSize].Pa + BytesToWrite), BytesToZero, 0);
-		
-		SegmentArrayUsedSize++;
+
+		/* Only the bss tail needs clearing */
+		gBS->SetMem((VOID*)(Destination + BytesToRead), BytesToZero, 0);
 	}
 
+	/* Notes in the loaded segments are taken from memory, after the segments are read in file order */
+	Status = boot_read_elf_notes(FileName, ElfFile, ElfProgramHeader, ElfHeader->PhNum, LoadHeader, NumberOfLoadHeaders, Image);
+
+	gBS->FreePool(ElfProgramHeader);
+	gBS->FreePool(LoadHeader);
 
 	return Status;
 }
 
-extern UINT8 FONTDATA_12x22[];
+/*
+ * Pick how FileName is checked. BLAKE3 from Blake3 or <FileName>.b3 is
+ * preferred, it is hashed on all processors. SHA-256 comes from Sha256
+ * or <FileName>.sha256. Either digest may be NULL.
+ */
+EFI_STATUS
+boot_verify_prepare(
+  CHAR16 *FileName,
+  EFI_FILE_PROTOCOL *Volume,
+  BOOT_DIGEST *Blake3,
+  BOOT_DIGEST *Sha256,
+  BOOT_VERIFY *Verify
+  )
+{
+	CHAR16 DigestFileName[256];
+
+	gBS->SetMem(Verify, sizeof(BOOT_VERIFY), 0);
+	Verify->Signed = !IsZeroBuffer(BootPublicKey, sizeof(BootPublicKey));
+	Verify->Hash = BOOT_HASH_BLAKE3;
+
+	if(Blake3)
+		Verify->Expected = *Blake3;
+	if(!Verify->Expected.Present) {
+		UnicodeSPrint(DigestFileName, sizeof(DigestFileName), L"%s.b3", FileName);
+		boot_load_digest(DigestFileName, Volume, &Verify->Expected);
+	}
+	if(!Verify->Expected.Present) {
+		if(Sha256)
+			Verify->Expected = *Sha256;
+		Verify->Hash = BOOT_HASH_SHA256;
+	}
+	if(!Verify->Expected.Present) {
+		UnicodeSPrint(DigestFileName, sizeof(DigestFileName), L"%s.sha256", FileName);
+		boot_load_digest(DigestFileName, Volume, &Verify->Expected);
+	}
+	if(!Verify->Expected.Present)
+		Verify->Hash = Verify->Signed ? BOOT_HASH_SHA256 : BOOT_HASH_NONE;
+
+	/* With a key built in, <FileName>.sig signs the digest and must be there */
+	if(Verify->Signed) {
+		UnicodeSPrint(DigestFileName, sizeof(DigestFileName), L"%s.sig", FileName);
+		if(EFI_ERROR(boot_load_signature(DigestFileName, Volume, Verify->Signature))) {
+			Print(L"No signature, refusing to boot %S\n", FileName);
+			return EFI_SECURITY_VIOLATION;
+		}
+	}
+
+	return EFI_SUCCESS;
+}
+
+/* The digest covers the file as stored, it was taken while reading Stream */
+EFI_STATUS
+boot_verify_finish(
+  CHAR16 *FileName,
+  BOOT_STREAM *Stream,
+  BOOT_VERIFY *Verify
+  )
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT8 Digest[32];
+
+	if(Verify->Hash == BOOT_HASH_NONE)
+		return Status;
+
+	Status = boot_stream_digest(Stream, Digest);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while hashing file: %S, %lx\n", FileName, Status);
+		return Status;
+	}
+
+	if(Verify->Expected.Present && CompareMem(Digest, Verify->Expected.Bytes, sizeof(Digest)) != 0) {
+		Print(L"%s mismatch, refusing to boot %S\n", Verify->Hash == BOOT_HASH_BLAKE3 ? L"BLAKE3" : L"SHA-256", FileName);
+		return EFI_SECURITY_VIOLATION;
+	}
+
+	if(Verify->Signed) {
+#ifdef BOOT_BENCHMARK
+		UINT64 Start = boot_timer_ticks();
+#endif
+		if(!boot_ed25519_verify(BootPublicKey, Digest, sizeof(Digest), Verify->Signature)) {
+			Print(L"Bad signature, refusing to boot %S\n", FileName);
+			Status = EFI_SECURITY_VIOLATION;
+		}
+#ifdef BOOT_BENCHMARK
+		Print(L"%S: Ed25519 verified in %lu us\n", FileName, boot_timer_us(boot_timer_ticks() - Start));
+#endif
+	}
+
+	return Status;
+}
+
+EFI_STATUS
+boot_load_elf(
+  CHAR16 *FileName,
+  EFI_FILE_PROTOCOL *Volume,
+  ELF_IMAGE *Image
+  )
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	BOOT_STREAM ElfFile;
+	BOOT_VERIFY Verify;
+
+	Status = boot_verify_prepare(FileName, Volume, &BootConfig.KernelBlake3, &BootConfig.KernelSha256, &Verify);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	/* An LZ4 or Zstandard compressed ELF is decompressed while it is read */
+	Status = boot_stream_open(FileName, Volume, Verify.Hash, &ElfFile);
+	if(EFI_ERROR(Status))
+	{
+		Print(L"Error while opening ELF file: %S, %lx\n", FileName, Status);
+		return Status;
+	}
+
+	Status = boot_load_elf_segments(FileName, &ElfFile, Image);
+	if(!EFI_ERROR(Status))
+		Status = boot_verify_finish(FileName, &ElfFile, &Verify);
+
+	boot_stream_close(FileName, &ElfFile);
+
+	/*
+	 * Relocations come from PT_DYNAMIC in the image, they are trusted only
+	 * once it is verified. The bias keeps the image alignment as long as
+	 * kernel_base has it.
+	 */
+	if(!EFI_ERROR(Status) && Image->Relocatable)
+		Status = boot_relocate_elf(FileName, Image, Image->DynamicVa, Image->DynamicSize, BootConfig.Kaslr ? boot_kaslr_bias(Image) : BootConfig.KernelBase);
+
+	return Status;
+}
+
+extern UINT8 FONTDATA_12x22_LZ4[];
+extern UINTN FONTDATA_12x22_LZ4_SIZE;
+extern UINT64 FontUnpackTicks;
+
+#define BOOT_FONT_FILE L"font.psf"
+#define BOOT_CONFIG_FILE L"boot.cfg"
 
 /**
   The user Entry Point for Application. The user code starts with this function
@@ -220,19 +641,65 @@ UefiMain (
 	EFI_SIMPLE_FILE_SYSTEM_PROTOCOL *SimpleFileSystem;
 	EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput;
 	EFI_FILE_PROTOCOL *Volume;
-	FONT Gallant;
-	
-	Gallant.Width = 16;
-	Gallant.Height = 22;
-	Gallant.BitmapWidth = 2;
-	Gallant.BitmapHeight = 22;
-	Gallant.NumberOfSymbols = 113 + 95;
-	Gallant.Bitmap = FONTDATA_12x22;
-	Gallant.RenderedFont = NULL;
+	FONT Font;
+	ELF_IMAGE Kernel;
+	PAGE_TABLES KernelTables;
+	BOOT_MEMORY_MAP MemoryMap;
+	BOOT_MEMORY_RANGE *RamRanges;
+	UINTN NumberOfRamRanges;
+	UINTN PagingLevels;
+	BOOT_INFO *BootInfo;
+	BOOT_INFO_MODULE *Modules;
+	BOOT_HANDOFF Handoff;
+	UINT64 LoaderStart = boot_timer_ticks();
 	
 	BootImageHandle = ImageHandle;
 	BootSystemTable = SystemTable;
+
+	boot_timer_init();
 	
+	Status = gBS->HandleProtocol(
+			ImageHandle, 
+			&gEfiLoadedImageProtocolGuid, 
+			(VOID **)&LoadedImage);
+
+	if(EFI_ERROR(Status))
+	{
+		Print(L"Error while locating EFI_LOADED_IMAGE_PROTOCOL: %lx\n", Status);
+		return Status;		
+	}
+
+	Status = gBS->HandleProtocol(
+			LoadedImage->DeviceHandle, 
+			&gEfiSimpleFileSystemProtocolGuid, 
+			(VOID **)&SimpleFileSystem);
+
+	if(EFI_ERROR(Status))
+	{
+		Print(L"Error while locating EFI_SIMPLE_FILE_SYSTEM_PROTOCOL: %lx\n", Status);
+		return Status;
+	}
+
+	Status = SimpleFileSystem->OpenVolume(
+			SimpleFileSystem,
+			&Volume);
+	if(EFI_ERROR(Status))
+	{
+		Print(L"Error while opening boot volume: %lx\n", Status);
+		return Status;
+	}
+
+	Status = boot_load_config(BOOT_CONFIG_FILE, Volume);
+	if(EFI_ERROR(Status) && Status != EFI_NOT_FOUND) {
+		Print(L"Error while loading %S, using defaults: %lx\n", BOOT_CONFIG_FILE, Status);
+	}
+
+	/* The kernel is read past the FAT driver when the boot volume allows */
+	if(BootConfig.DiskIo)
+		boot_fat_init(LoadedImage->DeviceHandle);
+
+	boot_tune_init(LoadedImage->DeviceHandle);
+
 	Status = gBS->LocateProtocol(
 		&gEfiGraphicsOutputProtocolGuid,
 		NULL,
@@ -243,12 +710,32 @@ UefiMain (
 		return Status;		
   	}
 
-	Status = boot_console_init(GraphicsOutput, &Gallant);
+	/* A font on the boot volume overrides the built-in one */
+	Status = boot_load_psf2(BOOT_FONT_FILE, Volume, &Font);
+	if(EFI_ERROR(Status)) {
+		Font.Width = 16;
+		Font.Height = 22;
+		Font.BitmapWidth = 2;
+		Font.BitmapHeight = 22;
+		Font.NumberOfSymbols = 113 + 95;
+		Font.Bitmap = NULL;
+		Font.PackedBitmap = FONTDATA_12x22_LZ4;
+		Font.PackedSize = FONTDATA_12x22_LZ4_SIZE;
+		Font.SymbolMap = NULL;
+	}
+
+	Status = boot_console_init(GraphicsOutput, &Font);
 	if(EFI_ERROR(Status)) {
 		Print(L"Error while initializing boot console: %lx\n", Status);
 		return Status;	
 	}
 	//boot_error(EFI_SUCCESS, "Error: error test\n");
+
+#ifdef BOOT_BENCHMARK
+	boot_print("Boot.efi image size: %lu bytes\n", LoadedImage->ImageSize);
+	if(Font.PackedBitmap)
+		boot_print("Font: %lu bytes packed, unpacked in %lu us\n", Font.PackedSize, boot_timer_us(FontUnpackTicks));
+#endif
   
 	boot_print("Test: %d\n", 50);
 	//boot_print(" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~\nNew line test\n");
@@ -258,41 +745,81 @@ UefiMain (
 		//boot_print("console scroll test :3\n");
 	} 
  
-	Status = gBS->HandleProtocol(
-			ImageHandle, 
-			&gEfiLoadedImageProtocolGuid, 
-			(VOID **)&LoadedImage);
+	Status = boot_load_elf(BootConfig.Kernel, Volume, &Kernel);
+	if(EFI_ERROR(Status)) {
+		Print(L"Loading ELF image %S failed, status: %lx\n", BootConfig.Kernel, Status);
+		return Status;
+	}
 
-	if(EFI_ERROR(Status))
-	{
-		Print(L"Error while locating EFI_LOADED_IMAGE_PROTOCOL: %lx\n", Status);
-		return Status;		
+	/* The kernel comes first in the list of images it is told about */
+	Status = boot_info_create(1 + BootConfig.Manifest.NumberOfEntries, &BootInfo);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating boot information: %lx\n", Status);
+		return Status;
 	}
 
-	Status = gBS->HandleProtocol(
-			LoadedImage->DeviceHandle, 
-			&gEfiSimpleFileSystemProtocolGuid, 
-			(VOID **)&SimpleFileSystem);
+	Modules = (BOOT_INFO_MODULE*)(UINTN)BootInfo->Modules;
+	boot_info_module(&Modules[0], BootConfig.Kernel, BOOT_MODULE_KERNEL, Kernel.Pa, EFI_PAGES_TO_SIZE(Kernel.NumberOfPages));
+
+	Status = boot_load_modules(&BootConfig.Manifest, Volume, Modules + 1);
+	if(EFI_ERROR(Status)) {
+		Print(L"Loading modules failed, status: %lx\n", Status);
+		return Status;
+	}
+
+	/* Nothing is read after the modules, keep what the read size timing got to */
+	boot_tune_save();
+
+	BootInfo->SystemTable = (UINTN)SystemTable;
+	BootInfo->TscFrequency = boot_timer_frequency();
+	BootInfo->LoaderStart = LoaderStart;
+	boot_info_framebuffer(BootInfo, GraphicsOutput);
+
+	Status = boot_get_memory_map(&MemoryMap);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while reading the memory map: %lx\n", Status);
+		return Status;
+	}
 
+	Status = boot_memory_ram_ranges(&MemoryMap, &RamRanges, &NumberOfRamRanges);
+	gBS->FreePool(MemoryMap.Map);
 	if(EFI_ERROR(Status))
-	{
-		Print(L"Error while locating EFI_SIMPLE_FILE_SYSTEM_PROTOCOL: %lx\n", Status);
 		return Status;
+
+	PagingLevels = boot_paging_levels(BootConfig.La57 || Kernel.PagingLevels == 5);
+
+	/* A kernel that asks for 5 levels is laid out for them */
+	if(Kernel.PagingLevels == 5 && PagingLevels != 5) {
+		Print(L"%S needs 5-level paging, refusing to boot\n", BootConfig.Kernel);
+		return EFI_UNSUPPORTED;
 	}
 
-	Status = SimpleFileSystem->OpenVolume(
-			SimpleFileSystem,
-			&Volume);
+	Status = boot_paging_init(
+			&KernelTables,
+			boot_paging_estimate_image(&Kernel, PagingLevels) + boot_paging_estimate_direct(RamRanges, NumberOfRamRanges, PagingLevels) +
+			boot_paging_estimate(LoadedImage->ImageSize, PagingLevels),
+			PagingLevels);
 	if(EFI_ERROR(Status))
-	{
-		Print(L"Error while opening boot volume: %lx\n", Status);
+		return Status;
+
+	Status = boot_paging_map_image(&KernelTables, &Kernel);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while building kernel page tables: %lx\n", Status);
 		return Status;
 	}
 
-	Status = boot_load_elf(L"kernel", Volume);
+	Status = boot_paging_map_direct(&KernelTables, RamRanges, NumberOfRamRanges, BootConfig.DirectMapOffset);
 	if(EFI_ERROR(Status)) {
-		Print(L"Loading ELF image %S failed, status: %lx\n", L"kernel", Status);
+		Print(L"Error while building the direct map: %lx\n", Status);
+		return Status;
 	}
 
+	Status = boot_handoff_prepare(&Handoff, ImageHandle, &KernelTables, Kernel.Entry, BootInfo);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = boot_handoff(&Handoff);
+	Print(L"Error while exiting boot services: %lx\n", Status);
+
 	return Status;
 }
@@ -30,6 +30,13 @@
 #ifndef __BOOT_H__
 #define __BOOT_H__
 
+/* Protocols used by the declarations below, so that Uefi.h is all Boot.h needs first */
+#include <Library/UefiLib.h>
+#include <Protocol/SimpleFileSystem.h>
+#include <Protocol/GraphicsOutput.h>
+
+#include "BootInfo.h"
+
 typedef struct {
 	UINT16 Width;
 	UINT16 Height;
@@ -37,9 +44,358 @@ typedef struct {
 	UINT16 BitmapHeight;
 	UINTN NumberOfSymbols;
 	UINT8 *Bitmap;
-	UINT32 *RenderedFont;
+	UINT8 *PackedBitmap;	/* LZ4 packed Bitmap, unpacked by boot_console_init */
+	UINTN PackedSize;
+	UINT8 *SymbolMap;	/* ASCII to symbol index, NULL for the built-in layout */
 } FONT;
 
+/*
+ * Kernels can ask for loader features with ELF notes owned by "Boot":
+ *
+ *	BOOT_NOTE_PAGING_LEVELS	UINT32 number of paging levels, 4 or 5
+ *
+ *	.section .note.boot, "a"
+ *	.long 5, 4, BOOT_NOTE_PAGING_LEVELS
+ *	.asciz "Boot"
+ *	.balign 4
+ *	.long 5
+ */
+#define BOOT_NOTE_NAME "Boot"
+#define BOOT_NOTE_PAGING_LEVELS 0x1
+
+typedef struct {
+	UINTN Pa;             /* Physical address of page range */
+	UINTN Va;             /* Virtual address of page range */
+	UINTN NumberOfPages;  /* Number of pages in range */
+	UINTN AddrOffset;     /* Offset from image base */
+	UINTN ElfPermFlags;   /* Page range permission flags */
+} ELF_SEGMENT_DESCRIPTOR;
+
+/*
+ * How the image allocation was placed:
+ *
+ *	ELF_PLACED_AT_PADDR	Segments sit at their linked PAddr
+ *	ELF_PLACED_ANYWHERE	PAddr was unavailable or not used, the image
+ *				keeps its VAddr layout at whatever Pa the
+ *				firmware returned. Only the physical base
+ *				moves, so the kernel keeps running at its
+ *				linked virtual addresses as long as its page
+ *				tables map Va to Pa instead of PAddr.
+ */
+#define ELF_PLACED_AT_PADDR 0x1
+#define ELF_PLACED_ANYWHERE 0x2
+
+typedef struct {
+	UINTN Pa;             /* Physical address of the image allocation */
+	UINTN Va;             /* Virtual address of the lowest segment page */
+	UINTN NumberOfPages;  /* Pages spanning all segments */
+	UINTN Entry;          /* Virtual entry point */
+	UINTN Placement;      /* ELF_PLACED_* */
+	UINTN Alignment;      /* Pa and Va agree modulo this */
+	UINTN PagingLevels;   /* Levels asked for by a BOOT_NOTE_PAGING_LEVELS note, 0 if none */
+	ELF_SEGMENT_DESCRIPTOR *Segments;
+	UINTN NumberOfSegments;
+	BOOLEAN Relocatable;  /* ET_DYN, relocated once it is verified */
+	UINT64 DynamicVa;     /* PT_DYNAMIC, 0 if none */
+	UINTN DynamicSize;
+} ELF_IMAGE;
+
+typedef struct {
+	UINT64 *Root;         /* PML4, or PML5 with 5 levels */
+	UINTN Levels;         /* 4, or 5 for LA57 */
+	UINTN Pool;           /* Physical address of the table page pool */
+	UINTN PoolPages;      /* Pages in the pool */
+	UINTN UsedPages;      /* Pages handed out from the pool */
+	UINT64 NxBit;         /* Execute disable bit, 0 when unsupported */
+	BOOLEAN Gigabyte;     /* 1 GB leaf entries are supported */
+} PAGE_TABLES;
+
+typedef struct {
+	EFI_MEMORY_DESCRIPTOR *Map;
+	UINTN BufferSize;     /* Allocated size of Map */
+	UINTN MapSize;        /* Bytes of Map filled in by the firmware */
+	UINTN MapKey;
+	UINTN DescriptorSize;
+	UINT32 DescriptorVersion;
+} BOOT_MEMORY_MAP;
+
+typedef struct {
+	UINT64 Start;
+	UINT64 End;
+} BOOT_MEMORY_RANGE;
+
+/* Allocations that are handed to the kernel rather than used by the loader */
+#define BOOT_MEMORY_TYPE_LOADED ((EFI_MEMORY_TYPE)BOOT_EFI_MEMORY_LOADED)
+
+/* Everything the exit from the firmware needs, gathered while it can still allocate */
+typedef struct {
+	EFI_HANDLE ImageHandle;
+	PAGE_TABLES *Tables;
+	BOOT_INFO *BootInfo;
+	UINT64 Entry;         /* Kernel entry point */
+	UINT64 Stack;         /* Top of the kernel stack in the direct map */
+	BOOT_MEMORY_MAP MemoryMap; /* Buffer for the map with room to spare */
+	BOOT_INFO_MEMORY *Memory; /* Room for a range per descriptor of MemoryMap */
+	UINT8 *Trampoline;    /* Below 4 GB, switches the firmware from 4 to 5 levels, NULL if not needed */
+} BOOT_HANDOFF;
+
+typedef struct {
+	UINT32 State[8];
+	UINT64 Length;        /* Bytes hashed */
+	UINT8 Buffer[64];     /* Partial block */
+	UINTN Fill;
+	VOID (*Blocks)(UINT32 *State, CONST UINT8 *Data, UINTN Blocks);
+} SHA256_CONTEXT;
+
+typedef struct {
+	UINT32 ChunkCv[8];    /* Chaining value of the chunk in progress */
+	UINT64 Chunk;         /* Number of the chunk in progress */
+	UINT8 Block[64];      /* Last block of the chunk, not compressed yet */
+	UINTN BlockLen;
+	UINTN BlocksCompressed;
+	UINT32 Stack[54][8];  /* Chaining values of finished subtrees */
+	UINTN StackSize;
+	VOID (*Chunks)(CONST UINT8 *Data, UINTN Chunks, UINT64 Counter, UINT32 (*Cvs)[8]);
+} BLAKE3_CONTEXT;
+
+typedef struct {
+	BOOLEAN Present;
+	UINT8 Bytes[32];
+} BOOT_DIGEST;
+
+typedef struct {
+	UINT64 State[8];
+	UINT64 Length;        /* Bytes hashed */
+	UINT8 Buffer[128];    /* Partial block */
+	UINTN Fill;
+} SHA512_CONTEXT;
+
+#define BOOT_HASH_NONE   0x0
+#define BOOT_HASH_SHA256 0x1
+#define BOOT_HASH_BLAKE3 0x2
+
+/* Same as EFI_AP_PROCEDURE, without pulling the MP services header in */
+typedef VOID (EFIAPI *BOOT_AP_PROCEDURE)(VOID *Argument);
+
+typedef struct {
+	UINT64 Offset;        /* File offset of the frame */
+	UINT64 Start;         /* Decompressed offset of the frame */
+	UINT32 CompressedSize;
+	UINT32 Size;
+} BOOT_STREAM_FRAME;
+
+typedef struct {
+	UINT64 Start;         /* File offset of the run */
+	UINT64 Disk;          /* Partition offset of the run */
+	UINT64 Size;
+} BOOT_EXTENT;
+
+/* Where the bytes of a file on the boot FAT volume are */
+typedef struct {
+	UINT64 Size;
+	BOOT_EXTENT *Extents;
+	UINTN NumberOfExtents;
+} BOOT_FAT_FILE;
+
+/* Reads kept in flight by boot_stream_file_read_ahead */
+#define BOOT_STREAM_DEPTH 4
+
+typedef struct {
+	EFI_FILE_IO_TOKEN Token;
+	UINT64 Position;      /* File offset the read was issued at */
+	UINTN Size;           /* Bytes asked for */
+	UINTN Chunk;          /* Read size it was issued with */
+	BOOLEAN Busy;         /* Issued and not handled yet */
+	BOOLEAN Done;         /* Already waited for */
+} BOOT_STREAM_READ;
+
+/*
+ * A file read at arbitrary offsets. When the file is an LZ4 frame the
+ * offsets refer to the decompressed contents: blocks are decoded in file
+ * order while the next one is already being read, and reading behind the
+ * current block restarts the frame. A file of several frames with a seek
+ * table is read frame by frame instead, whole frames are decompressed on
+ * all processors while the BSP reads the ones after them. Zstandard files
+ * are always read that way, without a seek table as a single frame.
+ */
+typedef struct {
+	EFI_FILE_PROTOCOL *File;
+	BOOT_FAT_FILE Disk;   /* Read from the disk directly while it has extents */
+	BOOLEAN Compressed;
+
+	/* LZ4 frame */
+	UINTN BlockMax;       /* Largest decompressed block */
+	BOOLEAN Linked;       /* Blocks refer back to the previous 64 KB */
+	BOOLEAN BlockChecksum;/* Each block is followed by a checksum */
+	UINT64 FrameStart;    /* File offset of the first block data */
+	UINT32 FirstBlockSize;
+	UINT32 NextBlockSize; /* Header of the next block, 0 at the end mark */
+	UINT8 *Input[2];      /* Compressed block double buffer */
+	UINTN InputIndex;     /* Buffer the next block is read into */
+	EFI_FILE_IO_TOKEN Token;
+	BOOLEAN Async;        /* ReadEx is usable */
+	BOOLEAN Pending;      /* A ReadEx into Input[InputIndex] is in flight */
+	UINT8 *Window;        /* History followed by the decoded block */
+	UINTN History;        /* Valid history bytes before the block */
+	UINT8 *Block;         /* Decoded block, NULL if it went to the caller */
+	UINT64 BlockStart;    /* Decompressed offsets of the current block */
+	UINT64 BlockEnd;
+
+	/* Multi-frame image */
+	BOOLEAN Zstd;         /* Zstandard frames rather than LZ4 */
+	UINT8 *Workspace;     /* Zstandard decoder state for each processor */
+	BOOT_STREAM_FRAME *Frames;
+	UINTN NumberOfFrames;
+	UINT64 Size;          /* Decompressed size of all frames, or of a single frame that gives it */
+	UINT8 *FrameCache;    /* Frame decoded for reads of part of it */
+	UINTN CachedFrame;
+
+	/* Hash of the file as stored, taken from the buffers it is read into */
+	UINTN Hashing;        /* BOOT_HASH_* */
+	UINTN HashChunk;      /* Piece of a raw read hashed at once */
+	SHA256_CONTEXT Sha256;
+	BLAKE3_CONTEXT Blake3;
+	UINT64 HashPosition;  /* File bytes hashed so far */
+	UINT8 *Head;          /* Start of the file as hashed, reads going back come from here */
+	UINT8 *Tail;          /* End of the file, read before the hash got there */
+	UINT64 TailPosition;
+	UINTN TailSize;
+	UINT64 FilePosition;
+	UINT64 PendingPosition; /* File offset of the ReadEx in flight */
+
+	/* Raw pieces read ahead of the one being checked */
+	BOOT_STREAM_READ Reads[BOOT_STREAM_DEPTH];
+	UINTN InFlight;
+	BOOLEAN ReadsReady;   /* Token events are created */
+
+	/* CRC32C of each chunk of the file as stored, from <file>.crc */
+	UINT32 *Crcs;
+	UINTN NumberOfCrcs;
+	UINT32 CrcChunk;
+	UINT64 CrcFileSize;
+	UINT32 Crc;           /* Of the current chunk up to HashPosition */
+
+	/* Stage statistics */
+	UINT64 ReadBytes;
+	UINT64 ReadTicks;     /* Time spent waiting for the medium */
+	UINT64 DecodeBytes;
+	UINT64 DecodeTicks;
+	UINT64 HashTicks;
+	UINT64 CrcTicks;
+} BOOT_STREAM;
+
+#define BOOT_PATH_MAX 128
+#define BOOT_MANIFEST_MAX 16
+
+typedef struct {
+	CHAR16 FileName[BOOT_PATH_MAX];
+	UINT32 Type;          /* BOOT_MODULE_INITRD or BOOT_MODULE_OTHER */
+} BOOT_MANIFEST_ENTRY;
+
+/* Files loaded along with the kernel, in the order boot.cfg names them */
+typedef struct {
+	BOOT_MANIFEST_ENTRY Entries[BOOT_MANIFEST_MAX];
+	UINTN NumberOfEntries;
+} BOOT_MANIFEST;
+
+/* How a file is checked while it is read */
+typedef struct {
+	UINTN Hash;           /* BOOT_HASH_* */
+	BOOT_DIGEST Expected; /* Not present when only the signature is checked */
+	BOOLEAN Signed;       /* The built-in key has to sign the digest */
+	UINT8 Signature[64];
+} BOOT_VERIFY;
+
+typedef struct {
+	BOOLEAN HugePages;	/* Align the kernel for 2 MB and 1 GB mappings */
+	UINT64 DirectMapOffset;	/* Virtual address of physical address 0 */
+	BOOLEAN La57;		/* Build 5-level page tables when supported */
+	UINT64 KernelBase;	/* Load bias for a position independent kernel */
+	BOOLEAN Kaslr;		/* Randomize where a position independent kernel goes */
+	UINT64 KaslrWindow;	/* Bytes above KernelBase the kernel may be moved in */
+	BOOT_DIGEST KernelSha256; /* Expected SHA-256 of the kernel file */
+	BOOT_DIGEST KernelBlake3; /* Expected BLAKE3 of the kernel file */
+	BOOLEAN DiskIo;		/* Read the kernel from the disk past the FAT driver */
+	CHAR16 Kernel[BOOT_PATH_MAX]; /* Kernel file on the boot volume */
+	BOOT_MANIFEST Manifest;	/* initrd= and module= files */
+	UINT64 ReadChunk;	/* Bytes per read in flight, 0 to learn it */
+} BOOT_CONFIG;
+
+extern BOOT_CONFIG BootConfig;
+extern UINT8 BootPublicKey[32];
+
+VOID boot_timer_init();
+UINT64 boot_timer_ticks();
+UINT64 boot_timer_frequency();
+UINT64 boot_timer_us(UINT64 Ticks);
+EFI_STATUS boot_lz4_decompress(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, UINTN *DecompressedSize);
+EFI_STATUS boot_lz4_decompress_prefix(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, UINTN Prefix, UINTN *DecompressedSize);
+UINT32 boot_lz4_le32(UINT8 *Bytes);
+EFI_STATUS boot_lz4_frame_decompress(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, UINTN *DecompressedSize);
+EFI_STATUS boot_zstd_frame_header(UINT8 *Source, UINTN SourceSize, UINTN *HeaderSize, UINT64 *ContentSize);
+EFI_STATUS boot_zstd_frame_decompress(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, VOID *Workspace, UINTN *DecompressedSize);
+UINTN boot_mp_processors();
+EFI_STATUS boot_mp_start(BOOT_AP_PROCEDURE Procedure, VOID *Argument, EFI_EVENT *Done);
+VOID boot_mp_wait(EFI_EVENT Done);
+VOID boot_sha256_init(SHA256_CONTEXT *Context);
+VOID boot_sha256_update(SHA256_CONTEXT *Context, CONST VOID *Data, UINTN Size);
+VOID boot_sha256_final(SHA256_CONTEXT *Context, UINT8 *Digest);
+VOID boot_blake3_init(BLAKE3_CONTEXT *Context);
+VOID boot_blake3_update(BLAKE3_CONTEXT *Context, CONST VOID *Data, UINTN Size);
+VOID boot_blake3_final(BLAKE3_CONTEXT *Context, UINT8 *Digest);
+UINT32 boot_crc32c(UINT32 Crc, CONST VOID *Data, UINTN Size);
+VOID boot_sha512_init(SHA512_CONTEXT *Context);
+VOID boot_sha512_update(SHA512_CONTEXT *Context, CONST VOID *Data, UINTN Size);
+VOID boot_sha512_final(SHA512_CONTEXT *Context, UINT8 *Digest);
+BOOLEAN boot_ed25519_verify(CONST UINT8 *PublicKey, CONST VOID *Message, UINTN MessageSize, CONST UINT8 *Signature);
+EFI_STATUS boot_fat_init(EFI_HANDLE Device);
+BOOLEAN boot_fat_async();
+UINTN boot_fat_alignment();
+EFI_STATUS boot_fat_open(CHAR16 *FileName, BOOT_FAT_FILE *File);
+EFI_STATUS boot_fat_read(BOOT_FAT_FILE *File, UINT64 Position, UINTN *Size, VOID *Buffer);
+EFI_STATUS boot_fat_read_ex(BOOT_FAT_FILE *File, UINT64 Position, EFI_FILE_IO_TOKEN *Token);
+VOID boot_fat_close(BOOT_FAT_FILE *File);
+EFI_STATUS boot_stream_open(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, UINTN Hash, BOOT_STREAM *Stream);
+EFI_STATUS boot_stream_read(BOOT_STREAM *Stream, UINT64 Offset, UINTN *Size, VOID *Buffer);
+EFI_STATUS boot_stream_digest(BOOT_STREAM *Stream, UINT8 *Digest);
+EFI_STATUS boot_stream_size(BOOT_STREAM *Stream, UINT64 *Size);
+UINT64 boot_stream_disk_offset(BOOT_STREAM *Stream);
+VOID boot_stream_close(CHAR16 *FileName, BOOT_STREAM *Stream);
+VOID boot_tune_init(EFI_HANDLE Device);
+UINTN boot_tune_chunk();
+VOID boot_tune_run(UINTN Chunk, UINTN Length, UINT64 Ticks);
+VOID boot_tune_save();
+EFI_STATUS boot_load_psf2(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, FONT *Font);
+EFI_STATUS boot_load_config(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume);
+EFI_STATUS boot_load_digest(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, BOOT_DIGEST *Digest);
+EFI_STATUS boot_load_signature(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, UINT8 *Signature);
+EFI_STATUS boot_verify_prepare(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, BOOT_DIGEST *Blake3, BOOT_DIGEST *Sha256, BOOT_VERIFY *Verify);
+EFI_STATUS boot_verify_finish(CHAR16 *FileName, BOOT_STREAM *Stream, BOOT_VERIFY *Verify);
+EFI_STATUS boot_load_modules(BOOT_MANIFEST *Manifest, EFI_FILE_PROTOCOL *Volume, BOOT_INFO_MODULE *Modules);
+EFI_STATUS boot_info_create(UINTN NumberOfModules, BOOT_INFO **BootInfo);
+VOID boot_info_module(BOOT_INFO_MODULE *Module, CHAR16 *FileName, UINT32 Type, UINT64 Pa, UINT64 Size);
+VOID boot_info_framebuffer(BOOT_INFO *BootInfo, EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput);
+EFI_STATUS boot_handoff_prepare(BOOT_HANDOFF *Handoff, EFI_HANDLE ImageHandle, PAGE_TABLES *Tables, UINT64 Entry, BOOT_INFO *BootInfo);
+EFI_STATUS boot_handoff(BOOT_HANDOFF *Handoff);
+EFI_STATUS boot_allocate_aligned_pages(EFI_MEMORY_TYPE MemoryType, UINTN Pages, UINTN Alignment, UINTN Offset, EFI_PHYSICAL_ADDRESS *Address);
+UINTN boot_paging_estimate(UINT64 Size, UINTN Levels);
+UINTN boot_paging_estimate_image(ELF_IMAGE *Image, UINTN Levels);
+EFI_STATUS boot_get_memory_map(BOOT_MEMORY_MAP *MemoryMap);
+EFI_STATUS boot_memory_ram_ranges(BOOT_MEMORY_MAP *MemoryMap, BOOT_MEMORY_RANGE **Ranges, UINTN *NumberOfRanges);
+UINTN boot_memory_compact(BOOT_MEMORY_MAP *MemoryMap, BOOT_INFO_MEMORY *Ranges);
+BOOLEAN boot_paging_gigabyte();
+UINTN boot_paging_estimate_direct(BOOT_MEMORY_RANGE *Ranges, UINTN NumberOfRanges, UINTN Levels);
+UINTN boot_paging_levels(BOOLEAN Requested);
+BOOLEAN boot_paging_la57_active();
+BOOLEAN boot_paging_canonical(UINTN Levels, UINT64 Va);
+EFI_STATUS boot_paging_init(PAGE_TABLES *Tables, UINTN PoolPages, UINTN Levels);
+EFI_STATUS boot_paging_map(PAGE_TABLES *Tables, UINT64 Va, UINT64 Pa, UINT64 Size, UINTN ElfPermFlags);
+EFI_STATUS boot_paging_map_image(PAGE_TABLES *Tables, ELF_IMAGE *Image);
+EFI_STATUS boot_paging_map_direct(PAGE_TABLES *Tables, BOOT_MEMORY_RANGE *Ranges, UINTN NumberOfRanges, UINT64 Offset);
+UINT64 boot_random();
+EFI_STATUS boot_kaslr_allocate_pages(EFI_MEMORY_TYPE MemoryType, UINTN Pages, UINTN Alignment, UINTN Offset, EFI_PHYSICAL_ADDRESS *Address);
+UINT64 boot_kaslr_bias(ELF_IMAGE *Image);
+EFI_STATUS boot_relocate_elf(CHAR16 *FileName, ELF_IMAGE *Image, UINT64 DynamicVAddr, UINTN DynamicSize, UINT64 Bias);
 EFI_STATUS boot_console_init(EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput, FONT *Font);
 VOID boot_print(CHAR8 *Format, ...);
 VOID boot_error(EFI_STATUS Status, CHAR8 *Msg, ...);
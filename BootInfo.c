@@ -0,0 +1,99 @@
+/*
+ * Boot information for the kernel
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+/*
+ * Allocate a BOOT_INFO followed by room for NumberOfModules, in pages
+ * the kernel finds it in after the firmware is gone.
+ */
+EFI_STATUS boot_info_create(UINTN NumberOfModules, BOOT_INFO **BootInfo)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Size = sizeof(BOOT_INFO) + NumberOfModules * sizeof(BOOT_INFO_MODULE);
+	EFI_PHYSICAL_ADDRESS Address;
+	BOOT_INFO *Info;
+
+	Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, EFI_SIZE_TO_PAGES(Size), &Address);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Info = (BOOT_INFO*)(UINTN)Address;
+	gBS->SetMem(Info, Size, 0);
+
+	Info->Magic = BOOT_INFO_MAGIC;
+	Info->Version = BOOT_INFO_VERSION;
+	Info->Size = sizeof(BOOT_INFO);
+	Info->Modules = Address + sizeof(BOOT_INFO);
+	Info->NumberOfModules = NumberOfModules;
+
+	*BootInfo = Info;
+
+	return Status;
+}
+
+VOID boot_info_module(BOOT_INFO_MODULE *Module, CHAR16 *FileName, UINT32 Type, UINT64 Pa, UINT64 Size)
+{
+	UINTN Length;
+
+	Module->Pa = Pa;
+	Module->Size = Size;
+	Module->Type = Type;
+
+	/* Paths come from boot.cfg as ASCII, longer ones are cut short */
+	for(Length = 0; FileName[Length] && Length < BOOT_MODULE_NAME_MAX - 1; Length++)
+		Module->Name[Length] = (CHAR8)FileName[Length];
+	Module->Name[Length] = '\0';
+}
+
+VOID boot_info_framebuffer(BOOT_INFO *BootInfo, EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput)
+{
+	EFI_GRAPHICS_OUTPUT_MODE_INFORMATION *Info = GraphicsOutput->Mode->Info;
+	BOOT_INFO_FRAMEBUFFER *Framebuffer = &BootInfo->Framebuffer;
+
+	if(Info->PixelFormat != PixelBltOnly) {
+		Framebuffer->Base = GraphicsOutput->Mode->FrameBufferBase;
+		Framebuffer->Size = GraphicsOutput->Mode->FrameBufferSize;
+	}
+
+	Framebuffer->Width = Info->HorizontalResolution;
+	Framebuffer->Height = Info->VerticalResolution;
+	Framebuffer->PixelsPerScanLine = Info->PixelsPerScanLine;
+	Framebuffer->PixelFormat = Info->PixelFormat;
+	Framebuffer->RedMask = Info->PixelInformation.RedMask;
+	Framebuffer->GreenMask = Info->PixelInformation.GreenMask;
+	Framebuffer->BlueMask = Info->PixelInformation.BlueMask;
+	Framebuffer->ReservedMask = Info->PixelInformation.ReservedMask;
+}
@@ -0,0 +1,150 @@
+/*
+ * Boot information handed to the kernel
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __BOOT_INFO_H__
+#define __BOOT_INFO_H__
+
+/*
+ * The loader leaves one BOOT_INFO in BOOT_EFI_MEMORY_LOADED pages for the kernel.
+ * Addresses in it are physical. Fields are only ever added at the end,
+ * Size tells a kernel how many of them the loader knew about.
+ *
+ * The kernel is entered at its ELF entry point with boot services gone
+ * and interrupts disabled, on the page tables the loader built and a
+ * 64 KB stack of its own. RDI holds the address of BOOT_INFO in the
+ * direct map. The GDT and IDT are still the firmware's, and so is the
+ * memory they are in, the kernel loads its own before anything else.
+ */
+#define BOOT_INFO_MAGIC   0x4F464E49544F4F42 /* "BOOTINFO" */
+#define BOOT_INFO_VERSION 1
+
+/*
+ * Every image loaded from the boot volume, the kernel first:
+ *
+ *	BOOT_MODULE_KERNEL	The ELF image, Size covers all of its pages
+ *	BOOT_MODULE_INITRD	An initrd= file from boot.cfg
+ *	BOOT_MODULE_OTHER	A module= file from boot.cfg
+ */
+#define BOOT_MODULE_KERNEL 0x1
+#define BOOT_MODULE_INITRD 0x2
+#define BOOT_MODULE_OTHER  0x3
+
+#define BOOT_MODULE_NAME_MAX 64
+
+/*
+ * Memory type, from the range the UEFI spec leaves to OS loaders, of
+ * everything the kernel is handed: its image, the modules, BOOT_INFO, the
+ * page tables, the stack and both memory maps. The raw map shows it.
+ */
+#define BOOT_EFI_MEMORY_LOADED 0x80000000
+
+/*
+ * Kinds of memory in the BOOT_INFO_MEMORY ranges:
+ *
+ *	BOOT_MEMORY_USABLE		Free
+ *	BOOT_MEMORY_RECLAIMABLE	Boot services and the loader's own memory,
+ *				free once the kernel has its own GDT and IDT
+ *	BOOT_MEMORY_LOADED		Handed to the kernel, see BOOT_EFI_MEMORY_LOADED
+ *	BOOT_MEMORY_ACPI_RECLAIMABLE	Free once the ACPI tables are read
+ *	BOOT_MEMORY_ACPI_NVS
+ *	BOOT_MEMORY_RUNTIME		Runtime services, keep it mapped to call them
+ *	BOOT_MEMORY_PERSISTENT
+ *	BOOT_MEMORY_RESERVED		Anything else, MMIO included
+ */
+#define BOOT_MEMORY_USABLE           0x1
+#define BOOT_MEMORY_RECLAIMABLE      0x2
+#define BOOT_MEMORY_LOADED           0x3
+#define BOOT_MEMORY_ACPI_RECLAIMABLE 0x4
+#define BOOT_MEMORY_ACPI_NVS         0x5
+#define BOOT_MEMORY_RUNTIME          0x6
+#define BOOT_MEMORY_PERSISTENT       0x7
+#define BOOT_MEMORY_RESERVED         0x8
+
+typedef struct {
+	UINT64 Pa;            /* Page aligned, the last page is zero past Size */
+	UINT64 Size;
+	UINT32 Type;          /* BOOT_MODULE_* */
+	UINT32 Reserved;
+	CHAR8 Name[BOOT_MODULE_NAME_MAX]; /* Path on the boot volume, NUL terminated */
+} BOOT_INFO_MODULE;
+
+typedef struct {
+	UINT64 Base;          /* 0 when the display can only be drawn with Blt */
+	UINT64 Size;
+	UINT32 Width;
+	UINT32 Height;
+	UINT32 PixelsPerScanLine;
+	UINT32 PixelFormat;   /* EFI_GRAPHICS_PIXEL_FORMAT */
+	UINT32 RedMask;       /* Masks only for PixelBitMask */
+	UINT32 GreenMask;
+	UINT32 BlueMask;
+	UINT32 ReservedMask;
+} BOOT_INFO_FRAMEBUFFER;
+
+typedef struct {
+	UINT64 Pa;            /* Page aligned */
+	UINT64 Size;
+	UINT32 Type;          /* BOOT_MEMORY_* */
+	UINT32 Reserved;
+} BOOT_INFO_MEMORY;
+
+typedef struct {
+	UINT64 Magic;         /* BOOT_INFO_MAGIC */
+	UINT32 Version;       /* BOOT_INFO_VERSION */
+	UINT32 Size;          /* Bytes of BOOT_INFO filled in */
+	UINT64 Modules;       /* BOOT_INFO_MODULE array */
+	UINT64 NumberOfModules;
+
+	UINT64 DirectMapOffset; /* Virtual address of physical address 0 */
+	UINT64 SystemTable;   /* Only its runtime services are left */
+
+	/* Map ExitBootServices was called with, descriptors DescriptorSize apart */
+	UINT64 MemoryMap;
+	UINT64 MemoryMapSize;
+	UINT64 MemoryMapDescriptorSize;
+	UINT32 MemoryMapDescriptorVersion;
+	UINT32 Reserved;
+
+	BOOT_INFO_FRAMEBUFFER Framebuffer; /* Not in the direct map */
+
+	/* TSC readings, at TscFrequency ticks per second */
+	UINT64 TscFrequency;
+	UINT64 LoaderStart;
+	UINT64 ExitBootServices; /* Before the memory map was read for the exit */
+	UINT64 KernelEntry;
+
+	/*
+	 * The map ExitBootServices was called with, sorted by address, with
+	 * neighbouring ranges of the same kind merged and no gaps filled
+	 */
+	UINT64 Memory;        /* BOOT_INFO_MEMORY array */
+	UINT64 NumberOfMemoryRanges;
+} BOOT_INFO;
+
+#endif /* __BOOT_INFO_H__ */
@@ -0,0 +1,420 @@
+/*
+ * Boot configuration file
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+/*
+ * boot.cfg on the boot volume holds one key=value pair per line, lines
+ * starting with # are comments. A missing file leaves the defaults.
+ * initrd and module may be given more than once, each adds a file that
+ * is loaded after the kernel.
+ */
+
+#define CONFIG_BOOLEAN 0x1
+#define CONFIG_NUMBER  0x2
+#define CONFIG_DIGEST  0x3
+#define CONFIG_PATH    0x4
+#define CONFIG_INITRD  0x5
+#define CONFIG_MODULE  0x6
+#define CONFIG_DIRECT_MAP 0x7
+
+typedef struct {
+	CHAR8 *Key;
+	UINTN Type;
+	VOID *Value;
+} CONFIG_KEY;
+
+BOOT_CONFIG BootConfig = {
+	FALSE,			/* HugePages */
+	0xFFFF800000000000,	/* DirectMapOffset */
+	FALSE,			/* La57 */
+	0xFFFFFFFF80000000,	/* KernelBase */
+	TRUE,			/* Kaslr */
+	SIZE_1GB,		/* KaslrWindow */
+	{ FALSE },		/* KernelSha256 */
+	{ FALSE },		/* KernelBlake3 */
+	TRUE,			/* DiskIo */
+	L"kernel",		/* Kernel */
+	{ { { { 0 } } } },	/* Manifest */
+	0,			/* ReadChunk */
+};
+
+CONFIG_KEY ConfigKeys[] = {
+	{ "huge_pages", CONFIG_BOOLEAN, &BootConfig.HugePages },
+	{ "direct_map_offset", CONFIG_DIRECT_MAP, &BootConfig.DirectMapOffset },
+	{ "la57", CONFIG_BOOLEAN, &BootConfig.La57 },
+	{ "kernel_base", CONFIG_NUMBER, &BootConfig.KernelBase },
+	{ "kaslr", CONFIG_BOOLEAN, &BootConfig.Kaslr },
+	{ "kaslr_window", CONFIG_NUMBER, &BootConfig.KaslrWindow },
+	{ "kernel_sha256", CONFIG_DIGEST, &BootConfig.KernelSha256 },
+	{ "kernel_blake3", CONFIG_DIGEST, &BootConfig.KernelBlake3 },
+	{ "disk_io", CONFIG_BOOLEAN, &BootConfig.DiskIo },
+	{ "kernel", CONFIG_PATH, BootConfig.Kernel },
+	{ "initrd", CONFIG_INITRD, &BootConfig.Manifest },
+	{ "module", CONFIG_MODULE, &BootConfig.Manifest },
+	{ "read_chunk", CONFIG_NUMBER, &BootConfig.ReadChunk },
+};
+
+BOOLEAN boot_config_match(CHAR8 *Value, CHAR8 *Word)
+{
+	return AsciiStrCmp(Value, Word) == 0;
+}
+
+BOOLEAN boot_config_boolean(CHAR8 *Value, BOOLEAN *Result)
+{
+	if(boot_config_match(Value, "1") || boot_config_match(Value, "yes") ||
+	   boot_config_match(Value, "true") || boot_config_match(Value, "on")) {
+		*Result = TRUE;
+		return TRUE;
+	}
+
+	if(boot_config_match(Value, "0") || boot_config_match(Value, "no") ||
+	   boot_config_match(Value, "false") || boot_config_match(Value, "off")) {
+		*Result = FALSE;
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+BOOLEAN boot_config_number(CHAR8 *Value, UINT64 *Result)
+{
+	UINT64 Number = 0;
+	UINTN Base = 10;
+
+	if(Value[0] == '0' && (Value[1] == 'x' || Value[1] == 'X')) {
+		Base = 16;
+		Value += 2;
+	}
+
+	if(*Value == '\0')
+		return FALSE;
+
+	for(; *Value; Value++) {
+		UINTN Digit;
+
+		if(*Value >= '0' && *Value <= '9')
+			Digit = *Value - '0';
+		else if(Base == 16 && *Value >= 'a' && *Value <= 'f')
+			Digit = *Value - 'a' + 10;
+		else if(Base == 16 && *Value >= 'A' && *Value <= 'F')
+			Digit = *Value - 'A' + 10;
+		else
+			break;
+
+		Number = Number * Base + Digit;
+	}
+
+	/* Optional binary size suffix */
+	if(*Value == 'k' || *Value == 'K') {
+		Number <<= 10;
+		Value++;
+	} else if(*Value == 'm' || *Value == 'M') {
+		Number <<= 20;
+		Value++;
+	} else if(*Value == 'g' || *Value == 'G') {
+		Number <<= 30;
+		Value++;
+	}
+
+	if(*Value != '\0')
+		return FALSE;
+
+	*Result = Number;
+	return TRUE;
+}
+
+/*
+ * The direct map is built from 1 GB leaves where the processor has them,
+ * and must stay clear of the loader, which is mapped where it runs. So
+ * its offset is a 1 GB aligned, canonical address in the upper half.
+ */
+BOOLEAN boot_config_direct_map(CHAR8 *Value, UINT64 *Offset)
+{
+	UINT64 Number;
+
+	if(!boot_config_number(Value, &Number))
+		return FALSE;
+
+	if(Number < 0xFFFF800000000000 || (Number & (SIZE_1GB - 1)) != 0) {
+		Print(L"direct_map_offset must be a 1 GB aligned address from 0xFFFF800000000000 up\n");
+		return FALSE;
+	}
+
+	*Offset = Number;
+	return TRUE;
+}
+
+/* Exactly 64 hex digits */
+BOOLEAN boot_config_digest(CHAR8 *Value, BOOT_DIGEST *Digest)
+{
+	for(UINTN Index = 0; Index < 64; Index++) {
+		CHAR8 Char = Value[Index];
+		UINT8 Digit;
+
+		if(Char >= '0' && Char <= '9')
+			Digit = Char - '0';
+		else if(Char >= 'a' && Char <= 'f')
+			Digit = Char - 'a' + 10;
+		else if(Char >= 'A' && Char <= 'F')
+			Digit = Char - 'A' + 10;
+		else
+			return FALSE;
+
+		if(Index & 1)
+			Digest->Bytes[Index / 2] |= Digit;
+		else
+			Digest->Bytes[Index / 2] = Digit << 4;
+	}
+
+	if(Value[64] != '\0' && Value[64] != ' ' && Value[64] != '\t' && Value[64] != '\r' && Value[64] != '\n')
+		return FALSE;
+
+	Digest->Present = TRUE;
+	return TRUE;
+}
+
+/* A path on the boot volume, / may stand in for \ */
+BOOLEAN boot_config_path(CHAR8 *Value, CHAR16 *Path)
+{
+	UINTN Length = AsciiStrLen(Value);
+
+	if(Length == 0 || Length >= BOOT_PATH_MAX)
+		return FALSE;
+
+	for(UINTN Index = 0; Index <= Length; Index++)
+		Path[Index] = Value[Index] == '/' ? L'\\' : (UINT8)Value[Index];
+
+	return TRUE;
+}
+
+/* Each initrd= and module= line adds a file to the manifest */
+BOOLEAN boot_config_manifest(CHAR8 *Value, UINT32 Type, BOOT_MANIFEST *Manifest)
+{
+	BOOT_MANIFEST_ENTRY *Entry = &Manifest->Entries[Manifest->NumberOfEntries];
+
+	if(Manifest->NumberOfEntries == BOOT_MANIFEST_MAX || !boot_config_path(Value, Entry->FileName))
+		return FALSE;
+
+	Entry->Type = Type;
+	Manifest->NumberOfEntries++;
+	return TRUE;
+}
+
+VOID boot_config_set(CHAR8 *Key, CHAR8 *Value)
+{
+	for(UINTN Index = 0; Index < ARRAY_SIZE(ConfigKeys); Index++) {
+		if(!boot_config_match(Key, ConfigKeys[Index].Key))
+			continue;
+
+		switch(ConfigKeys[Index].Type) {
+		case CONFIG_BOOLEAN:
+			if(boot_config_boolean(Value, (BOOLEAN*)ConfigKeys[Index].Value))
+				return;
+			break;
+		case CONFIG_NUMBER:
+			if(boot_config_number(Value, (UINT64*)ConfigKeys[Index].Value))
+				return;
+			break;
+		case CONFIG_DIRECT_MAP:
+			if(boot_config_direct_map(Value, (UINT64*)ConfigKeys[Index].Value))
+				return;
+			break;
+		case CONFIG_DIGEST:
+			if(boot_config_digest(Value, (BOOT_DIGEST*)ConfigKeys[Index].Value))
+				return;
+			break;
+		case CONFIG_PATH:
+			if(boot_config_path(Value, (CHAR16*)ConfigKeys[Index].Value))
+				return;
+			break;
+		case CONFIG_INITRD:
+			if(boot_config_manifest(Value, BOOT_MODULE_INITRD, (BOOT_MANIFEST*)ConfigKeys[Index].Value))
+				return;
+			break;
+		case CONFIG_MODULE:
+			if(boot_config_manifest(Value, BOOT_MODULE_OTHER, (BOOT_MANIFEST*)ConfigKeys[Index].Value))
+				return;
+			break;
+		}
+
+		Print(L"Invalid value for boot.cfg key %a: %a\n", Key, Value);
+		return;
+	}
+
+	Print(L"Unknown boot.cfg key: %a\n", Key);
+}
+
+CHAR8 *boot_config_trim(CHAR8 *Start, CHAR8 *End)
+{
+	while(Start < End && (*Start == ' ' || *Start == '\t'))
+		Start++;
+	while(End > Start && (End[-1] == ' ' || End[-1] == '\t' || End[-1] == '\r'))
+		End--;
+
+	*End = '\0';
+	return Start;
+}
+
+EFI_STATUS boot_load_config(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_FILE *ConfigFile;
+	CHAR8 *FileBuffer;
+	UINTN FileSize;
+	UINTN ReadSize;
+
+	Status = Volume->Open(
+			Volume,
+			&ConfigFile,
+			FileName,
+			EFI_FILE_MODE_READ,
+			0);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	ConfigFile->SetPosition(ConfigFile, 0xFFFFFFFFFFFFFFFF);
+	ConfigFile->GetPosition(ConfigFile, &FileSize);
+	ConfigFile->SetPosition(ConfigFile, 0x0);
+
+	Status = gBS->AllocatePool(EfiLoaderData, FileSize + 1, (VOID**)&FileBuffer);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating memory: %S, %lx\n", FileName, Status);
+		ConfigFile->Close(ConfigFile);
+		return Status;
+	}
+
+	ReadSize = FileSize;
+	Status = ConfigFile->Read(ConfigFile, &ReadSize, FileBuffer);
+	ConfigFile->Close(ConfigFile);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while reading %S: %lx\n", FileName, Status);
+		gBS->FreePool(FileBuffer);
+		return Status;
+	}
+
+	FileBuffer[ReadSize] = '\n';
+
+	for(CHAR8 *Line = FileBuffer; Line < FileBuffer + ReadSize;) {
+		CHAR8 *LineEnd = Line;
+		CHAR8 *Separator = NULL;
+
+		while(*LineEnd != '\n') {
+			if(*LineEnd == '=' && !Separator)
+				Separator = LineEnd;
+			LineEnd++;
+		}
+
+		CHAR8 *Key = boot_config_trim(Line, Separator ? Separator : LineEnd);
+		if(*Key != '\0' && *Key != '#') {
+			if(Separator)
+				boot_config_set(Key, boot_config_trim(Separator + 1, LineEnd));
+			else
+				Print(L"Missing value for boot.cfg key: %a\n", Key);
+		}
+
+		Line = LineEnd + 1;
+	}
+
+	gBS->FreePool(FileBuffer);
+
+	return Status;
+}
+
+/*
+ * Read a digest file in sha256sum or b3sum format, the digest followed by
+ * the file name. A missing file leaves Digest untouched.
+ */
+EFI_STATUS boot_load_digest(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, BOOT_DIGEST *Digest)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_FILE *DigestFile;
+	CHAR8 Buffer[65];
+	UINTN ReadSize = 64;
+
+	Status = Volume->Open(
+			Volume,
+			&DigestFile,
+			FileName,
+			EFI_FILE_MODE_READ,
+			0);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = DigestFile->Read(DigestFile, &ReadSize, Buffer);
+	DigestFile->Close(DigestFile);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Buffer[ReadSize] = '\0';
+	if(ReadSize != 64 || !boot_config_digest(Buffer, Digest)) {
+		Print(L"Invalid digest in %S\n", FileName);
+		return EFI_VOLUME_CORRUPTED;
+	}
+
+	return Status;
+}
+
+/* Read a detached 64-byte Ed25519 signature as written by KernelSign.py */
+EFI_STATUS boot_load_signature(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, UINT8 *Signature)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_FILE *SignatureFile;
+	UINT8 Buffer[65];
+	UINTN ReadSize = sizeof(Buffer);
+
+	Status = Volume->Open(
+			Volume,
+			&SignatureFile,
+			FileName,
+			EFI_FILE_MODE_READ,
+			0);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = SignatureFile->Read(SignatureFile, &ReadSize, Buffer);
+	SignatureFile->Close(SignatureFile);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	if(ReadSize != 64) {
+		Print(L"Invalid signature in %S\n", FileName);
+		return EFI_VOLUME_CORRUPTED;
+	}
+
+	gBS->CopyMem(Signature, Buffer, 64);
+
+	return Status;
+}
@@ -32,10 +32,20 @@
 #include <Library/BaseLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
 #include <Library/PrintLib.h>
 
 #include "Boot.h"
 
+#if defined (_M_X64) || defined (_M_AMD64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define CONSOLE_SSE2
+#endif
+
+/* Largest integer glyph scale and widest supported glyph in pixels */
+#define CONSOLE_MAX_SCALE 3
+#define CONSOLE_MAX_GLYPH_WIDTH 32
+
 UINT8 *ConsoleBuffer = NULL;
 UINTN BufferWidth = 0;
 UINTN BufferHeight = 0;
@@ -44,74 +54,199 @@ UINTN CurrentColumn = 0;
 EFI_GRAPHICS_OUTPUT_PROTOCOL *GlobalGraphicsOutput = NULL;
 FONT *GlobalFont = NULL;
 
-EFI_STATUS boot_render_font(FONT *Font, UINT32 BackgroundColor, UINT32 ForegroundColor)
+UINTN ConsoleScale = 1;
+UINT32 ConsoleForeground = 0x0;
+UINT32 ConsoleBackground = 0xffffffff;
+UINT32 *FrameBuffer = NULL;   /* NULL when the mode can only be drawn with Blt */
+UINT32 *CellBuffer = NULL;    /* One scaled glyph cell, used for Blt only modes */
+UINT64 FontUnpackTicks = 0;
+
+/*
+ * Every nibble of a bitmap row expands into 4 * ConsoleScale pixels,
+ * so a glyph row is drawn by copying one table entry per nibble.
+ */
+UINT32 ExpandTable[16][4 * CONSOLE_MAX_SCALE];
+UINT32 RowBuffer[CONSOLE_MAX_GLYPH_WIDTH * CONSOLE_MAX_SCALE];
+
+UINTN boot_console_scale(UINT32 HorizontalResolution)
 {
-	EFI_STATUS Status = EFI_SUCCESS;
+	/* One scale step per 1920 pixels, so 4K panels get 2x */
+	UINTN Scale = HorizontalResolution / 1920;
 
-	/* Allocate memory for rendered font */
-	Status = gBS->AllocatePool(EfiLoaderData, Font->Width * Font->Height * sizeof(UINT32) * Font->NumberOfSymbols, (VOID**)&Font->RenderedFont);
-	if(EFI_ERROR(Status)) {
-		Print(L"Error while allocating memory for rendered font\n");
-		return Status;
-	}
-  
-	/* Render font */
-	for(UINTN Index = 0; Index < Font->NumberOfSymbols; Index++) {
-		UINT8 *CurrentSymbol = Font->Bitmap + (Index * Font->BitmapHeight * Font->BitmapWidth);
-		UINT32 *CurrentSymbolBuffer = Font->RenderedFont + (Index * Font->Height * Font->Width);
+	if(Scale < 1)
+		Scale = 1;
+	if(Scale > CONSOLE_MAX_SCALE)
+		Scale = CONSOLE_MAX_SCALE;
 
-		for (UINT32 RowIndex = 0; RowIndex < Font->Height; RowIndex++) {
-			UINT16 Row = *(UINT16*)((UINTN)CurrentSymbol + RowIndex * Font->BitmapWidth);
+	return Scale;
+}
 
-#if defined (_M_X64) || defined (_M_AMD64) || defined(__x86_64__)
-        		/* amd64 is little endian */
-        
-        		Row = (Row >> 8) | (Row << 8);
-#endif
-			for (UINT32 ColumnIndex = 0; ColumnIndex < 16; ColumnIndex++) {
-				if (Row & (1 << (15 - ColumnIndex))) {
-					*(CurrentSymbolBuffer + (RowIndex * Font->Width) + ColumnIndex) = ForegroundColor;
-				} else {
-					*(CurrentSymbolBuffer + (RowIndex * Font->Width) + ColumnIndex) = BackgroundColor;
-				}
+UINT32 boot_console_pixel(UINT32 Color)
+{
+	/* Colors are kept in Blt (BGR) order */
+	if(FrameBuffer && GlobalGraphicsOutput->Mode->Info->PixelFormat == PixelRedGreenBlueReserved8BitPerColor)
+		return (Color & 0xff00ff00) | ((Color >> 16) & 0xff) | ((Color & 0xff) << 16);
+
+	return Color;
+}
+
+VOID boot_build_expand_table()
+{
+	UINT32 Foreground = boot_console_pixel(ConsoleForeground);
+	UINT32 Background = boot_console_pixel(ConsoleBackground);
+
+	for(UINTN Nibble = 0; Nibble < 16; Nibble++) {
+		for(UINTN Pixel = 0; Pixel < 4 * ConsoleScale; Pixel++) {
+			if(Nibble & (8 >> (Pixel / ConsoleScale))) {
+				ExpandTable[Nibble][Pixel] = Foreground;
+			} else {
+				ExpandTable[Nibble][Pixel] = Background;
 			}
 		}
 	}
-  
-	return Status;
 }
 
-#if 0
-VOID boot_render_char(FONT *Font, UINT32 ForegroundColor, UINT32 BackgroundColor, UINT32 CharacterIndex, UINT32 X, UINT32 Y)
+UINT8 boot_font_symbol(CHAR8 Character)
 {
-	UINT8 *CurrentSymbol = Font->Bitmap + (CharacterIndex * 22 * 2);
+	if(GlobalFont->SymbolMap)
+		return GlobalFont->SymbolMap[Character & 0x7f];
 
-	for (UINT32 RowIndex = 0; RowIndex < 22; RowIndex++) {
-		UINT16 Row = *(UINT16*)((UINTN)CurrentSymbol + RowIndex * 2);
+	/* The built-in layout starts printable ASCII at symbol 17 */
+	return Character - 15;
+}
 
-#if defined (_M_X64) || defined (_M_AMD64) || defined(__x86_64__)
-		/* amd64 is little endian */
-        
-		Row = (Row >> 8) | (Row << 8);
+UINT32 boot_glyph_row(UINTN Symbol, UINTN RowIndex)
+{
+	UINT8 *Row = GlobalFont->Bitmap + (Symbol * GlobalFont->BitmapHeight + RowIndex) * GlobalFont->BitmapWidth;
+	UINT32 Bits = 0;
+
+	/* Bitmap rows are stored most significant bit first */
+	for(UINTN Index = 0; Index < GlobalFont->BitmapWidth && Index < 4; Index++)
+		Bits |= (UINT32)Row[Index] << (24 - Index * 8);
+
+	return Bits;
+}
+
+VOID boot_expand_row(UINT32 Bits, UINT32 *Pixels)
+{
+	for(UINTN Column = 0; Column < GlobalFont->Width; Column += 4) {
+		UINT32 *Source = ExpandTable[Bits >> 28];
+
+#ifdef CONSOLE_SSE2
+		for(UINTN Index = 0; Index < ConsoleScale; Index++)
+			_mm_storeu_si128((__m128i*)Pixels + Index, _mm_loadu_si128((__m128i*)Source + Index));
+#else
+		gBS->CopyMem((VOID*)Pixels, (VOID*)Source, 4 * ConsoleScale * sizeof(UINT32));
 #endif
-		for (INT32 ColumnIndex = 0; ColumnIndex < 16; ColumnIndex++) {
-			if (Row & (1 << (15 - ColumnIndex))) {
-				*((UINT32*)GlobalGraphicsOutput->Mode->FrameBufferBase + (Y + RowIndex) * GlobalGraphicsOutput->Mode->Info->PixelsPerScanLine + (X + ColumnIndex)) = ForegroundColor;
-			} else {
-				*((UINT32*)GlobalGraphicsOutput->Mode->FrameBufferBase + (Y + RowIndex) * GlobalGraphicsOutput->Mode->Info->PixelsPerScanLine + (X + ColumnIndex)) = BackgroundColor;
-			}
-		}
+		Pixels += 4 * ConsoleScale;
+		Bits <<= 4;
 	}
 }
+
+VOID boot_store_row(UINT32 *Destination, UINT32 *Source, UINTN Count)
+{
+#ifdef CONSOLE_SSE2
+	UINTN Index = 0;
+
+	if(((UINTN)Destination & 0xf) == 0) {
+		/* Framebuffers are usually write combining, stream around the cache */
+		for(; Index + 4 <= Count; Index += 4)
+			_mm_stream_si128((__m128i*)(Destination + Index), _mm_loadu_si128((__m128i*)(Source + Index)));
+	} else {
+		for(; Index + 4 <= Count; Index += 4)
+			_mm_storeu_si128((__m128i*)(Destination + Index), _mm_loadu_si128((__m128i*)(Source + Index)));
+	}
+
+	for(; Index < Count; Index++)
+		Destination[Index] = Source[Index];
+#else
+	gBS->CopyMem((VOID*)Destination, (VOID*)Source, Count * sizeof(UINT32));
 #endif
+}
+
+VOID boot_draw_glyph(UINTN Symbol, UINTN Column, UINTN Line)
+{
+	UINTN CellWidth = GlobalFont->Width * ConsoleScale;
+	UINTN CellHeight = GlobalFont->Height * ConsoleScale;
+	UINTN Pitch = CellWidth;
+	UINT32 *Destination = CellBuffer;
+
+	if(FrameBuffer) {
+		Pitch = GlobalGraphicsOutput->Mode->Info->PixelsPerScanLine;
+		Destination = FrameBuffer + Line * CellHeight * Pitch + Column * CellWidth;
+	}
+
+	for(UINTN RowIndex = 0; RowIndex < GlobalFont->Height; RowIndex++) {
+		boot_expand_row(boot_glyph_row(Symbol, RowIndex), RowBuffer);
+
+		for(UINTN Repeat = 0; Repeat < ConsoleScale; Repeat++) {
+			boot_store_row(Destination, RowBuffer, CellWidth);
+			Destination += Pitch;
+		}
+	}
+
+	if(!FrameBuffer) {
+		GlobalGraphicsOutput->Blt(
+			GlobalGraphicsOutput,
+			(EFI_GRAPHICS_OUTPUT_BLT_PIXEL *)CellBuffer,
+			EfiBltBufferToVideo,
+			0,
+			0,
+			Column * CellWidth,
+			Line * CellHeight,
+			CellWidth,
+			CellHeight,
+			0);
+	}
+}
+
+EFI_STATUS boot_unpack_font(FONT *Font)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN BitmapSize = Font->NumberOfSymbols * Font->BitmapHeight * Font->BitmapWidth;
+	UINTN UnpackedSize = 0;
+	UINT64 Start;
+
+	Status = gBS->AllocatePool(EfiLoaderData, BitmapSize, (VOID**)&Font->Bitmap);
+	if(EFI_ERROR(Status) || !Font->Bitmap) {
+		Print(L"Error while allocating memory for the font bitmap\n");
+		return Status;
+	}
+
+	Start = boot_timer_ticks();
+	Status = boot_lz4_decompress(Font->PackedBitmap, Font->PackedSize, Font->Bitmap, BitmapSize, &UnpackedSize);
+	if(EFI_ERROR(Status) || UnpackedSize != BitmapSize) {
+		Print(L"Error while unpacking font: %lx\n", Status);
+		return EFI_ERROR(Status) ? Status : EFI_VOLUME_CORRUPTED;
+	}
+
+	FontUnpackTicks = boot_timer_ticks() - Start;
+
+	return Status;
+}
 
 EFI_STATUS boot_console_init(EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput, FONT *Font)
 {
 	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_GRAPHICS_OUTPUT_MODE_INFORMATION *Info = GraphicsOutput->Mode->Info;
+
+	if(Font->Width > CONSOLE_MAX_GLYPH_WIDTH) {
+		Print(L"Unsupported font width: %u\n", Font->Width);
+		return EFI_UNSUPPORTED;
+	}
+
+	/* The built-in font is linked in packed */
+	if(!Font->Bitmap && Font->PackedBitmap) {
+		Status = boot_unpack_font(Font);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+
+	ConsoleScale = boot_console_scale(Info->HorizontalResolution);
   
-	/* With a 12x22 font 1920x1080 would be 160x49*/
-	BufferWidth = GraphicsOutput->Mode->Info->HorizontalResolution / Font->Width;
-	BufferHeight = GraphicsOutput->Mode->Info->VerticalResolution / Font->Height;
+	/* With a 12x22 font 1920x1080 would be 160x49, 3840x2160 at 2x the same */
+	BufferWidth = Info->HorizontalResolution / (Font->Width * ConsoleScale);
+	BufferHeight = Info->VerticalResolution / (Font->Height * ConsoleScale);
   
 	/* Allocate memory for console buffer */
 	Status = gBS->AllocatePool(EfiLoaderData, BufferWidth * BufferHeight * sizeof(UINT8), (VOID**)&ConsoleBuffer);
@@ -120,16 +255,24 @@ EFI_STATUS boot_console_init(EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput, FONT
 		return Status;
 	}
   
-	gBS->SetMem((VOID*)ConsoleBuffer, BufferWidth * BufferHeight * sizeof(UINT8), 17);
-  
-	Status = boot_render_font(Font, 0xffffffff, 0x0);
-	if(EFI_ERROR(Status)) {
-		Print(L"Error while rendering font\n");
-		return Status;
+	GlobalFont = Font;
+	gBS->SetMem((VOID*)ConsoleBuffer, BufferWidth * BufferHeight * sizeof(UINT8), boot_font_symbol(' '));
+
+	/* Draw straight into the framebuffer when its layout is known */
+	if(Info->PixelFormat == PixelBlueGreenRedReserved8BitPerColor ||
+	   Info->PixelFormat == PixelRedGreenBlueReserved8BitPerColor) {
+		FrameBuffer = (UINT32*)(UINTN)GraphicsOutput->Mode->FrameBufferBase;
+	} else {
+		Status = gBS->AllocatePool(EfiLoaderData, Font->Width * Font->Height * ConsoleScale * ConsoleScale * sizeof(UINT32), (VOID**)&CellBuffer);
+		if(EFI_ERROR(Status) || !CellBuffer) {
+			Print(L"Error while allocating memory for the glyph cell buffer\n");
+			return Status;
+		}
 	}
   
-	GlobalFont = Font;
 	GlobalGraphicsOutput = GraphicsOutput;
+
+	boot_build_expand_table();
   
 	return Status;
 }
@@ -156,21 +299,14 @@ VOID boot_draw_console_buffer()
 
 	for(UINTN RowIndex = 0; RowIndex < BufferHeight; RowIndex++) {
 		for(UINTN ColumnIndex = 0; ColumnIndex < BufferWidth; ColumnIndex++) {
-    
-			GlobalGraphicsOutput->Blt(
-				GlobalGraphicsOutput,
-				(EFI_GRAPHICS_OUTPUT_BLT_PIXEL *)(GlobalFont->RenderedFont + ConsoleBuffer[RowIndex * BufferWidth + ColumnIndex]*16*22),
-				EfiBltBufferToVideo,
-				0,
-				0,
-				ColumnIndex * GlobalFont->Width,
-				RowIndex * GlobalFont->Height,
-				GlobalFont->Width,
-				GlobalFont->Height,
-				0);
-    
+			boot_draw_glyph(ConsoleBuffer[RowIndex * BufferWidth + ColumnIndex], ColumnIndex, RowIndex);
 		}
 	}
+
+#ifdef CONSOLE_SSE2
+	/* Drain the streaming stores before anyone else looks at the screen */
+	_mm_sfence();
+#endif
 }
 
 VOID boot_print(CHAR8 *Format, ...)
@@ -205,12 +341,12 @@ VOID boot_print(CHAR8 *Format, ...)
 
 	for(UINTN Index = 0; Index < StringLength; Index++) {
 		if(Buffer[Index] >= 32 && Buffer[Index] <= 127) {
-			ConsoleBuffer[CurrentLine * BufferWidth + CurrentColumn] = Buffer[Index] - 15;
+			ConsoleBuffer[CurrentLine * BufferWidth + CurrentColumn] = boot_font_symbol(Buffer[Index]);
 			CurrentColumn++;
 
 		} else if(Buffer[Index] == 8) { /* Backspace */
 			CurrentColumn--;
-			ConsoleBuffer[CurrentLine * BufferWidth + CurrentColumn] = 17;
+			ConsoleBuffer[CurrentLine * BufferWidth + CurrentColumn] = boot_font_symbol(' ');
 
       		} else if(Buffer[Index] == 10) { /* Line feed */
 			CurrentColumn = 0;
@@ -235,7 +371,7 @@ VOID boot_print(CHAR8 *Format, ...)
     
 		if(CurrentLine > BufferHeight) {
 			gBS->CopyMem((VOID*)ConsoleBuffer, (VOID*)(ConsoleBuffer + BufferWidth), BufferWidth * BufferHeight - BufferWidth);
-			gBS->SetMem((VOID*)(ConsoleBuffer + (BufferWidth * BufferHeight - BufferWidth)), BufferWidth, 17);
+			gBS->SetMem((VOID*)(ConsoleBuffer + (BufferWidth * BufferHeight - BufferWidth)), BufferWidth, boot_font_symbol(' '));
 			CurrentLine--;
 		}
   
@@ -0,0 +1,112 @@
+/*
+ * CRC32C
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+#if defined (_M_X64) || defined (_M_AMD64) || defined(__x86_64__)
+#include <immintrin.h>
+#define CRC32C_SSE42
+#endif
+
+#ifdef __GNUC__
+#define CRC32C_SSE42_TARGET __attribute__((target("sse4.2")))
+#else
+#define CRC32C_SSE42_TARGET
+#endif
+
+/* Castagnoli polynomial, bit reversed */
+#define CRC32C_POLYNOMIAL 0x82F63B78
+
+UINT32 Crc32cTable[256];
+UINT32 (*Crc32cUpdate)(UINT32 Crc, CONST UINT8 *Data, UINTN Size);
+
+UINT32 boot_crc32c_generic(UINT32 Crc, CONST UINT8 *Data, UINTN Size)
+{
+	while(Size--)
+		Crc = Crc32cTable[(Crc ^ *Data++) & 0xFF] ^ (Crc >> 8);
+
+	return Crc;
+}
+
+#ifdef CRC32C_SSE42
+CRC32C_SSE42_TARGET
+UINT32 boot_crc32c_sse42(UINT32 Crc, CONST UINT8 *Data, UINTN Size)
+{
+	UINT64 Crc64;
+
+	for(; Size && ((UINTN)Data & 7); Size--)
+		Crc = _mm_crc32_u8(Crc, *Data++);
+
+	Crc64 = Crc;
+	for(; Size >= 8; Size -= 8, Data += 8)
+		Crc64 = _mm_crc32_u64(Crc64, *(CONST UINT64*)Data);
+	Crc = (UINT32)Crc64;
+
+	while(Size--)
+		Crc = _mm_crc32_u8(Crc, *Data++);
+
+	return Crc;
+}
+
+BOOLEAN boot_crc32c_sse42_supported()
+{
+	UINT32 Ecx;
+
+	AsmCpuid(1, NULL, NULL, &Ecx, NULL);
+	return (Ecx & BIT20) != 0;
+}
+#endif
+
+/* CRC32C of Size bytes following ones that left Crc, start with 0 */
+UINT32 boot_crc32c(UINT32 Crc, CONST VOID *Data, UINTN Size)
+{
+	if(!Crc32cUpdate) {
+		for(UINT32 Index = 0; Index < 256; Index++) {
+			UINT32 Value = Index;
+
+			for(UINTN Bit = 0; Bit < 8; Bit++)
+				Value = (Value >> 1) ^ (Value & 1 ? CRC32C_POLYNOMIAL : 0);
+			Crc32cTable[Index] = Value;
+		}
+
+		Crc32cUpdate = boot_crc32c_generic;
+#ifdef CRC32C_SSE42
+		if(boot_crc32c_sse42_supported())
+			Crc32cUpdate = boot_crc32c_sse42;
+#endif
+	}
+
+	return ~Crc32cUpdate(~Crc, Data, Size);
+}
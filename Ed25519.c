@@ -0,0 +1,577 @@
+/*
+ * Ed25519 signature verification
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Ed25519.h"
+#include "Boot.h"
+
+/*
+ * Verification only handles public data, so nothing here needs to run
+ * in constant time. Scalars are split into signed 4-bit digits: the base
+ * point goes through the precomputed Ed25519Base rows, the public key
+ * through a table of its first eight multiples built per signature.
+ */
+
+#define ED25519_MASK51 0x7FFFFFFFFFFFFULL
+
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+/* Products of two limbs, GCC and Clang on 64-bit targets */
+typedef unsigned __int128 ED25519_WIDE;
+#else
+/* Other compilers build the products from 32-bit halves */
+#define ED25519_WIDE_STRUCT
+typedef struct {
+	UINT64 Low;
+	UINT64 High;
+} ED25519_WIDE;
+#endif
+
+ED25519_FE Ed25519D = { 0x34DCA135978A3, 0x1A8283B156EBD, 0x5E7A26001C029, 0x739C663A03CBB, 0x52036CEE2B6FF };
+ED25519_FE Ed25519D2 = { 0x69B9426B2F159, 0x35050762ADD7A, 0x3CF44C0038052, 0x6738CC7407977, 0x2406D9DC56DFF };
+ED25519_FE Ed25519SqrtM1 = { 0x61B274A0EA0B0, 0x0D5A5FC8F189D, 0x7EF5E9CBD0C60, 0x78595A6804C9E, 0x2B8324804FC1D };
+
+/* Group order, little endian 64-bit words */
+UINT64 Ed25519L[4] = { 0x5812631A5CF5D3EDULL, 0x14DEF9DEA2F79CD6ULL, 0x0000000000000000ULL, 0x1000000000000000ULL };
+
+/* Exponents p - 2 and (p - 5) / 8, little endian */
+UINT8 Ed25519Invert[32] = {
+	0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+};
+UINT8 Ed25519Sqrt[32] = {
+	0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+};
+
+UINT64 boot_ed25519_load64(CONST UINT8 *Bytes)
+{
+	UINT64 Value = 0;
+
+	for(UINTN Index = 8; Index > 0; Index--)
+		Value = (Value << 8) | Bytes[Index - 1];
+
+	return Value;
+}
+
+/* Bring every limb back to 51 bits, the top carry wraps around times 19 */
+VOID boot_fe_carry(ED25519_FE H)
+{
+	UINT64 Carry;
+
+	for(UINTN Index = 0; Index < 4; Index++) {
+		Carry = H[Index] >> 51;
+		H[Index] &= ED25519_MASK51;
+		H[Index + 1] += Carry;
+	}
+
+	Carry = H[4] >> 51;
+	H[4] &= ED25519_MASK51;
+	H[0] += 19 * Carry;
+	H[1] += H[0] >> 51;
+	H[0] &= ED25519_MASK51;
+}
+
+VOID boot_fe_copy(ED25519_FE H, CONST ED25519_FE F)
+{
+	for(UINTN Index = 0; Index < 5; Index++)
+		H[Index] = F[Index];
+}
+
+VOID boot_fe_set(ED25519_FE H, UINT64 Value)
+{
+	H[0] = Value;
+	H[1] = H[2] = H[3] = H[4] = 0;
+}
+
+VOID boot_fe_add(ED25519_FE H, CONST ED25519_FE F, CONST ED25519_FE G)
+{
+	for(UINTN Index = 0; Index < 5; Index++)
+		H[Index] = F[Index] + G[Index];
+	boot_fe_carry(H);
+}
+
+/* F + 2p - G keeps the limbs positive */
+VOID boot_fe_sub(ED25519_FE H, CONST ED25519_FE F, CONST ED25519_FE G)
+{
+	H[0] = F[0] + 0xFFFFFFFFFFFDAULL - G[0];
+	for(UINTN Index = 1; Index < 5; Index++)
+		H[Index] = F[Index] + 0xFFFFFFFFFFFFEULL - G[Index];
+	boot_fe_carry(H);
+}
+
+VOID boot_fe_neg(ED25519_FE H, CONST ED25519_FE F)
+{
+	ED25519_FE Zero = { 0 };
+
+	boot_fe_sub(H, Zero, F);
+}
+
+#ifdef ED25519_WIDE_STRUCT
+/* R += A * B */
+VOID boot_wide_mul_add(ED25519_WIDE *R, UINT64 A, UINT64 B)
+{
+	UINT64 LowLow = (A & 0xFFFFFFFF) * (B & 0xFFFFFFFF);
+	UINT64 LowHigh = (A & 0xFFFFFFFF) * (B >> 32);
+	UINT64 HighLow = (A >> 32) * (B & 0xFFFFFFFF);
+	UINT64 Middle = (LowLow >> 32) + (LowHigh & 0xFFFFFFFF) + (HighLow & 0xFFFFFFFF);
+	UINT64 Low = (Middle << 32) | (LowLow & 0xFFFFFFFF);
+
+	R->Low += Low;
+	R->High += (A >> 32) * (B >> 32) + (LowHigh >> 32) + (HighLow >> 32) + (Middle >> 32) + (R->Low < Low);
+}
+
+/* R >> 51, which fits 64 bits for the sums in boot_fe_mul */
+UINT64 boot_wide_shift51(CONST ED25519_WIDE *R)
+{
+	return (R->Low >> 51) | (R->High << 13);
+}
+
+VOID boot_fe_mul(ED25519_FE H, CONST ED25519_FE F, CONST ED25519_FE G)
+{
+	UINT64 G19[5] = { G[0], 19 * G[1], 19 * G[2], 19 * G[3], 19 * G[4] };
+	ED25519_WIDE R[5] = { { 0 } };
+	UINT64 Carry;
+
+	/* Limb Index of the result takes F[Term] * G[Index - Term], wrapping around with the factor 19 */
+	for(UINTN Index = 0; Index < 5; Index++)
+		for(UINTN Term = 0; Term < 5; Term++)
+			boot_wide_mul_add(&R[Index], F[Term], Term <= Index ? G[Index - Term] : G19[Index + 5 - Term]);
+
+	for(UINTN Index = 1; Index < 5; Index++) {
+		Carry = boot_wide_shift51(&R[Index - 1]);
+		R[Index].Low += Carry;
+		R[Index].High += R[Index].Low < Carry;
+	}
+	Carry = boot_wide_shift51(&R[4]);
+
+	H[0] = (R[0].Low & ED25519_MASK51) + 19 * Carry;
+	H[1] = (R[1].Low & ED25519_MASK51) + (H[0] >> 51);
+	H[0] &= ED25519_MASK51;
+	H[2] = R[2].Low & ED25519_MASK51;
+	H[3] = R[3].Low & ED25519_MASK51;
+	H[4] = R[4].Low & ED25519_MASK51;
+}
+#else
+VOID boot_fe_mul(ED25519_FE H, CONST ED25519_FE F, CONST ED25519_FE G)
+{
+	UINT64 G1 = 19 * G[1], G2 = 19 * G[2], G3 = 19 * G[3], G4 = 19 * G[4];
+	ED25519_WIDE R0, R1, R2, R3, R4;
+	UINT64 Carry;
+
+	R0 = (ED25519_WIDE)F[0] * G[0] + (ED25519_WIDE)F[1] * G4 + (ED25519_WIDE)F[2] * G3 + (ED25519_WIDE)F[3] * G2 + (ED25519_WIDE)F[4] * G1;
+	R1 = (ED25519_WIDE)F[0] * G[1] + (ED25519_WIDE)F[1] * G[0] + (ED25519_WIDE)F[2] * G4 + (ED25519_WIDE)F[3] * G3 + (ED25519_WIDE)F[4] * G2;
+	R2 = (ED25519_WIDE)F[0] * G[2] + (ED25519_WIDE)F[1] * G[1] + (ED25519_WIDE)F[2] * G[0] + (ED25519_WIDE)F[3] * G4 + (ED25519_WIDE)F[4] * G3;
+	R3 = (ED25519_WIDE)F[0] * G[3] + (ED25519_WIDE)F[1] * G[2] + (ED25519_WIDE)F[2] * G[1] + (ED25519_WIDE)F[3] * G[0] + (ED25519_WIDE)F[4] * G4;
+	R4 = (ED25519_WIDE)F[0] * G[4] + (ED25519_WIDE)F[1] * G[3] + (ED25519_WIDE)F[2] * G[2] + (ED25519_WIDE)F[3] * G[1] + (ED25519_WIDE)F[4] * G[0];
+
+	R1 += (UINT64)(R0 >> 51);
+	R2 += (UINT64)(R1 >> 51);
+	R3 += (UINT64)(R2 >> 51);
+	R4 += (UINT64)(R3 >> 51);
+	Carry = (UINT64)(R4 >> 51);
+
+	H[0] = ((UINT64)R0 & ED25519_MASK51) + 19 * Carry;
+	H[1] = ((UINT64)R1 & ED25519_MASK51) + (H[0] >> 51);
+	H[0] &= ED25519_MASK51;
+	H[2] = (UINT64)R2 & ED25519_MASK51;
+	H[3] = (UINT64)R3 & ED25519_MASK51;
+	H[4] = (UINT64)R4 & ED25519_MASK51;
+}
+#endif
+
+/* F raised to a 255-bit exponent, square and multiply from the top */
+VOID boot_fe_pow(ED25519_FE H, CONST ED25519_FE F, CONST UINT8 *Exponent)
+{
+	ED25519_FE Result;
+
+	boot_fe_set(Result, 1);
+	for(UINTN Bit = 255; Bit > 0; Bit--) {
+		boot_fe_mul(Result, Result, Result);
+		if(Exponent[(Bit - 1) / 8] & (1 << ((Bit - 1) % 8)))
+			boot_fe_mul(Result, Result, F);
+	}
+
+	boot_fe_copy(H, Result);
+}
+
+VOID boot_fe_from_bytes(ED25519_FE H, CONST UINT8 *Bytes)
+{
+	H[0] = boot_ed25519_load64(Bytes) & ED25519_MASK51;
+	H[1] = (boot_ed25519_load64(Bytes + 6) >> 3) & ED25519_MASK51;
+	H[2] = (boot_ed25519_load64(Bytes + 12) >> 6) & ED25519_MASK51;
+	H[3] = (boot_ed25519_load64(Bytes + 19) >> 1) & ED25519_MASK51;
+	H[4] = (boot_ed25519_load64(Bytes + 24) >> 12) & ED25519_MASK51;
+}
+
+/* Fully reduced, so equal elements give equal bytes */
+VOID boot_fe_to_bytes(UINT8 *Bytes, CONST ED25519_FE F)
+{
+	ED25519_FE T;
+
+	boot_fe_copy(T, F);
+	boot_fe_carry(T);
+	boot_fe_carry(T);
+
+	/* T is below 2^255 now, adding 19 carries out of it exactly when T >= p */
+	T[0] += 19;
+	boot_fe_carry(T);
+
+	/* Add 2^255 - 19 and drop bit 255, which takes 19 back off */
+	T[0] += ED25519_MASK51 + 1 - 19;
+	for(UINTN Index = 1; Index < 5; Index++)
+		T[Index] += ED25519_MASK51;
+	for(UINTN Index = 0; Index < 4; Index++) {
+		T[Index + 1] += T[Index] >> 51;
+		T[Index] &= ED25519_MASK51;
+	}
+	T[4] &= ED25519_MASK51;
+
+	SetMem(Bytes, 32, 0);
+	for(UINTN Bit = 0; Bit < 255; Bit++) {
+		if(T[Bit / 51] & (1ULL << (Bit % 51)))
+			Bytes[Bit / 8] |= (UINT8)(1 << (Bit % 8));
+	}
+}
+
+BOOLEAN boot_fe_equal(CONST ED25519_FE F, CONST ED25519_FE G)
+{
+	UINT8 A[32], B[32];
+
+	boot_fe_to_bytes(A, F);
+	boot_fe_to_bytes(B, G);
+
+	return CompareMem(A, B, sizeof(A)) == 0;
+}
+
+VOID boot_ge_identity(ED25519_POINT *P)
+{
+	boot_fe_set(P->X, 0);
+	boot_fe_set(P->Y, 1);
+	boot_fe_set(P->Z, 1);
+	boot_fe_set(P->T, 0);
+}
+
+VOID boot_ge_cached(ED25519_CACHED *C, CONST ED25519_POINT *P)
+{
+	boot_fe_add(C->YPlusX, P->Y, P->X);
+	boot_fe_sub(C->YMinusX, P->Y, P->X);
+	boot_fe_copy(C->Z, P->Z);
+	boot_fe_mul(C->T2d, P->T, Ed25519D2);
+}
+
+/*
+ * R = P + Q, or P - Q with Subtract set, for a = -1 twisted Edwards in
+ * extended coordinates. Negating Q swaps Y + X with Y - X and flips T.
+ */
+VOID boot_ge_add(ED25519_POINT *R, CONST ED25519_POINT *P, CONST ED25519_FE YPlusX, CONST ED25519_FE YMinusX,
+		 CONST ED25519_FE Z, CONST ED25519_FE T2d, BOOLEAN Subtract)
+{
+	ED25519_FE A, B, C, D, E, F, G, H;
+
+	boot_fe_sub(A, P->Y, P->X);
+	boot_fe_mul(A, A, Subtract ? YPlusX : YMinusX);
+	boot_fe_add(B, P->Y, P->X);
+	boot_fe_mul(B, B, Subtract ? YMinusX : YPlusX);
+	boot_fe_mul(C, P->T, T2d);
+	if(Z)
+		boot_fe_mul(D, P->Z, Z);
+	else
+		boot_fe_copy(D, P->Z);
+	boot_fe_add(D, D, D);
+
+	boot_fe_sub(E, B, A);
+	boot_fe_add(H, B, A);
+	if(Subtract) {
+		boot_fe_add(F, D, C);
+		boot_fe_sub(G, D, C);
+	} else {
+		boot_fe_sub(F, D, C);
+		boot_fe_add(G, D, C);
+	}
+
+	boot_fe_mul(R->X, E, F);
+	boot_fe_mul(R->Y, G, H);
+	boot_fe_mul(R->T, E, H);
+	boot_fe_mul(R->Z, F, G);
+}
+
+VOID boot_ge_double(ED25519_POINT *R, CONST ED25519_POINT *P)
+{
+	ED25519_FE A, B, C, E, F, G, H;
+
+	boot_fe_mul(A, P->X, P->X);
+	boot_fe_mul(B, P->Y, P->Y);
+	boot_fe_mul(C, P->Z, P->Z);
+	boot_fe_add(C, C, C);
+
+	boot_fe_add(E, P->X, P->Y);
+	boot_fe_mul(E, E, E);
+	boot_fe_sub(E, E, A);
+	boot_fe_sub(E, E, B);
+	boot_fe_sub(G, B, A);
+	boot_fe_sub(F, G, C);
+	boot_fe_add(H, A, B);
+	boot_fe_neg(H, H);
+
+	boot_fe_mul(R->X, E, F);
+	boot_fe_mul(R->Y, G, H);
+	boot_fe_mul(R->T, E, H);
+	boot_fe_mul(R->Z, F, G);
+}
+
+/*
+ * Decode a point, RFC 8032 5.1.3: x^2 = (y^2 - 1) / (d * y^2 + 1), taken
+ * as u * v^3 * (u * v^7)^((p - 5) / 8). Encodings of y >= p are refused.
+ */
+BOOLEAN boot_ge_from_bytes(ED25519_POINT *P, CONST UINT8 *Bytes)
+{
+	ED25519_FE U, V, V3, X, Check;
+	UINT8 Canonical[32];
+
+	boot_fe_from_bytes(P->Y, Bytes);
+	boot_fe_to_bytes(Canonical, P->Y);
+	if(CompareMem(Canonical, Bytes, 31) != 0 || Canonical[31] != (Bytes[31] & 0x7F))
+		return FALSE;
+
+	boot_fe_mul(U, P->Y, P->Y);
+	boot_fe_mul(V, U, Ed25519D);
+	boot_fe_set(Check, 1);
+	boot_fe_sub(U, U, Check);
+	boot_fe_add(V, V, Check);
+
+	boot_fe_mul(V3, V, V);
+	boot_fe_mul(V3, V3, V);
+	boot_fe_mul(X, V3, V3);
+	boot_fe_mul(X, X, V);
+	boot_fe_mul(X, X, U);
+	boot_fe_pow(X, X, Ed25519Sqrt);
+	boot_fe_mul(X, X, V3);
+	boot_fe_mul(X, X, U);
+
+	boot_fe_mul(Check, X, X);
+	boot_fe_mul(Check, Check, V);
+	if(!boot_fe_equal(Check, U)) {
+		boot_fe_neg(U, U);
+		if(!boot_fe_equal(Check, U))
+			return FALSE;
+		boot_fe_mul(X, X, Ed25519SqrtM1);
+	}
+
+	boot_fe_to_bytes(Canonical, X);
+	if((Canonical[0] & 1) != (Bytes[31] >> 7)) {
+		boot_fe_set(Check, 0);
+		if(boot_fe_equal(X, Check))
+			return FALSE;
+		boot_fe_neg(X, X);
+	}
+
+	boot_fe_copy(P->X, X);
+	boot_fe_set(P->Z, 1);
+	boot_fe_mul(P->T, P->X, P->Y);
+
+	return TRUE;
+}
+
+VOID boot_ge_to_bytes(UINT8 *Bytes, CONST ED25519_POINT *P)
+{
+	ED25519_FE Inverse, X, Y;
+	UINT8 XBytes[32];
+
+	boot_fe_pow(Inverse, P->Z, Ed25519Invert);
+	boot_fe_mul(X, P->X, Inverse);
+	boot_fe_mul(Y, P->Y, Inverse);
+
+	boot_fe_to_bytes(Bytes, Y);
+	boot_fe_to_bytes(XBytes, X);
+	Bytes[31] |= (XBytes[0] & 1) << 7;
+}
+
+/* Digits in [-8, 8] with Scalar = sum Digits[i] * 16^i, Scalar below 2^255 */
+VOID boot_sc_digits(INT8 *Digits, CONST UINT8 *Scalar)
+{
+	INT8 Carry = 0;
+
+	for(UINTN Index = 0; Index < 32; Index++) {
+		Digits[2 * Index] = Scalar[Index] & 15;
+		Digits[2 * Index + 1] = Scalar[Index] >> 4;
+	}
+
+	for(UINTN Index = 0; Index < 63; Index++) {
+		Digits[Index] += Carry;
+		Carry = (Digits[Index] + 8) >> 4;
+		Digits[Index] -= Carry * 16;
+	}
+	Digits[63] += Carry;
+}
+
+/* Scalar below the group order */
+BOOLEAN boot_sc_canonical(CONST UINT8 *Scalar)
+{
+	for(UINTN Word = 4; Word > 0; Word--) {
+		UINT64 Value = boot_ed25519_load64(Scalar + 8 * (Word - 1));
+
+		if(Value != Ed25519L[Word - 1])
+			return Value < Ed25519L[Word - 1];
+	}
+
+	return FALSE;
+}
+
+/* Reduce a 512-bit little endian number mod L, one bit at a time from the top */
+VOID boot_sc_reduce(UINT8 *Scalar, CONST UINT8 *Wide)
+{
+	UINT64 R[4] = { 0 };
+
+	for(UINTN Bit = 512; Bit > 0; Bit--) {
+		BOOLEAN Above = TRUE;
+		UINT64 Borrow = 0;
+
+		R[3] = (R[3] << 1) | (R[2] >> 63);
+		R[2] = (R[2] << 1) | (R[1] >> 63);
+		R[1] = (R[1] << 1) | (R[0] >> 63);
+		R[0] = (R[0] << 1) | ((Wide[(Bit - 1) / 8] >> ((Bit - 1) % 8)) & 1);
+
+		for(UINTN Word = 4; Word > 0; Word--) {
+			if(R[Word - 1] != Ed25519L[Word - 1]) {
+				Above = R[Word - 1] > Ed25519L[Word - 1];
+				break;
+			}
+		}
+		if(!Above)
+			continue;
+
+		for(UINTN Word = 0; Word < 4; Word++) {
+			UINT64 Value = R[Word] - Ed25519L[Word];
+			UINT64 Next = (R[Word] < Ed25519L[Word]) | (Value < Borrow);
+
+			R[Word] = Value - Borrow;
+			Borrow = Next;
+		}
+	}
+
+	for(UINTN Index = 0; Index < 32; Index++)
+		Scalar[Index] = (UINT8)(R[Index / 8] >> (8 * (Index % 8)));
+}
+
+/* R = Scalar * B through the table, odd digits first and one shift by 16 */
+VOID boot_ge_scalarmult_base(ED25519_POINT *R, CONST UINT8 *Scalar)
+{
+	INT8 Digits[64];
+
+	boot_sc_digits(Digits, Scalar);
+	boot_ge_identity(R);
+
+	for(UINTN Pass = 0; Pass < 2; Pass++) {
+		for(UINTN Index = 1 - Pass; Index < 64; Index += 2) {
+			ED25519_PRECOMP *Entry;
+
+			if(Digits[Index] == 0)
+				continue;
+
+			Entry = &Ed25519Base[Index / 2][(Digits[Index] < 0 ? -Digits[Index] : Digits[Index]) - 1];
+			boot_ge_add(R, R, Entry->YPlusX, Entry->YMinusX, NULL, Entry->XY2d, Digits[Index] < 0);
+		}
+
+		if(Pass == 0) {
+			for(UINTN Double = 0; Double < 4; Double++)
+				boot_ge_double(R, R);
+		}
+	}
+}
+
+/* R = Scalar * P with P, 2P ... 8P prepared up front */
+VOID boot_ge_scalarmult(ED25519_POINT *R, CONST ED25519_POINT *P, CONST UINT8 *Scalar)
+{
+	ED25519_CACHED Multiples[8];
+	ED25519_POINT Sum = *P;
+	INT8 Digits[64];
+
+	boot_ge_cached(&Multiples[0], P);
+	for(UINTN Index = 1; Index < 8; Index++) {
+		boot_ge_add(&Sum, &Sum, Multiples[0].YPlusX, Multiples[0].YMinusX, Multiples[0].Z, Multiples[0].T2d, FALSE);
+		boot_ge_cached(&Multiples[Index], &Sum);
+	}
+
+	boot_sc_digits(Digits, Scalar);
+	boot_ge_identity(R);
+
+	for(UINTN Index = 64; Index > 0; Index--) {
+		INT8 Digit = Digits[Index - 1];
+		ED25519_CACHED *Entry;
+
+		for(UINTN Double = 0; Double < 4; Double++)
+			boot_ge_double(R, R);
+
+		if(Digit == 0)
+			continue;
+
+		Entry = &Multiples[(Digit < 0 ? -Digit : Digit) - 1];
+		boot_ge_add(R, R, Entry->YPlusX, Entry->YMinusX, Entry->Z, Entry->T2d, Digit < 0);
+	}
+}
+
+/*
+ * RFC 8032 5.1.7 verification of Signature = R || S over Message: with
+ * k = SHA-512(R || PublicKey || Message) mod L, S * B - k * A must encode
+ * to R.
+ */
+BOOLEAN boot_ed25519_verify(CONST UINT8 *PublicKey, CONST VOID *Message, UINTN MessageSize, CONST UINT8 *Signature)
+{
+	SHA512_CONTEXT Sha512;
+	ED25519_POINT A, KA, SB;
+	ED25519_CACHED Cached;
+	UINT8 Hash[64];
+	UINT8 K[32];
+	UINT8 Check[32];
+
+	if(!boot_sc_canonical(Signature + 32) || !boot_ge_from_bytes(&A, PublicKey))
+		return FALSE;
+
+	boot_sha512_init(&Sha512);
+	boot_sha512_update(&Sha512, Signature, 32);
+	boot_sha512_update(&Sha512, PublicKey, 32);
+	boot_sha512_update(&Sha512, Message, MessageSize);
+	boot_sha512_final(&Sha512, Hash);
+	boot_sc_reduce(K, Hash);
+
+	boot_ge_scalarmult(&KA, &A, K);
+	boot_ge_scalarmult_base(&SB, Signature + 32);
+
+	boot_ge_cached(&Cached, &KA);
+	boot_ge_add(&SB, &SB, Cached.YPlusX, Cached.YMinusX, Cached.Z, Cached.T2d, TRUE);
+	boot_ge_to_bytes(Check, &SB);
+
+	return CompareMem(Check, Signature, sizeof(Check)) == 0;
+}
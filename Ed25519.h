@@ -0,0 +1,64 @@
+/*
+ * Ed25519 field and group definitions
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __ED25519_H__
+#define __ED25519_H__
+
+/*
+ * Field elements mod 2^255 - 19 in five 51-bit limbs. Limbs may run a
+ * few bits over 51 between operations, products are taken in 128 bits.
+ */
+typedef UINT64 ED25519_FE[5];
+
+/* Extended coordinates, x = X / Z, y = Y / Z, X * Y = Z * T */
+typedef struct {
+	ED25519_FE X;
+	ED25519_FE Y;
+	ED25519_FE Z;
+	ED25519_FE T;
+} ED25519_POINT;
+
+/* A point prepared for additions */
+typedef struct {
+	ED25519_FE YPlusX;
+	ED25519_FE YMinusX;
+	ED25519_FE Z;
+	ED25519_FE T2d;
+} ED25519_CACHED;
+
+/* An affine point prepared for additions, Z = 1 */
+typedef struct {
+	ED25519_FE YPlusX;
+	ED25519_FE YMinusX;
+	ED25519_FE XY2d;
+} ED25519_PRECOMP;
+
+extern ED25519_PRECOMP Ed25519Base[32][8];
+
+#endif /* __ED25519_H__ */
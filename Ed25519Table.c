@@ -0,0 +1,867 @@
+/*
+ * Ed25519 base point table, generated by Ed25519Table.py
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+
+#include "Ed25519.h"
+
+ED25519_PRECOMP Ed25519Base[32][8] = {
+	{
+		{ { 0x493C6F58C3B85, 0x0DF7181C325F7, 0x0F50B0B3E4CB7, 0x5329385A44C32, 0x07CF9D3A33D4B },
+		  { 0x03905D740913E, 0x0BA2817D673A2, 0x23E2827F4E67C, 0x133D2E0C21A34, 0x44FD2F9298F81 },
+		  { 0x11205877AAA68, 0x479955893D579, 0x50D66309B67A0, 0x2D42D0DBEE5EE, 0x6F117B689F0C6 } },
+		{ { 0x4E7FC933C71D7, 0x2CF41FEB6B244, 0x7581C0A7D1A76, 0x7172D534D32F0, 0x590C063FA87D2 },
+		  { 0x1A56042B4D5A8, 0x189CC159ED153, 0x5B8DEAA3CAE04, 0x2AAF04F11B5D8, 0x6BB595A669C92 },
+		  { 0x2A8B3A59B7A5F, 0x3ABB359EF087F, 0x4F5A8C4DB05AF, 0x5B9A807D04205, 0x701AF5B13EA50 } },
+		{ { 0x5B0A84CEE9730, 0x61D10C97155E4, 0x4059CC8096A10, 0x47A608DA8014F, 0x7A164E1B9A80F },
+		  { 0x11FE8A4FCD265, 0x7BCB8374FAACC, 0x52F5AF4EF4D4F, 0x5314098F98D10, 0x2AB91587555BD },
+		  { 0x6933F0DD0D889, 0x44386BB4C4295, 0x3CB6D3162508C, 0x26368B872A2C6, 0x5A2826AF12B9B } },
+		{ { 0x351B98EFC099F, 0x68FBFA4A7050E, 0x42A49959D971B, 0x393E51A469EFD, 0x680E910321E58 },
+		  { 0x6050A056818BF, 0x62ACC1F5532BF, 0x28141CCC9FA25, 0x24D61F471E683, 0x27933F4C7445A },
+		  { 0x3FBE9C476FF09, 0x0AF6B982E4B42, 0x0AD1251BA78E5, 0x715AEEDEE7C88, 0x7F9D0CBF63553 } },
+		{ { 0x2BC4408A5BB33, 0x078EBDDA05442, 0x2FFB112354123, 0x375EE8DF5862D, 0x2945CCF146E20 },
+		  { 0x182C3A447D6BA, 0x22964E536EFF2, 0x192821F540053, 0x2F9F19E788E5C, 0x154A7E73EB1B5 },
+		  { 0x3DBF1812A8285, 0x0FA17BA3F9797, 0x6F69CB49C3820, 0x34D5A0DB3858D, 0x43AABE696B3BB } },
+		{ { 0x4EEEB77157131, 0x1201915F10741, 0x1669CDA6C9C56, 0x45EC032DB346D, 0x51E57BB6A2CC3 },
+		  { 0x006B67B7D8CA4, 0x084FA44E72933, 0x1154EE55D6F8A, 0x4425D842E7390, 0x38B64C41AE417 },
+		  { 0x4326702EA4B71, 0x06834376030B5, 0x0EF0512F9C380, 0x0F1A9F2512584, 0x10B8E91A9F0D6 } },
+		{ { 0x25CD0944EA3BF, 0x75673B81A4D63, 0x150B925D1C0D4, 0x13F38D9294114, 0x461BEA69283C9 },
+		  { 0x72C9AAA3221B1, 0x267774474F74D, 0x064B0E9B28085, 0x3F04EF53B27C9, 0x1D6EDD5D2E531 },
+		  { 0x36DC801B8B3A2, 0x0E0A7D4935E30, 0x1DEB7CECC0D7D, 0x053A94E20DD2C, 0x7A9FBB1C6A0F9 } },
+		{ { 0x7596604DD3E8F, 0x6FC510E058B36, 0x3670C8DB2CC0D, 0x297D899CE332F, 0x0915E76061BCE },
+		  { 0x75DEDF39234D9, 0x01C36AB1F3C54, 0x0F08FEE58F5DA, 0x0E19613A0D637, 0x3A9024A1320E0 },
+		  { 0x1F5D9C9A2911A, 0x7117994FAFCF8, 0x2D8A8CAE28DC5, 0x74AB1B2090C87, 0x26907C5C2ECC4 } },
+	},
+	{
+		{ { 0x4DD0E632F9C1D, 0x2CED12622A5D9, 0x18DE9614742DA, 0x79CA96FDBB5D4, 0x6DD37D49A00EE },
+		  { 0x3635449AA515E, 0x3E178D0475DAB, 0x50B4712A19712, 0x2DCC2860FF4AD, 0x30D76D6F03D31 },
+		  { 0x444172106E4C7, 0x01251AFED2D88, 0x534FC9BED4F5A, 0x5D85A39CF5234, 0x10C697112E864 } },
+		{ { 0x62AA08358C805, 0x46F440848E194, 0x447B771A8F52B, 0x377BA3269D31D, 0x03BF9BAF55080 },
+		  { 0x3C4277DBE5FDE, 0x5A335AFD44C92, 0x0C1164099753E, 0x70487006FE423, 0x25E61CABED66F },
+		  { 0x3E128CC586604, 0x5968B2E8FC7E2, 0x049A3D5BD61CF, 0x116505B1EF6E6, 0x566D78634586E } },
+		{ { 0x54285C65A2FD0, 0x55E62CCF87420, 0x46BB961B19044, 0x1153405712039, 0x14FBA5F34793B },
+		  { 0x7A49F9CC10834, 0x2B513788A22C6, 0x5FF4B6EF2395B, 0x2EC8E5AF607BF, 0x33975BCA5ECC3 },
+		  { 0x746166985F7D4, 0x09939000AE79A, 0x5844C7964F97A, 0x13617E1F95B3D, 0x14829CEA83FC5 } },
+		{ { 0x70B2F4E71ECB8, 0x728148EFC643C, 0x0753E03995B76, 0x5BF5FB2AB6767, 0x05FC3BC4535D7 },
+		  { 0x37B8497DD95C2, 0x61549D6B4FFE8, 0x217A22DB1D138, 0x0B9CF062EB09E, 0x2FD9C71E5F758 },
+		  { 0x0B3AE52AFDEDD, 0x19DA76619E497, 0x6FA0654D2558E, 0x78219D25E41D4, 0x373767475C651 } },
+		{ { 0x095CB14246590, 0x002D82AA6AC68, 0x442F183BC4851, 0x6464F1C0A0644, 0x6BF5905730907 },
+		  { 0x299FD40D1ADD9, 0x5F2DE9A04E5F7, 0x7C0EEBACC1C59, 0x4CCA1B1F8290A, 0x1FBEA56C3B18F },
+		  { 0x778F1E1415B8A, 0x6F75874EFC1F4, 0x28A694019027F, 0x52B37A96BDC4D, 0x02521CF67A635 } },
+		{ { 0x46720772F5EE4, 0x632C0F359D622, 0x2B2092BA3E252, 0x662257C112680, 0x001753D9F7CD6 },
+		  { 0x7EE0B0A9D5294, 0x381FBEB4CCA27, 0x7841F3A3E639D, 0x676EA30C3445F, 0x3FA00A7E71382 },
+		  { 0x1232D963DDB34, 0x35692E70B078D, 0x247CA14777A1F, 0x6DB556BE8FCD0, 0x12B5FE2FA048E } },
+		{ { 0x37C26AD6F1E92, 0x46A0971227BE5, 0x4722F0D2D9B4C, 0x3DC46204EE03A, 0x6F7E93C20796C },
+		  { 0x0FBC496FCE34D, 0x575BE6B7DAE3E, 0x4A31585CEE609, 0x037E9023930FF, 0x749B76F96FB12 },
+		  { 0x2F604AEA6AE05, 0x637DC939323EB, 0x3FDAD9B048D47, 0x0A8B0D4045AF7, 0x0FCEC10F01E02 } },
+		{ { 0x2D29DC4244E45, 0x6927B1BC147BE, 0x0308534AC0839, 0x4853664033F41, 0x413779166FEAB },
+		  { 0x558A649FE1E44, 0x44635AEEFCC89, 0x1FF434887F2BA, 0x0F981220E2D44, 0x4901AA7183C51 },
+		  { 0x1B7548C1AF8F0, 0x7848C53368116, 0x01B64E7383DE9, 0x109FBB0587C8F, 0x41BB887B726D1 } },
+	},
+	{
+		{ { 0x34C597C6691AE, 0x7A150B6990FC4, 0x52BEB9D922274, 0x70EED7164861A, 0x0A871E070C6A9 },
+		  { 0x07D44744346BE, 0x282B6A564A81D, 0x4ED80F875236B, 0x6FBBE1D450C50, 0x4EB728C12FCDB },
+		  { 0x1B5994BBC8989, 0x74B7BA84C0660, 0x75678F1CDAEB8, 0x23206B0D6F10C, 0x3EE7300F2685D } },
+		{ { 0x27947841E7518, 0x32C7388DAE87F, 0x414ADD3971BE9, 0x01850832F0EF1, 0x7D47C6A2CFB89 },
+		  { 0x255E49E7DD6B7, 0x38C2163D59EBA, 0x3861F2A005845, 0x2E11E4CCBAEC9, 0x1381576297912 },
+		  { 0x2D0148EF0D6E0, 0x3522A8DE787FB, 0x2EE055E74F9D2, 0x64038F6310813, 0x148CF58D34C9E } },
+		{ { 0x72F7D9AE4756D, 0x7711E690FFC4A, 0x582A2355B0D16, 0x0DCCFE885B6B4, 0x278FEBAD4EAEA },
+		  { 0x492F67934F027, 0x7DED0815528D4, 0x58461511A6612, 0x5EA2E50DE1544, 0x3FF2FA1EBD5DB },
+		  { 0x2681F8C933966, 0x3840521931635, 0x674F14A308652, 0x3BD9C88A94890, 0x4104DD02FE9C6 } },
+		{ { 0x14E06DB096AB8, 0x1219C89E6B024, 0x278ABD486A2DB, 0x240B292609520, 0x0165B5A48EFCA },
+		  { 0x2BF5E1124422A, 0x673146756AE56, 0x14AD99A87E830, 0x1EACA65B080FD, 0x2C863B00AFAF5 },
+		  { 0x0A474A0846A76, 0x099A5EF981E32, 0x2A8AE3C4BBFE6, 0x45C34AF14832C, 0x591B67D9BFFEC } },
+		{ { 0x1B3719F18B55D, 0x754318C83D337, 0x27C17B7919797, 0x145B084089B61, 0x489B4F8670301 },
+		  { 0x70D1C80B49BFA, 0x3D57E7D914625, 0x3C0722165E545, 0x5E5B93819E04F, 0x3DE02EC7CA8F7 },
+		  { 0x2102D3AEB92EF, 0x68C22D50C3A46, 0x42EA89385894E, 0x75F9EBF55F38C, 0x49F5FBBA496CB } },
+		{ { 0x5628C1E9C572E, 0x598B108E822AB, 0x55D8FAE29361A, 0x0ADC8D1A97B28, 0x06A1A6C288675 },
+		  { 0x49A108A5BCFD4, 0x6178C8E7D6612, 0x1F03473710375, 0x73A49614A6098, 0x5604A86DCBFA6 },
+		  { 0x0D1D47C1764B6, 0x01C08316A2E51, 0x2B3DB45C95045, 0x1634F818D300C, 0x20989E89FE274 } },
+		{ { 0x4278B85EAEC2E, 0x0EF59657BE2CE, 0x72FD169588770, 0x2E9B205260B30, 0x730B9950F7059 },
+		  { 0x777FD3A2DCC7F, 0x594A9FB124932, 0x01F8E80CA15F0, 0x714D13CEC3269, 0x0403ED1D0CA67 },
+		  { 0x32D35874EC552, 0x1F3048DF1B929, 0x300D73B179B23, 0x6E67BE5A37D0B, 0x5BD7454308303 } },
+		{ { 0x4932115E7792A, 0x457B9BBB930B8, 0x68F5D8B193226, 0x4164E8F1ED456, 0x5BB7DB123067F },
+		  { 0x2D19528B24CC2, 0x4AC66B8302FF3, 0x701C8D9FDAD51, 0x6C1B35C5B3727, 0x133A78007380A },
+		  { 0x1F467C6CA62BE, 0x2C4232A5DC12C, 0x7551DC013B087, 0x0690C11B03BCD, 0x740DCA6D58F0E } },
+	},
+	{
+		{ { 0x28C570478433C, 0x1D8502873A463, 0x7641E7EDED49C, 0x1ECEDD54CF571, 0x2C03F5256C2B0 },
+		  { 0x0EE0752CFCE4E, 0x660DD8116FBE9, 0x55167130FFFEB, 0x1C682B885955C, 0x161D25FA963EA },
+		  { 0x718757B53A47D, 0x619E18B0F2F21, 0x5FBDFE4C1EC04, 0x5D798C81EBB92, 0x699468BDBD96B } },
+		{ { 0x53DE66AA91948, 0x045F81A599B1B, 0x3F7A8BD214193, 0x71D4DA412331A, 0x293E1C4E6C4A2 },
+		  { 0x72F46F4DAFECF, 0x2948FFADEF7A3, 0x11ECDFDF3BC04, 0x3C2E98FFEED25, 0x525219A473905 },
+		  { 0x6134B925112E1, 0x6BB942BB406ED, 0x070C445C0DDE2, 0x411D822C4D7A3, 0x5B605C447F032 } },
+		{ { 0x1FEC6F0E7F04C, 0x3CEBC692C477D, 0x077986A19A95E, 0x6EAAAA1778B0F, 0x2F12FEF4CC5AB },
+		  { 0x5805920C47C89, 0x1924771F9972C, 0x38BBDDF9FC040, 0x1F7000092B281, 0x24A76DCEA8AEB },
+		  { 0x522B2DFC0C740, 0x7E8193480E148, 0x33FD9A04341B9, 0x3C863678A20BC, 0x5E607B2518A43 } },
+		{ { 0x4431CA596CF14, 0x015DA7C801405, 0x03C9B6F8F10B5, 0x0346922934017, 0x201F33139E457 },
+		  { 0x31D8F6CDF1818, 0x1F86C4B144B16, 0x39875B8D73E9D, 0x2FBF0D9FFA7B3, 0x5067ACAB6CCDD },
+		  { 0x27F6B08039D51, 0x4802F8000DFAA, 0x09692A062C525, 0x1BAEA91075817, 0x397CBA8862460 } },
+		{ { 0x5C3FBC81379E7, 0x41BBC255E2F02, 0x6A3F756998650, 0x1297FD4E07C42, 0x771B4022C1E1C },
+		  { 0x13093F05959B2, 0x1BD352F2EC618, 0x075789B88EA86, 0x61D1117EA48B9, 0x2339D320766E6 },
+		  { 0x5D986513A2FA7, 0x63F3A99E11B0F, 0x28A0ECFD6B26D, 0x53B6835E18D8F, 0x331A189219971 } },
+		{ { 0x12F3A9D7572AF, 0x10D00E953C4CA, 0x603DF116F2F8A, 0x33DC276E0E088, 0x1AC9619FF649A },
+		  { 0x66F45FB4F80C6, 0x3CC38EEB9FEA2, 0x107647270DB1F, 0x710F1EA740DC8, 0x31167C6B83BDF },
+		  { 0x33842524B1068, 0x77DD39D30FE45, 0x189432141A0D0, 0x088FE4EB8C225, 0x612436341F08B } },
+		{ { 0x349E31A2D2638, 0x0137A7FA6B16C, 0x681AE92777EDC, 0x222BFC5F8DC51, 0x1522AA3178D90 },
+		  { 0x541DB874E898D, 0x62D80FB841B33, 0x03E6EF027FA97, 0x7A03C9E9633E8, 0x46EBE2309E5EF },
+		  { 0x02F5369614938, 0x356E5ADA20587, 0x11BC89F6BF902, 0x036746419C8DB, 0x45FE70F505243 } },
+		{ { 0x24920C8951491, 0x107EC61944C5E, 0x72752E017C01F, 0x122B7DDA2E97A, 0x16619F6DB57A2 },
+		  { 0x075A6960C0B8C, 0x6DDE1C5E41B49, 0x42E3F516DA341, 0x16A03FDA8E79E, 0x428D1623A0E39 },
+		  { 0x74A4401A308FD, 0x06ED4B9558109, 0x746F1F6A08867, 0x4636F5C6F2321, 0x1D81592D60BD3 } },
+	},
+	{
+		{ { 0x5B69F7B85C5E8, 0x17A2D175650EC, 0x4CC3E6DBFC19E, 0x73E1D3873BE0E, 0x3A5F6D51B0AF8 },
+		  { 0x68756A60DAC5F, 0x55D757B8AEC26, 0x3383DF45F80BD, 0x6783F8C9F96A6, 0x20234A7789ECD },
+		  { 0x20DB67178B252, 0x73AA3DA2C0EDA, 0x79045C01C70D3, 0x1B37B15251059, 0x7CD682353CFFE } },
+		{ { 0x5CD6068ACF4F3, 0x3079AFC7A74CC, 0x58097650B64B4, 0x47FABAC9C4E99, 0x3EF0253B2B2CD },
+		  { 0x1A45BD887FAB6, 0x65748076DC17C, 0x5B98000AA11A8, 0x4A1ECC9080974, 0x2838C8863BDC0 },
+		  { 0x3B0CF4A465030, 0x022B8AEF57A2D, 0x2AD0677E925AD, 0x4094167D7457A, 0x21DCB8A606A82 } },
+		{ { 0x500FABE7731BA, 0x7CC53C3113351, 0x7CF65FE080D81, 0x3C5D966011BA1, 0x5D840DBF6C6F6 },
+		  { 0x004468C9D9FC8, 0x5DA8554796B8C, 0x3B8BE70950025, 0x6D5892DA6A609, 0x0BC3D08194A31 },
+		  { 0x6380D309FE18B, 0x4D73C2CB8EE0D, 0x6B882ADBAC0B6, 0x36EABDDDD4CBE, 0x3A4276232AC19 } },
+		{ { 0x0C172DB447ECB, 0x3F8C505B7A77F, 0x6A857F97F3F10, 0x4FCC0567FE03A, 0x0770C9E824E1A },
+		  { 0x2432C8A7084FA, 0x47BF73CA8A968, 0x1639176262867, 0x5E8DF4F8010CE, 0x1FF177CEA16DE },
+		  { 0x1D99A45B5B5FD, 0x523674F2499EC, 0x0F8FA26182613, 0x58F7398048C98, 0x39F264FD41500 } },
+		{ { 0x34AABFE097BE1, 0x43BFC03253A33, 0x29BC7FE91B7F3, 0x0A761E4844A16, 0x65C621272C35F },
+		  { 0x53417DBE7E29C, 0x54573827394F5, 0x565EEA6F650DD, 0x42050748DC749, 0x1712D73468889 },
+		  { 0x389F8CE3193DD, 0x2D424B8177CE5, 0x073FA0D3440CD, 0x139020CD49E97, 0x22F9800AB19CE } },
+		{ { 0x29FDD9A6EFDAC, 0x7C694A9282840, 0x6F7CDEEE44B3A, 0x55A3207B25CC3, 0x4171A4D38598C },
+		  { 0x2368A3E9EF8CB, 0x454AA08E2AC0B, 0x490923F8FA700, 0x372AA9EA4582F, 0x13F416CD64762 },
+		  { 0x758AA99C94C8C, 0x5F6001700FF44, 0x7694E488C01BD, 0x0D5FDE948EED6, 0x508214FA574BD } },
+		{ { 0x215BB53D003D6, 0x1179E792CA8C3, 0x1A0E96AC840A2, 0x22393E2BB3AB6, 0x3A7758A4C86CB },
+		  { 0x269153ED6FE4B, 0x72A23AEF89840, 0x052BE5299699C, 0x3A5E5EF132316, 0x22F960EC6FABA },
+		  { 0x111F693AE5076, 0x3E3BFAA94CA90, 0x445799476B887, 0x24A0912464879, 0x5D9FD15F8DE7F } },
+		{ { 0x44D2AEED7521E, 0x50865D2C2A7E4, 0x2705B5238EA40, 0x46C70B25D3B97, 0x3BC187FA47EB9 },
+		  { 0x408D36D63727F, 0x5FAF8F6A66062, 0x2BB892DA8DE6B, 0x769D4F0C7E2E6, 0x332F35914F8FB },
+		  { 0x70115EA86C20C, 0x16D88DA24ADA8, 0x1980622662ADF, 0x501EBBC195A9D, 0x450D81CE906FB } },
+	},
+	{
+		{ { 0x4D8961CAE743F, 0x6BDC38C7DBA0E, 0x7D3B4A7E1B463, 0x0844BDEE2ADF3, 0x4CBAD279663AB },
+		  { 0x3B6A1A6205275, 0x2E82791D06DCF, 0x23D72CAA93C87, 0x5F0B7AB68AAF4, 0x2DE25D4BA6345 },
+		  { 0x19024A0D71FCD, 0x15F65115F101A, 0x4E99067149708, 0x119D8D1CBA5AF, 0x7D7FBCEFE2007 } },
+		{ { 0x45DC5F3C29094, 0x3455220B579AF, 0x070C1631E068A, 0x26BC0630E9B21, 0x4F9CD196DCD8D },
+		  { 0x71E6A266B2801, 0x09AAE73E2DF5D, 0x40DD8B219B1A3, 0x546FB4517DE0D, 0x5975435E87B75 },
+		  { 0x297D86A7B3768, 0x4835A2F4C6332, 0x070305F434160, 0x183DD014E56AE, 0x7CCDD084387A0 } },
+		{ { 0x484186760CC93, 0x7435665533361, 0x02F686336B801, 0x5225446F64331, 0x3593CA848190C },
+		  { 0x6422C6D260417, 0x212904817BB94, 0x5A319DEB854F5, 0x7A9D4E060DA7D, 0x428BD0ED61D0C },
+		  { 0x3189A5E849AA7, 0x6ACBB1F59B242, 0x7F6EF4753630C, 0x1F346292A2DA9, 0x27398308DA2D6 } },
+		{ { 0x10E4C0A702453, 0x4DAAFA37BD734, 0x49F6BDC3E8961, 0x1FEFFDCECDAE6, 0x572C2945492C3 },
+		  { 0x38D28435ED413, 0x4064F19992858, 0x7680FBEF543CD, 0x1AADD83D58D3C, 0x269597AEBE8C3 },
+		  { 0x7C745D6CD30BE, 0x27C7755DF78EF, 0x1776833937FA3, 0x5405116441855, 0x7F985498C05BC } },
+		{ { 0x615520FBF6363, 0x0B9E9BF74DA6A, 0x4FE8308201169, 0x173F76127DE43, 0x30F2653CD69B1 },
+		  { 0x1CE889F0BE117, 0x36F6A94510709, 0x7F248720016B4, 0x1821ED1E1CF91, 0x76C2EC470A31F },
+		  { 0x0C938AAC10C85, 0x41B64ED797141, 0x1BEB1C1185E6D, 0x1ED5490600F07, 0x2F1273F159647 } },
+		{ { 0x08BD755A70BC0, 0x49E3A885CE609, 0x16585881B5AD6, 0x3C27568D34F5E, 0x38AC1997EDC5F },
+		  { 0x1FC7C8AE01E11, 0x2094D5573E8E7, 0x5CA3CBBF549D2, 0x4F920ECC54143, 0x5D9E572AD85B6 },
+		  { 0x6B517A751B13B, 0x0CFD370B180CC, 0x5377925D1F41A, 0x34E56566008A2, 0x22DFCD9CBFE9E } },
+		{ { 0x459B4103BE0A1, 0x59A4B3F2D2ADD, 0x7D734C8BB8EEB, 0x2393CBE594A09, 0x0FE9877824CDE },
+		  { 0x3D2E0C30D0CD9, 0x3F597686671BB, 0x0AA587EB63999, 0x0E3C7B592C619, 0x6B2916C05448C },
+		  { 0x334D10ABA913B, 0x045CDB581CFDB, 0x5E3E0553A8F36, 0x50BB3041EFFB2, 0x4C303F307FF00 } },
+		{ { 0x403580DD94500, 0x48DF77D92653F, 0x38A9FE3B349EA, 0x0EA89850AAFE1, 0x416B151AB706A },
+		  { 0x23BD617B28C85, 0x6E72EE77D5A61, 0x1A972FF174DDE, 0x3E2636373C60F, 0x0D61B8F78B2AB },
+		  { 0x0D7EFE9C136B0, 0x1AB1C89640AD5, 0x55F82AEF41F97, 0x46957F317ED0D, 0x191A2AF74277E } },
+	},
+	{
+		{ { 0x62B434F460EFB, 0x294C6C0FAD3FC, 0x68368937B4C0F, 0x5C9F82910875B, 0x237E7DBE00545 },
+		  { 0x6F74BC53C1431, 0x1C40E5DBBD9C2, 0x6C8FB9CAE5C97, 0x4845C5CE1B7DA, 0x7E2E0E450B5CC },
+		  { 0x575ED6701B430, 0x4D3E17FA20026, 0x791FC888C4253, 0x2F1BA99078AC1, 0x71AFA699B1115 } },
+		{ { 0x23C1C473B50D6, 0x3E7671DE21D48, 0x326FA5547A1E8, 0x50E4DC25FAFD9, 0x00731FBC78F89 },
+		  { 0x66F9B3953B61D, 0x555F4283CCCB9, 0x7DD67FB1960E7, 0x14707A1AFFED4, 0x021142E9C2B1C },
+		  { 0x0C71848F81880, 0x44BD9D8233C86, 0x6E8578EFE5830, 0x4045B6D7041B5, 0x4C4D6F3347E15 } },
+		{ { 0x4DDFC988F1970, 0x4F6173EA365E1, 0x645DAF9AE4588, 0x7D43763DB623B, 0x38BF9500A88F9 },
+		  { 0x7ECCFC17D1FC9, 0x4CA280782831E, 0x7B8337DB1D7D6, 0x5116DEF3895FB, 0x193FDDAAA7E47 },
+		  { 0x2C93C37E8876F, 0x3431A28C583FA, 0x49049DA8BD879, 0x4B4A8407AC11C, 0x6A6FB99EBF0D4 } },
+		{ { 0x122B5B6E423C6, 0x21E50DFF1DDD6, 0x73D76324E75C0, 0x588485495418E, 0x136FDA9F42C5E },
+		  { 0x6C1BB560855EB, 0x71F127E13AD48, 0x5C6B304905AEC, 0x3756B8E889BC7, 0x75F76914A3189 },
+		  { 0x4DFB1A305BDD1, 0x3B3FF05811F29, 0x6ED62283CD92E, 0x65D1543EC52E1, 0x022183510BE8D } },
+		{ { 0x2710143307A7F, 0x3D88FB48BF3AB, 0x249EB4EC18F7A, 0x136115DFF295F, 0x1387C441FD404 },
+		  { 0x766385EAD2D14, 0x0194F8B06095E, 0x08478F6823B62, 0x6018689D37308, 0x6A071CE17B806 },
+		  { 0x3C3D187978AF8, 0x7AFE1C88276BA, 0x51DF281C8AD68, 0x64906BDA4245D, 0x3171B26AAF1ED } },
+		{ { 0x5B7D8B28A47D1, 0x2C2EE149E34C1, 0x776F5629AFC53, 0x1F4EA50FC49A9, 0x6C514A6334424 },
+		  { 0x7319097564CA8, 0x1844EBC233525, 0x21D4543FDEEE1, 0x1AD27AAFF1BD2, 0x221FD4873CF08 },
+		  { 0x2204F3A156341, 0x537414065A464, 0x43C0C3BEDCF83, 0x5557E706EA620, 0x48DAA596FB924 } },
+		{ { 0x61D5DC84C9793, 0x47DE83040C29E, 0x189DEB26507E7, 0x4D4E6FADC479A, 0x58C837FA0E8A7 },
+		  { 0x28E665CA59CC7, 0x165C715940DD9, 0x0785F3AA11C95, 0x57B98D7E38469, 0x676DD6FCCAD84 },
+		  { 0x1688596FC9058, 0x66F6AD403619F, 0x4D759A87772EF, 0x7856E6173BEA4, 0x1C4F73F2C6A57 } },
+		{ { 0x6706EFC7C3484, 0x6987839EC366D, 0x0731F95CF7F26, 0x3AE758EBCE4BC, 0x70459ADB7DAF6 },
+		  { 0x24FBD305FA0BB, 0x40A98CC75A1CF, 0x78CE1220A7533, 0x6217A10E1C197, 0x795AC80D1BF64 },
+		  { 0x1DB4991B42BB3, 0x469605B994372, 0x631E3715C9A58, 0x7E9CFEFCF728F, 0x5FE162848CE21 } },
+	},
+	{
+		{ { 0x1852D5D7CB208, 0x60D0FBE5CE50F, 0x5A1E246E37B75, 0x51AEE05FFD590, 0x2B44C043677DA },
+		  { 0x1214FE194961A, 0x0E1AE39A9E9CB, 0x543C8B526F9F7, 0x119498067E91D, 0x4789D446FC917 },
+		  { 0x487AB074EB78E, 0x1D33B5E8CE343, 0x13E419FEB1B46, 0x2721F565DE6A4, 0x60C52EEF2BB9A } },
+		{ { 0x3C5C27CAE6D11, 0x36A9491956E05, 0x124BAC9131DA6, 0x3B6F7DE202B5D, 0x70D77248D9B66 },
+		  { 0x589BC3BFD8BF1, 0x6F93E6AA3416B, 0x4C0A3D6C1AE48, 0x55587260B586A, 0x10BC9C312CCFC },
+		  { 0x2E84B3EC2A05B, 0x69DA2F03C1551, 0x23A174661A67B, 0x209BCA289F238, 0x63755BD3A976F } },
+		{ { 0x7101897F1ACB7, 0x3D82CB77B07B8, 0x684083D7769F5, 0x52B28472DCE07, 0x2763751737C52 },
+		  { 0x7A03E2AD10853, 0x213DCC6AD36AB, 0x1A6E240D5BDD6, 0x7C24FFCF8FEDF, 0x0D8CC1C48BC16 },
+		  { 0x402D36EB419A9, 0x7CEF68C14A052, 0x0F1255BC2D139, 0x373E7D431186A, 0x70C2DD8A7AD16 } },
+		{ { 0x4967DB8ED7E13, 0x15AEED02F523A, 0x6149591D094BC, 0x672F204C17006, 0x32B8613816A53 },
+		  { 0x194509F6FEC0E, 0x528D8CA31ACAC, 0x7826D73B8B9FA, 0x24ACB99E0F9B3, 0x2E0FAC6363948 },
+		  { 0x7F7BEE448CD64, 0x4E10F10DA0F3C, 0x3936CB9AB20E9, 0x7A0FC4FEA6CD0, 0x4179215C735A4 } },
+		{ { 0x633B9286BCD34, 0x6CAB3BADB9C95, 0x74E387EDFBDFA, 0x14313C58A0FD9, 0x31FA85662241C },
+		  { 0x094E7D7DCED2A, 0x068FA738E118E, 0x41B640A5FEE2B, 0x6BB709DF019D4, 0x700344A30CD99 },
+		  { 0x26C422E3622F4, 0x0F3066A05B5F0, 0x4E2448F0480A6, 0x244CDE0DBF095, 0x24BB2312A9952 } },
+		{ { 0x00C2AF5F85C6B, 0x0609F4CF2883F, 0x6E86EB5A1CA13, 0x68B44A2EFCCD1, 0x0D1D2AF9FFEB5 },
+		  { 0x0ED1732DE67C3, 0x308C369291635, 0x33EF348F2D250, 0x004475EA1A1BB, 0x0FEE3E871E188 },
+		  { 0x28AA132621EDF, 0x42B244CAF353B, 0x66B064CC2E08A, 0x6BB20020CBDD3, 0x16ACD79718531 } },
+		{ { 0x1C6C57887B6AD, 0x5ABF21FD7592B, 0x50BD41253867A, 0x3800B71273151, 0x164ED34B18161 },
+		  { 0x772AF2D9B1D3D, 0x6D486448B4E5B, 0x2CE58DD8D18A8, 0x1849F67503C8B, 0x123E0EF6B9302 },
+		  { 0x6D94C192FE69A, 0x5475222A2690F, 0x693789D86B8B3, 0x1F5C3BDFB69DC, 0x78DA0FC61073F } },
+		{ { 0x780F1680C3A94, 0x2A35D3CFCD453, 0x005E5CDC7DDF8, 0x6EE888078AC24, 0x054AA4B316B38 },
+		  { 0x15D28E52BC66A, 0x30E1E0351CB7E, 0x30A2F74B11F8C, 0x39D120CD7DE03, 0x2D25DEEB256B1 },
+		  { 0x0468D19267CB8, 0x38CDCA9B5FBF9, 0x1BBB05C2CA1E2, 0x3B015758E9533, 0x134610A6AB7DA } },
+	},
+	{
+		{ { 0x265E777D1F515, 0x0F1F54C1E39A5, 0x2F01B95522646, 0x4FDD8DB9DDE6D, 0x654878CBA97CC },
+		  { 0x38EC78DF6B0FE, 0x13CAEBEA36A22, 0x5EBC6E54E5F6A, 0x32804903D0EB8, 0x2102FDBA2B20D },
+		  { 0x6E405055CE6A1, 0x5024A35A532D3, 0x1F69054DAF29D, 0x15D1D0D7A8BD5, 0x0AD725DB29ECB } },
+		{ { 0x7BC0C9B056F85, 0x51CFEBFFAFFD8, 0x44ABBE94DF549, 0x7ECBBD7E33121, 0x4F675F5302399 },
+		  { 0x267B1834E2457, 0x6AE19C378BB88, 0x7457B5ED9D512, 0x3280D783D05FB, 0x4AEFCFFB71A03 },
+		  { 0x536360415171E, 0x2313309077865, 0x251444334AFBC, 0x2B0C3853756E8, 0x0BCCBB72A2A86 } },
+		{ { 0x55E4C50FE1296, 0x05FDD13EFC30D, 0x1C0C6C380E5EE, 0x3E11DE3FB62A8, 0x6678FD69108F3 },
+		  { 0x6962FEAB1A9C8, 0x6ACA28FB9A30B, 0x56DB7CA1B9F98, 0x39F58497018DD, 0x4024F0AB59D6B },
+		  { 0x6FA31636863C2, 0x10AE5A67E42B0, 0x27ABBF01FDA31, 0x380A7B9E64FBC, 0x2D42E2108EAD4 } },
+		{ { 0x17B0D0F537593, 0x16263C0C9842E, 0x4AB827E4539A4, 0x6370DDB43D73A, 0x420BF3A79B423 },
+		  { 0x5131594DFD29B, 0x3A627E98D52FE, 0x1154041855661, 0x19175D09F8384, 0x676B2608B8D2D },
+		  { 0x0BA651C5B2B47, 0x5862363701027, 0x0C4D6C219C6DB, 0x0F03DFF8658DE, 0x745D2FFA9C0CF } },
+		{ { 0x6DF5721D34E6A, 0x4F32F767A0C06, 0x1D5ABEAC76E20, 0x41CE9E104E1E4, 0x06E15BE54C1DC },
+		  { 0x25A1E2BC9C8BD, 0x104C8F3B037EA, 0x405576FA96C98, 0x2E86A88E3876F, 0x1AE23CEB960CF },
+		  { 0x25D871932994A, 0x6B9D63B560B6E, 0x2DF2814C8D472, 0x0FBBEE20AA4ED, 0x58DED861278EC } },
+		{ { 0x35BA8B6C2C9A8, 0x1DEA58B3185BF, 0x4B455CD23BBBE, 0x5EC19C04883F8, 0x08BA696B531D5 },
+		  { 0x73793F266C55C, 0x0B988A9C93B02, 0x09B0EA32325DB, 0x37CAE71C17C5E, 0x2FF39DE85485F },
+		  { 0x53EEEC3EFC57A, 0x2FA9FE9022EFD, 0x699C72C138154, 0x72A751EBD1FF8, 0x120633B4947CF } },
+		{ { 0x531474912100A, 0x5AFCDF7C0D057, 0x7A9E71B788DED, 0x5EF708F3B0C88, 0x07433BE3CB393 },
+		  { 0x4987891610042, 0x79D9D7F5D0172, 0x3C293013B9EC4, 0x0C2B85F39CACA, 0x35D30A99B4D59 },
+		  { 0x144C05CE997F4, 0x4960B8A347FEF, 0x1DA11F15D74F7, 0x54FAC19C0FEAD, 0x2D873EDE7AF6D } },
+		{ { 0x202E14E5DF981, 0x2EA02BC3EB54C, 0x38875B2883564, 0x1298C513AE9DD, 0x0543618A01600 },
+		  { 0x2316443373409, 0x5DE95503B22AF, 0x699201BEAE2DF, 0x3DB5849FF737A, 0x2E773654707FA },
+		  { 0x2BDF4974C23C1, 0x4B3B9C8D261BD, 0x26AE8B2A9BC28, 0x3068210165C51, 0x4B1443362D079 } },
+	},
+	{
+		{ { 0x454E91C529CCB, 0x24C98C6BF72CF, 0x0486594C3D89A, 0x7AE13A3D7FA3C, 0x17038418EAF66 },
+		  { 0x4B7C7B66E1F7A, 0x4BEA185EFD998, 0x4FABC711055F8, 0x1FB9F7836FE38, 0x582F446752DA6 },
+		  { 0x17BD320324CE4, 0x51489117898C6, 0x1684D92A0410B, 0x6E4D90F78C5A7, 0x0C2A1C4BCDA28 } },
+		{ { 0x4814869BD6945, 0x7B7C391A45DB8, 0x57316AC35B641, 0x641E31DE9096A, 0x5A6A9B30A314D },
+		  { 0x5C7D06F1F0447, 0x7DB70F80B3A49, 0x6CB4A3EC89A78, 0x43BE8AD81397D, 0x7C558BD1C6F64 },
+		  { 0x41524D396463D, 0x1586B449E1A1D, 0x2F17E904AED8A, 0x7E1D2861D3C8E, 0x0404A5CA0AFBA } },
+		{ { 0x49E1B2A416FD1, 0x51C6A0B316C57, 0x575A59ED71BDC, 0x74C021A1FEC1E, 0x39527516E7F8E },
+		  { 0x740070AA743D6, 0x16B64CBDD1183, 0x23F4B7B32EB43, 0x319ABA58235B3, 0x46395BFDCADD9 },
+		  { 0x7DB2D1A5D9A9C, 0x79A200B85422F, 0x355BFAA71DD16, 0x00B77EA5F78AA, 0x76579A29E822D } },
+		{ { 0x4B51352B434F2, 0x1327BD01C2667, 0x434D73B60C8A1, 0x3E0DAA89443BA, 0x02C514BB2A277 },
+		  { 0x68E7E49C02A17, 0x45795346FE8B6, 0x089306C8F3546, 0x6D89F6B2F88F6, 0x43A384DC9E05B },
+		  { 0x3D5DA8BF1B645, 0x7DED6A96A6D09, 0x6C3494FEE2F4D, 0x02C989C8B6BD4, 0x1160920961548 } },
+		{ { 0x05616369B4DCD, 0x4ECAB86AC6F47, 0x3C60085D700B2, 0x0213EE10DFCEA, 0x2F637D7491E6E },
+		  { 0x5166929DACFAA, 0x190826B31F689, 0x4F55567694A7D, 0x705F4F7B1E522, 0x351E125BC5698 },
+		  { 0x49B461AF67BBE, 0x75915712C3A96, 0x69A67EF580C0D, 0x54D38EF70CFFC, 0x7F182D06E7CE2 } },
+		{ { 0x54B728E217522, 0x69A90971B0128, 0x51A40F2A963A3, 0x10BE9AC12A6BF, 0x44ACC043241C5 },
+		  { 0x48E64AB0168EC, 0x2A2BDB8A86F4F, 0x7343B6B2D6929, 0x1D804AA8CE9A3, 0x67D4AC8C343E9 },
+		  { 0x56BBB4F7A5777, 0x29230627C238F, 0x5AD1A122CD7FB, 0x0DEA56E50E364, 0x556D1C8312AD7 } },
+		{ { 0x06756B11BE821, 0x462147E7BB03E, 0x26519743EBFE0, 0x782FC59682AB5, 0x097ABE38CC8C7 },
+		  { 0x740E30C8D3982, 0x7C2B47F4682FD, 0x5CD91B8C7DC1C, 0x77FA790F9E583, 0x746C6C6D1D824 },
+		  { 0x1C9877EA52DA4, 0x2B37B83A86189, 0x733AF49310DA5, 0x25E81161C04FB, 0x577E14A34BEE8 } },
+		{ { 0x6CEBEBD4DD72B, 0x340C1E442329F, 0x32347FFD1A93F, 0x14A89252CBBE0, 0x705304B8FB009 },
+		  { 0x268AC61A73B0A, 0x206F234BEBE1C, 0x5B403A7CBEBE8, 0x7A160F09F4135, 0x60FA7EE96FD78 },
+		  { 0x51D354D296EC6, 0x7CBF5A63B16C7, 0x2F50BB3CF0C14, 0x1FEB385CAC65A, 0x21398E0CA1635 } },
+	},
+	{
+		{ { 0x0AAF9B4B75601, 0x26B91B5AE44F3, 0x6DE808D7AB1C8, 0x6A769675530B0, 0x1BBFB284E98F7 },
+		  { 0x5058A382B33F3, 0x175A91816913E, 0x4F6CDB96B8AE8, 0x17347C9DA81D2, 0x5AA3ED9D95A23 },
+		  { 0x777E9C7D96561, 0x28E58F006CCAC, 0x541BBBB2CAC49, 0x3E63282994CEC, 0x4A07E14E5E895 } },
+		{ { 0x358CDC477A49B, 0x3CC88FE02E481, 0x721AAB7F4E36B, 0x0408CC9469953, 0x50AF7AED84AFA },
+		  { 0x412CB980DF999, 0x5E78DD8EE29DC, 0x171DFF68C575D, 0x2015DD2F6EF49, 0x3F0BAC391D313 },
+		  { 0x7DE0115F65BE5, 0x4242C21364DC9, 0x6B75B64A66098, 0x0033C0102C085, 0x1921A316BAEBD } },
+		{ { 0x2AD9AD9F3C18B, 0x5EC1638339AEB, 0x5703B6559A83B, 0x3FA9F4D05D612, 0x7B049DECA062C },
+		  { 0x22F7EDFB870FC, 0x569EED677B128, 0x30937DCB0A5AF, 0x758039C78EA1B, 0x6458DF41E273A },
+		  { 0x3E37A35444483, 0x661FDB7D27B99, 0x317761DD621E4, 0x7323C30026189, 0x6093DCCBC2950 } },
+		{ { 0x6EEBE6084034B, 0x6CF01F70A8D7B, 0x0B41A54C6670A, 0x6C84B99BB55DB, 0x6E3180C98B647 },
+		  { 0x39A8585E0706D, 0x3167CE72663FE, 0x63D14ECDB4297, 0x4BE21DCF970B8, 0x57D1EA084827A },
+		  { 0x2B6E7A128B071, 0x5B27511755DCF, 0x08584C2930565, 0x68C7BDA6F4159, 0x363E999DDD97B } },
+		{ { 0x048DCE24BAEC6, 0x2B75795EC05E3, 0x3BFA4C5DA6DC9, 0x1AAC8659E371E, 0x231F979BC6F9B },
+		  { 0x043C135EE1FC4, 0x2A11C9919F2D5, 0x6334CC25DBACD, 0x295DA17B400DA, 0x48EE9B78693A0 },
+		  { 0x1DE4BCC2AF3C6, 0x61FC411A3EB86, 0x53ED19AC12EC0, 0x209DBC6B804E0, 0x079BFA9B08792 } },
+		{ { 0x1ED80A2D54245, 0x70EFEC72A5E79, 0x42151D42A822D, 0x1B5EBB6D631E8, 0x1EF4FB1594706 },
+		  { 0x03A51DA300DF4, 0x467B52B561C72, 0x4D5920210E590, 0x0CA769E789685, 0x038C77F684817 },
+		  { 0x65EE65B167BEC, 0x052DA19B850A9, 0x0408665656429, 0x7AB39596F9A4C, 0x575EE92A4A0BF } },
+		{ { 0x6BC450AA4D801, 0x4F4A6773B0BA8, 0x6241B0B0EBC48, 0x40D9C4F1D9315, 0x200A1E7E382F5 },
+		  { 0x080908A182FCF, 0x0532913B7BA98, 0x3DCCF78C385C3, 0x68002DD5EABA9, 0x43D4E7112CD3F },
+		  { 0x5B967EAF93AC5, 0x360ACCA580A31, 0x1C65FD5C6F262, 0x71C7F15C2ECAB, 0x050ECA52651E4 } },
+		{ { 0x4397660E668EA, 0x7C2A75692F2F5, 0x3B29E7E6C66EF, 0x72BA658BCDA9A, 0x6151C09FA131A },
+		  { 0x31ADE453F0C9C, 0x3DFEE07737868, 0x611ECF7A7D411, 0x2637E6CBD64F6, 0x4B0EE6C21C58F },
+		  { 0x55C0DFDF05D96, 0x405569DCF475E, 0x05C5C277498BB, 0x18588D95DC389, 0x1FEF24FA800F0 } },
+	},
+	{
+		{ { 0x2AFF530976B86, 0x0D85A48C0845A, 0x796EB963642E0, 0x60BEE50C4B626, 0x28005FE6C8340 },
+		  { 0x653FB1AA73196, 0x607FAEC8306FA, 0x4E85EC83E5254, 0x09F56900584FD, 0x544D49292FC86 },
+		  { 0x7BA9F34528688, 0x284A20FB42D5D, 0x3652CD9706FFE, 0x6FD7BADDDE6B3, 0x72E472930F316 } },
+		{ { 0x3F635D32A7627, 0x0CBECACDE00FE, 0x3411141EAA936, 0x21C1E42F3CB94, 0x1FEE7F000FE06 },
+		  { 0x5208C9781084F, 0x16468A1DC24D2, 0x7BF780AC540A8, 0x1A67ECED75301, 0x5A9D2E8C2733A },
+		  { 0x305DA03DBF7E5, 0x1228699B7AECA, 0x12A23B2936BC9, 0x2A1BDA56AE6E9, 0x00F94051EE040 } },
+		{ { 0x793BB07AF9753, 0x1E7B6ECD4FAFD, 0x02C7B1560FB43, 0x2296734CC5FB7, 0x47B7FFD25DD40 },
+		  { 0x56B23C3D330B2, 0x37608E360D1A6, 0x10AE0F3C8722E, 0x086D9B618B637, 0x07D79C7E8BEAB },
+		  { 0x3FB9CBC08DD12, 0x75C3DD85370FF, 0x47F06FE2819AC, 0x5DB06AB9215ED, 0x1C3520A35EA64 } },
+		{ { 0x06F40216BC059, 0x3A2579B0FD9B5, 0x71C26407EEC8C, 0x72ADA4AB54F0B, 0x38750C3B66D12 },
+		  { 0x253A6BCCBA34A, 0x427070433701A, 0x20B8E58F9870E, 0x337C861DB00CC, 0x1C3D05775D0EE },
+		  { 0x6F1409422E51A, 0x7856BBECE2D25, 0x13380A72F031C, 0x43E1080A7F3BA, 0x0621E2C7D3304 } },
+		{ { 0x61796B0DBF0F3, 0x73C2F9C32D6F5, 0x6AA8ED1537EBE, 0x74E92C91838F4, 0x5D8E589CA1002 },
+		  { 0x060CC8259838D, 0x038D3F35B95F3, 0x56078C243A923, 0x2DE3293241BB2, 0x0007D6097BD3A },
+		  { 0x71D950842A94B, 0x46B11E5C7D817, 0x5478BBECB4F0D, 0x7C3054B0A1C5D, 0x1583D7783C1CB } },
+		{ { 0x34704CC9D28C7, 0x3DEE598B1F200, 0x16E1C98746D9E, 0x4050B7095AFDF, 0x4958064E83C55 },
+		  { 0x6A2EF5DA27AE1, 0x28AACE02E9D9D, 0x02459E965F0E8, 0x7B864D3150933, 0x252A5F2E81ED8 },
+		  { 0x094265066E80D, 0x0A60F918D61A5, 0x0444BF7F30FDE, 0x1C40DA9ED3C06, 0x079C170BD843B } },
+		{ { 0x6CD50C0D5D056, 0x5B7606AE779BA, 0x70FBD226BDDA1, 0x5661E53391FF9, 0x6768C0D7317B8 },
+		  { 0x6ECE464FA6FFF, 0x3CC40BCA460A0, 0x6E3A90AFB8D0C, 0x5801ABCA11228, 0x6DEC05E34AC9F },
+		  { 0x625E5F155C1B3, 0x4F32F6F723296, 0x5AC980105EFCE, 0x17A61165EEE36, 0x51445E14DDCD5 } },
+		{ { 0x147AB2BBEA455, 0x1F240F2253126, 0x0C3DE9E314E89, 0x21EA5A4FCA45F, 0x12E990086E4FD },
+		  { 0x02B4B3B144951, 0x5688977966AEA, 0x18E176E399FFD, 0x2E45C5EB4938B, 0x13186F31E3929 },
+		  { 0x496B37FDFBB2E, 0x3C2439D5F3E21, 0x16E60FE7E6A4D, 0x4D7EF889B621D, 0x77B2E3F05D3E9 } },
+	},
+	{
+		{ { 0x0639C12DDB0A4, 0x6180490CD7AB3, 0x3F3918297467C, 0x74568BE1781AC, 0x07A195152E095 },
+		  { 0x7A9C59C2EC4DE, 0x7E9F09E79652D, 0x6A3E422F22D86, 0x2AE8E3B836C8B, 0x63B795FC7AD32 },
+		  { 0x68F02389E5FC8, 0x059F1BC877506, 0x504990E410CEC, 0x09BD7D0FEAEE2, 0x3E8FE83D032F0 } },
+		{ { 0x04C8DE8EFD13C, 0x1C67C06E6210E, 0x183378F7F146A, 0x64352CEAED289, 0x22D60899A6258 },
+		  { 0x315B90570A294, 0x60CE108A925F1, 0x6EFF61253C909, 0x003EF0E2D70B0, 0x75BA3B797FAC4 },
+		  { 0x1DBC070CDD196, 0x16D8FB1534C47, 0x500498183FA2A, 0x72F59C423DE75, 0x0904D07B87779 } },
+		{ { 0x22D6648F940B9, 0x197A5A1873E86, 0x207E4C41A54BC, 0x5360B3B4BD6D0, 0x6240AACEBAF72 },
+		  { 0x61FD4DDBA919C, 0x7D8E991B55699, 0x61B31473CC76C, 0x7039631E631D6, 0x43E2143FBC1DD },
+		  { 0x4749C5BA295A0, 0x37946FA4B5F06, 0x724C5AB5A51F1, 0x65633789DD3F3, 0x56BDAF238DB40 } },
+		{ { 0x0D36CC19D3BB2, 0x6EC4470D72262, 0x6853D7018A9AE, 0x3AA3E4DC2C8EB, 0x03AA31507E1E5 },
+		  { 0x2B9E3F53533EB, 0x2ADD727A806C5, 0x56955C8CE15A3, 0x18C4F070A290E, 0x1D24A86D83741 },
+		  { 0x47648FFD4CE1F, 0x60A9591839E9D, 0x424D5F38117AB, 0x42CC46912C10E, 0x43B261DC9AEB4 } },
+		{ { 0x13D8B6C951364, 0x4C0017E8F632A, 0x53E559E53F9C4, 0x4B20146886EEA, 0x02B4D5E242940 },
+		  { 0x31E1988BB79BB, 0x7B82F46B3BCAB, 0x0F7A8CE827B41, 0x5E15816177130, 0x326055CF5B276 },
+		  { 0x155CB28D18DF2, 0x0C30D9CA11694, 0x2090E27AB3119, 0x208624E7A49B6, 0x27A6C809AE5D3 } },
+		{ { 0x4270AC43D6954, 0x2ED4CD95659A5, 0x75C0DB37528F9, 0x2CCBCFD2C9234, 0x221503603D8C2 },
+		  { 0x6EBCD1F0DB188, 0x74CEB4B7D1174, 0x7D56168DF4F5C, 0x0BF79176FD18A, 0x2CB67174FF60A },
+		  { 0x6CDF9390BE1D0, 0x08E519C7E2B3D, 0x253C3D2A50881, 0x21B41448E333D, 0x7B1DF4B73890F } },
+		{ { 0x6221807F8F58C, 0x3FA92813A8BE5, 0x6DA98C38D5572, 0x01ED95554468F, 0x68698245D352E },
+		  { 0x2F2E0B3B2A224, 0x0C56AA22C1C92, 0x5FDEC39F1B278, 0x4C90AF5C7F106, 0x61FCEF2658FC5 },
+		  { 0x15D852A18187A, 0x270DBB59AFB76, 0x7DB120BCF92AB, 0x0E7A25D714087, 0x46CF4C473DAF0 } },
+		{ { 0x46EA7F1498140, 0x70725690A8427, 0x0A73AE9F079FB, 0x2DD924461C62B, 0x1065AAE50D8CC },
+		  { 0x525ED9EC4E5F9, 0x022D20660684C, 0x7972B70397B68, 0x7A03958D3F965, 0x29387BCD14EB5 },
+		  { 0x44525DF200D57, 0x2D7F94CE94385, 0x60D00C170ECB7, 0x38B0503F3D8F0, 0x69A198E64F1CE } },
+	},
+	{
+		{ { 0x14434DCC5CAED, 0x2C7909F667C20, 0x61A839D1FB576, 0x4F23800CABB76, 0x25B2697BD267F },
+		  { 0x2B2E0D91A78BC, 0x3990A12CCF20C, 0x141C2E11F2622, 0x0DFCEFAA53320, 0x7369E6A92493A },
+		  { 0x73FFB13986864, 0x3282BB8F713AC, 0x49CED78F297EF, 0x6697027661DEF, 0x1420683DB54E4 } },
+		{ { 0x6BB6FC1CC5AD0, 0x532C8D591669D, 0x1AF794DA86C33, 0x0E0E9D86D24D3, 0x31E83B4161D08 },
+		  { 0x0BD1E249DD197, 0x00BCB1820568F, 0x2EAB1718830D4, 0x396FD816997E6, 0x60B63BEBF508A },
+		  { 0x0C7129E062B4F, 0x1E526415B12FD, 0x461A0FD27923D, 0x18BADF670A5B7, 0x55CF1EB62D550 } },
+		{ { 0x6B5E37DF58C52, 0x3BCF33986C60E, 0x44FB8835CEAE7, 0x099DEC18E71A4, 0x1A56FBAA62BA0 },
+		  { 0x1101065C23D58, 0x5AA1290338B0F, 0x3157E9E2E7421, 0x0EA712017D489, 0x669A656457089 },
+		  { 0x66B505C9DC9EC, 0x774EF86E35287, 0x4D1D944C0955E, 0x52E4C39D72B20, 0x13C4836799C58 } },
+		{ { 0x4FB6A5D8BD080, 0x58AE34908589B, 0x3954D977BAF13, 0x413EA597441DC, 0x50BDC87DC8E5B },
+		  { 0x25D465AB3E1B9, 0x0F8FE27EC2847, 0x2D6E6DBF04F06, 0x3038CFC1B3276, 0x66F80C93A637B },
+		  { 0x537836EDFE111, 0x2BE02357B2C0D, 0x6DCEE58C8D4F8, 0x2D732581D6192, 0x1DD56444725FD } },
+		{ { 0x7E60008BAC89A, 0x23D5C387C1852, 0x79E5DF1F533A8, 0x2E6F9F1C5F0CF, 0x3A3A450F63A30 },
+		  { 0x47FF83362127D, 0x08E39AF82B1F4, 0x488322EF27DAB, 0x1973738A2A1A4, 0x0E645912219F7 },
+		  { 0x72F31D8394627, 0x07BD294A200F1, 0x665BE00E274C6, 0x43DE8F1B6368B, 0x318C8D9393A9A } },
+		{ { 0x69E29AB1DD398, 0x30685B3C76BAC, 0x565CF37F24859, 0x57B2AC28EFEF9, 0x509A41C325950 },
+		  { 0x45D032AFFFE19, 0x12FE49B6CDE4E, 0x21663BC327CF1, 0x18A5E4C69F1DD, 0x224C7C679A1D5 },
+		  { 0x06EDCA6F925E9, 0x68C8363E677B8, 0x60CFA25E4FBCF, 0x1C4C17609404E, 0x05BFF02328A11 } },
+		{ { 0x1A0DD0DC512E4, 0x10894BF5FCD10, 0x52949013F9C37, 0x1F50FBA4735C7, 0x576277CDEE01A },
+		  { 0x2137023CAE00B, 0x15A3599EB26C6, 0x0687221512B3C, 0x253CB3A0824E9, 0x780B8CC3FA2A4 },
+		  { 0x38ABC234F305F, 0x7A280BBC103DE, 0x398A836695DFE, 0x3D0AF41528A1A, 0x5FF418726271B } },
+		{ { 0x347E813B69540, 0x76864C21C3CBB, 0x1E049DBCD74A8, 0x5B4D60F93749C, 0x29D4DB8CA0A0C },
+		  { 0x6080C1789DB9D, 0x4BE7CEF1EA731, 0x2F40D769D8080, 0x35F7D4C44A603, 0x106A03DC25A96 },
+		  { 0x50AAF333353D0, 0x4B59A613CBB35, 0x223DFC0E19A76, 0x77D1E2BB2C564, 0x4AB38A51052CB } },
+	},
+	{
+		{ { 0x7D1EF5FDDC09C, 0x7BEEAEBB9DAD9, 0x058D30BA0ACFB, 0x5CD92EAB5AE90, 0x3041C6BB04ED2 },
+		  { 0x42B256768D593, 0x2E88459427B4F, 0x02B3876630701, 0x34878D405EAE5, 0x29CDD1ADC088A },
+		  { 0x2F2F9D956E148, 0x6B3E6AD65C1FE, 0x5B00972B79E5D, 0x53D8D234C5DAF, 0x104BBD6814049 } },
+		{ { 0x59A5FD67FF163, 0x3A998EAD0352B, 0x083C95FA4AF9A, 0x6FADBFC01266F, 0x204F2A20FB072 },
+		  { 0x0FD3168F1ED67, 0x1BB0DE7784A3E, 0x34BCB78B20477, 0x0A4A26E2E2182, 0x5BE8CC57092A7 },
+		  { 0x43B3D30EBB079, 0x357ACA5C61902, 0x5B570C5D62455, 0x30FB29E1E18C7, 0x2570FB17C2791 } },
+		{ { 0x6A9550BB8245A, 0x511F20A1A2325, 0x29324D7239BEE, 0x3343CC37516C4, 0x241C5F91DE018 },
+		  { 0x2367F2CB61575, 0x6C39AC04D87DF, 0x6D4958BD7E5BD, 0x566F4638A1532, 0x3DCB65EA53030 },
+		  { 0x0172940DE6CAA, 0x6045B2E67451B, 0x56C07463EFCB3, 0x0728B6BFE6E91, 0x08420EDD5FCDF } },
+		{ { 0x0C34E04F410CE, 0x344EDC0D0A06B, 0x6E45486D84D6D, 0x44E2ECB3863F5, 0x04D654F321DB8 },
+		  { 0x720AB8362FA4A, 0x29C4347CDD9BF, 0x0E798AD5F8463, 0x4FEF18BCB0BFE, 0x0D9A53EFBC176 },
+		  { 0x5C116DDBDB5D5, 0x6D1B4BBA5ABCF, 0x4D28A48A5537A, 0x56B8E5B040B99, 0x4A7A4F2618991 } },
+		{ { 0x3B291AF372A4B, 0x60E3028FE4498, 0x2267BCA4F6A09, 0x719EEC242B243, 0x4A96314223E0E },
+		  { 0x718025FB15F95, 0x68D6B8371FE94, 0x3804448F7D97C, 0x42466FE784280, 0x11B50C4CDDD31 },
+		  { 0x0274408A4FFD6, 0x7D382AEDB34DD, 0x40ACFC9CE385D, 0x628BB99A45B1E, 0x4F4BCE4DCE6BC } },
+		{ { 0x2616EC49D0B6F, 0x1F95D8462E61C, 0x1AD3E9B9159C6, 0x79BA475A04DF9, 0x3042CEE561595 },
+		  { 0x7CE5AE2242584, 0x2D25EB153D4E3, 0x3A8F3D09BA9C9, 0x0F3690D04EB8E, 0x73FCDD14B71C0 },
+		  { 0x67079449BAC41, 0x5B79C4621484F, 0x61069F2156B8D, 0x0EB26573B10AF, 0x389E740C9A9CE } },
+		{ { 0x578F6570EAC28, 0x644F2339C3937, 0x66E47B7956C2C, 0x34832FE1F55D0, 0x25C425E5D6263 },
+		  { 0x4B3AE34DCB9CE, 0x47C691A15AC9F, 0x318E06E5D400C, 0x3C422D9F83EB1, 0x61545379465A6 },
+		  { 0x606A6F1D7DE6E, 0x4F1C0C46107E7, 0x229B1DCFBE5D8, 0x3ACC60A7B1327, 0x6539A08915484 } },
+		{ { 0x4DBD414BB4A19, 0x7930849F1DBB8, 0x329C5A466CAF0, 0x6C824544FEB9B, 0x0F65320EF019B },
+		  { 0x21F74C3D2F773, 0x024B88D08BD3A, 0x6E678CF054151, 0x43631272E747C, 0x11C5E4AAC5CD1 },
+		  { 0x6D1B1CAFDE0C6, 0x462C76A303A90, 0x3CA4E693CFF9B, 0x3952CD45786FD, 0x4CABC7BDEC330 } },
+	},
+	{
+		{ { 0x7788F3F78D289, 0x5942809B3F811, 0x5973277F8C29C, 0x010F93BC5FE67, 0x7EE498165ACB2 },
+		  { 0x69624089C0A2E, 0x0075FC8E70473, 0x13E84AB1D2313, 0x2C10BEDF6953B, 0x639B93F0321C8 },
+		  { 0x508E39111A1C3, 0x290120E912F7A, 0x1CBF464ACAE43, 0x15373E9576157, 0x0EDF493C85B60 } },
+		{ { 0x7C4D284764113, 0x7FEFEBF06ACEC, 0x39AFB7A824100, 0x1B48E47E7FD65, 0x04C00C54D1DFA },
+		  { 0x48158599B5A68, 0x1FD75BC41D5D9, 0x2D9FC1FA95D3C, 0x7DA27F20EBA11, 0x403B92E3019D4 },
+		  { 0x22F818B465CF8, 0x342901DFF09B8, 0x31F595DC683CD, 0x37A57745FD682, 0x355BB12AB2617 } },
+		{ { 0x1DAC75A8C7318, 0x3B679D5423460, 0x6B8FCB7B6400E, 0x6C73783BE5F9D, 0x7518EAF8E052A },
+		  { 0x664CC7493BBF4, 0x33D94761874E3, 0x0179E1796F613, 0x1890535E2867D, 0x0F9B8132182EC },
+		  { 0x059C41B7F6C32, 0x79E8706531491, 0x6C747643CB582, 0x2E20C0AD494E4, 0x47C3871BBB175 } },
+		{ { 0x65D50C85066B0, 0x6167453361F7C, 0x06BA3818BB312, 0x6AFF29BAA7522, 0x08FEA02CE8D48 },
+		  { 0x4539771EC4F48, 0x7B9318BADCA28, 0x70F19AFE016C5, 0x4EE7BB1608D23, 0x00B89B8576469 },
+		  { 0x5DD7668DEEAD0, 0x4096D0BA47049, 0x6275997219114, 0x29BDA8A67E6AE, 0x473829A74F75D } },
+		{ { 0x1533AAD3902C9, 0x1DDE06B11E47B, 0x784BED1930B77, 0x1C80A92B9C867, 0x6C668B4D44E4D },
+		  { 0x2DA754679C418, 0x3164C31BE105A, 0x11FAC2B98EF5F, 0x35A1AAF779256, 0x2078684C4833C },
+		  { 0x0CF217A78820C, 0x65024E7D2E769, 0x23BB5EFDDA82A, 0x19FD4B632D3C6, 0x7411A6054F8A4 } },
+		{ { 0x2E53D18B175B4, 0x33E7254204AF3, 0x3BCD7D5A1C4C5, 0x4C7C22AF65D0F, 0x1EC9A872458C3 },
+		  { 0x59D32B99DC86D, 0x6AC075E22A9AC, 0x30B9220113371, 0x27FD9A638966E, 0x7C136574FB813 },
+		  { 0x6A4D400A2509B, 0x041791056971C, 0x655D5866E075C, 0x2302BF3E64DF8, 0x3ADD88A5C7CD6 } },
+		{ { 0x298D459393046, 0x30BFECB3D90B8, 0x3D9B8EA3DF8D6, 0x3900E96511579, 0x61BA1131A406A },
+		  { 0x15770B635DCF2, 0x59ECD83F79571, 0x2DB461C0B7FBD, 0x73A42A981345F, 0x249929FCCC879 },
+		  { 0x0A0F116959029, 0x5974FD7B1347A, 0x1E0CC1C08EDAD, 0x673BDF8AD1F13, 0x5620310CBBD8E } },
+		{ { 0x6B5F477E285D6, 0x4ED91EC326CC8, 0x6D6537503A3FD, 0x626D3763988D5, 0x7EC846F3658CE },
+		  { 0x193434934D643, 0x0D4A2445EAA51, 0x7D0708AE76FE0, 0x39847B6C3C7E1, 0x37676A2A4D9D9 },
+		  { 0x68F3F1DA22EC7, 0x6ED8039A2736B, 0x2627EE04C3C75, 0x6EA90A647E7D1, 0x6DAAF723399B9 } },
+	},
+	{
+		{ { 0x304BFACAD8EA2, 0x502917D108B07, 0x043176CA6DD0F, 0x5D5158F2C1D84, 0x2B5449E58EB3B },
+		  { 0x27562EB3DBE47, 0x291D7B4170BE7, 0x5D1CA67DFA8E1, 0x2A88061F298A2, 0x1304E9E71627D },
+		  { 0x014D26ADC9CFE, 0x7F1691BA16F13, 0x5E71828F06EAC, 0x349ED07F0FFFC, 0x4468DE2D7C2DD } },
+		{ { 0x2D8C6F86307CE, 0x6286BA1850973, 0x5E9DCB08444D4, 0x1A96A543362B2, 0x5DA6427E63247 },
+		  { 0x3355E9419469E, 0x1847BB8EA8A37, 0x1FE6588CF9B71, 0x6B1C9D2DB6B22, 0x6CCE7C6FFB44B },
+		  { 0x4C688DEAC22CA, 0x6F775C3FF0352, 0x565603EE419BB, 0x6544456C61C46, 0x58F29ABFE79F2 } },
+		{ { 0x264BF710ECDF6, 0x708C58527896B, 0x42CEAE6C53394, 0x4381B21E82B6A, 0x6AF93724185B4 },
+		  { 0x6CFAB8DE73E68, 0x3E6EFCED4BD21, 0x0056609500DBE, 0x71B7824AD85DF, 0x577629C4A7F41 },
+		  { 0x0024509C6A888, 0x2696AB12E6644, 0x0CCA27F4B80D8, 0x0C7C1F11B119E, 0x701F25BB0CAEC } },
+		{ { 0x0F6D97CBEC113, 0x4CE97FB7C93A3, 0x139835A11281B, 0x728907ADA9156, 0x720A5BC050955 },
+		  { 0x0B0F8E4616CED, 0x1D3C4B50FB875, 0x2F29673DC0198, 0x5F4B0F1830FFA, 0x2E0C92BFBDC40 },
+		  { 0x709439B805A35, 0x6EC48557F8187, 0x08A4D1BA13A2C, 0x076348A0BF9AE, 0x0E9B9CBB144EF } },
+		{ { 0x69BD55DB1BEEE, 0x6E14E47F731BD, 0x1A35E47270EAC, 0x66F225478DF8E, 0x366D44191CFD3 },
+		  { 0x2D48FFB5720AD, 0x57B7F21A1DF77, 0x5550EFFBA0645, 0x5EC6A4098A931, 0x221104EB3F337 },
+		  { 0x41743F2BC8C14, 0x796B0AD8773C7, 0x29FEE5CBB689B, 0x122665C178734, 0x4167A4E6BC593 } },
+		{ { 0x62665F8CE8FEE, 0x29D101AC59857, 0x4D93BBBA59FFC, 0x17B7897373F17, 0x34B33370CB7ED },
+		  { 0x39D2876F62700, 0x001CECD1D6C87, 0x7F01A11747675, 0x2350DA5A18190, 0x7938BB7E22552 },
+		  { 0x591EE8681D6CC, 0x39DB0B4EA79B8, 0x202220F380842, 0x2F276BA42E0AC, 0x1176FC6E2DFE6 } },
+		{ { 0x0E28949770EB8, 0x5559E88147B72, 0x35E1E6E63EF30, 0x35B109AA7FF6F, 0x1F6A3E54F2690 },
+		  { 0x76CD05B9C619B, 0x69654B0901695, 0x7A53710B77F27, 0x79A1EA7D28175, 0x08FC3A4C677D5 },
+		  { 0x4C199D30734EA, 0x6C622CB9ACC14, 0x5660A55030216, 0x068F1199F11FB, 0x4F2FAD0116B90 } },
+		{ { 0x4D91DB73BB638, 0x55F82538112C5, 0x6D85A279815DE, 0x740B7B0CD9CF9, 0x3451995F2944E },
+		  { 0x6B24194AE4E54, 0x2230AFDED8897, 0x23412617D5071, 0x3D5D30F35969B, 0x445484A4972EF },
+		  { 0x2FCD09FEA7D7C, 0x296126B9ED22A, 0x4A171012A05B2, 0x1DB92C74D5523, 0x10B89CA604289 } },
+	},
+	{
+		{ { 0x141BE5A45F06E, 0x5ADB38BECAEA7, 0x3FD46DB41F2BB, 0x6D488BBB5CE39, 0x17D2D1D9EF0D4 },
+		  { 0x147499718289C, 0x0A48A67E4C7AB, 0x30FBC544BAFE3, 0x0C701315FE58A, 0x20B878D577B75 },
+		  { 0x2AF18073F3E6A, 0x33AEA420D24FE, 0x298008BF4FF94, 0x3539171DB961E, 0x72214F63CC65C } },
+		{ { 0x5B7B9F43B29C9, 0x149EA31EEA3B3, 0x4BE7713581609, 0x2D87960395E98, 0x1F24AC855A154 },
+		  { 0x37F405307A693, 0x2E5E66CF2B69C, 0x5D84266AE9C53, 0x5E4EB7DE853B9, 0x5FDF48C58171C },
+		  { 0x608328E9505AA, 0x22182841DC49A, 0x3EC96891D2307, 0x2F363FFF22E03, 0x00BA739E2AE39 } },
+		{ { 0x426F5EA88BB26, 0x33092E77F75C8, 0x1A53940D819E7, 0x1132E4F818613, 0x72297DE7D518D },
+		  { 0x698DE5C8790D6, 0x268B8545BEB25, 0x6D2648B96FEDF, 0x47988AD1DB07C, 0x03283A3E67AD7 },
+		  { 0x41DC7BE0CB939, 0x1B16C66100904, 0x0A24C20CBC66D, 0x4A2E9EFE48681, 0x05E1296846271 } },
+		{ { 0x7BBC8242C4550, 0x59A06103B35B7, 0x7237E4AF32033, 0x726421AB3537A, 0x78CF25D38258C },
+		  { 0x2EEB32D9C495A, 0x79E25772F9750, 0x6D747833BBF23, 0x6CDD816D5D749, 0x39C00C9C13698 },
+		  { 0x66B8E31489D68, 0x573857E10E2B5, 0x13BE816AA1472, 0x41964D3AD4BF8, 0x006B52076B3FF } },
+		{ { 0x37E16B9CE082D, 0x1882F57853EB9, 0x7D29EACD01FC5, 0x2E76A59B5E715, 0x7DE2E9561A9F7 },
+		  { 0x0CFE19D95781C, 0x312CC621C453C, 0x145ACE6DA077C, 0x0912BEF9CE9B8, 0x4D57E3443BC76 },
+		  { 0x0D4F4B6A55ECB, 0x7EBB0BB733BCE, 0x7BA6A05200549, 0x4F6EDE4E22069, 0x6B2A90AF1A602 } },
+		{ { 0x3F3245BB2D80A, 0x0E5F720F36EFD, 0x3B9CCCF60C06D, 0x084E323F37926, 0x465812C8276C2 },
+		  { 0x3F4FC9AE61E97, 0x3BC07EBFA2D24, 0x3B744B55CD4A0, 0x72553B25721F3, 0x5FD8F4E9D12D3 },
+		  { 0x3BEB22A1062D9, 0x6A7063B82C9A8, 0x0A5A35DC197ED, 0x3C80C06A53DEF, 0x05B32C2B1CB16 } },
+		{ { 0x4A42C7AD58195, 0x5C8667E799EFF, 0x02E5E74C850A1, 0x3F0DB614E869A, 0x31771A4856730 },
+		  { 0x05ECCD24DA8FD, 0x580BBFDF07918, 0x7E73586873C6A, 0x74CEDDF77F93E, 0x3B5556A37B471 },
+		  { 0x0C524E14DD482, 0x283457496C656, 0x0AD6BCFB6CD45, 0x375D1E8B02414, 0x4FC079D27A733 } },
+		{ { 0x48B440C86C50D, 0x139929CCA3B86, 0x0F8F2E44CDF2F, 0x68432117BA6B2, 0x241170C2BAE3C },
+		  { 0x138B089BF2F7F, 0x4A05BFD34EA39, 0x203914C925EF5, 0x7497FFFE04E3C, 0x124567CECAF98 },
+		  { 0x1AB860AC473B4, 0x5C0227C86A7FF, 0x71B12BFC24477, 0x006A573A83075, 0x3F8612966C870 } },
+	},
+	{
+		{ { 0x0FCFA36048D13, 0x66E7133BBB383, 0x64B42A8A45676, 0x4EA6E4F9A85CF, 0x26F57EEE878A1 },
+		  { 0x20CC9782A0DDE, 0x65D4E3070AAB3, 0x7BC8E31547736, 0x09EBFB1432D98, 0x504AA77679736 },
+		  { 0x32CD55687EFB1, 0x4448F5E2F6195, 0x568919D460345, 0x034C2E0AD1A27, 0x4041943D9DBA3 } },
+		{ { 0x17743A26CAADD, 0x48C9156F9C964, 0x7EF278D1E9AD0, 0x00CE58EA7BD01, 0x12D931429800D },
+		  { 0x0EEBA43EBCC96, 0x384DD5395F878, 0x1DF331A35D272, 0x207ECFD4AF70E, 0x1420A1D976843 },
+		  { 0x67799D337594F, 0x01647548F6018, 0x57FCE5578F145, 0x009220C142A71, 0x1B4F92314359A } },
+		{ { 0x73030A49866B1, 0x2442BE90B2679, 0x77BD3D8947DCF, 0x1FB55C1552028, 0x5FF191D56F9A2 },
+		  { 0x4109D89150951, 0x225BD2D2D47CB, 0x57CC080E73BEA, 0x6D71075721FCB, 0x239B572A7F132 },
+		  { 0x6D433AC2D9068, 0x72BF930A47033, 0x64FACF4A20EAD, 0x365F7A2B9402A, 0x020C526A758F3 } },
+		{ { 0x1EF59F042CC89, 0x3B1C24976DD26, 0x31D665CB16272, 0x28656E470C557, 0x452CFE0A5602C },
+		  { 0x034F89ED8DBBC, 0x73B8F948D8EF3, 0x786C1D323CAAB, 0x43BD4A9266E51, 0x02AACC4615313 },
+		  { 0x0F7A0647877DF, 0x4E1CC0F93F0D4, 0x7EC4726EF1190, 0x3BDD58BF512F8, 0x4CFB7D7B304B8 } },
+		{ { 0x699C29789EF12, 0x63BEAE321BC50, 0x325C340ADBB35, 0x562E1A1E42BF6, 0x5B1D4CBC434D3 },
+		  { 0x43D6CB89B75FE, 0x3338D5B900E56, 0x38D327D531A53, 0x1B25C61D51B9F, 0x14B4622B39075 },
+		  { 0x32615CC0A9F26, 0x57711B99CB6DF, 0x5A69C14E93C38, 0x6E88980A4C599, 0x2F98F71258592 } },
+		{ { 0x2AE444F54A701, 0x615397AFBC5C2, 0x60D7783F3F8FB, 0x2AA675FC486BA, 0x1D8062E9E7614 },
+		  { 0x4A74CB50F9E56, 0x531D1C2640192, 0x0C03D9D6C7FD2, 0x57CCD156610C1, 0x3A6AE249D806A },
+		  { 0x2DA85A9907C5A, 0x6B23721EC4CAF, 0x4D2D3A4683AA2, 0x7F9C6870EFDEF, 0x298B8CE8AEF25 } },
+		{ { 0x272EA0A2165DE, 0x68179EF3ED06F, 0x4E2B9C0FEAC1E, 0x3EE290B1B63BB, 0x6BA6271803A7D },
+		  { 0x27953EFF70CB2, 0x54F22AE0EC552, 0x29F3DA92E2724, 0x242CA0C22BD18, 0x34B8A8404D5CE },
+		  { 0x6ECB583693335, 0x3EC76BFDFB84D, 0x2C895CF56A04F, 0x6355149D54D52, 0x71D62BDD465E1 } },
+		{ { 0x5B5DAB1F75EF5, 0x1E2D60CBEB9A5, 0x527C2175DFE57, 0x59E8A2B8FF51F, 0x1C333621262B2 },
+		  { 0x3CC28D378DF80, 0x72141F4968CA6, 0x407696BDB6D0D, 0x5D271B22FFCFB, 0x74D5F317F3172 },
+		  { 0x7E55467D9CA81, 0x6A5653186F50D, 0x6B188ECE62DF1, 0x4C66D36844971, 0x4AEBCC4547E9D } },
+	},
+	{
+		{ { 0x08D9E7354B610, 0x26B750B6DC168, 0x162881E01ACC9, 0x7966DF31D01A5, 0x173BD9DDC9A1D },
+		  { 0x0071B276D01C9, 0x0B0D8918E025E, 0x75BEEA79EE2EB, 0x3C92984094DB8, 0x5D88FBF95A3DB },
+		  { 0x00F1EFE5872DF, 0x5DA872318256A, 0x59CEB81635960, 0x18CF37693C764, 0x06E1CD13B19EA } },
+		{ { 0x3AF629E5B0353, 0x204F1A088E8E5, 0x10EFC9CEEA82E, 0x589863C2FA34B, 0x7F3A6A1A8D837 },
+		  { 0x0AD516F166F23, 0x263F56D57C81A, 0x13422384638CA, 0x1331FF1AF0A50, 0x3080603526E16 },
+		  { 0x644395D3D800B, 0x2B9203DBEDEFC, 0x4B18CE656A355, 0x03F3466BC182C, 0x30D0FDED2E513 } },
+		{ { 0x4971E68B84750, 0x52CCC9779F396, 0x3E904AE8255C8, 0x4ECAE46F39339, 0x4615084351C58 },
+		  { 0x14D1AF21233B3, 0x1DE1989B39C0B, 0x52669DC6F6F9E, 0x43434B28C3FC7, 0x0A9214202C099 },
+		  { 0x019C0AEB9A02E, 0x1A2C06995D792, 0x664CBB1571C44, 0x6FF0736FA80B2, 0x3BCA0D2895CA5 } },
+		{ { 0x08EB69ECC01BF, 0x5B4C8912DF38D, 0x5EA7F8BC2F20E, 0x120E516CAAFAF, 0x4EA8B4038DF28 },
+		  { 0x031BC3C5D62A4, 0x7D9FE0F4C081E, 0x43ED51467F22C, 0x1E6CC0C1ED109, 0x5631DEDDAE8F1 },
+		  { 0x5460AF1CAD202, 0x0B4919DD0655D, 0x7C4697D18C14C, 0x231C890BBA2A4, 0x24CE0930542CA } },
+		{ { 0x7A155FDF30B85, 0x1C6C6E5D487F9, 0x24BE1134BDC5A, 0x1405970326F32, 0x549928A7324F4 },
+		  { 0x090F5FD06C106, 0x6ABB1021E43FD, 0x232BCFAD711A0, 0x3A5C13C047F37, 0x41D4E3C28A06D },
+		  { 0x632A763EE1A2E, 0x6FA4BFFBD5E4D, 0x5FD35A6BA4792, 0x7B55E1DE99DE8, 0x491B66DEC0DCF } },
+		{ { 0x04A8ED0DA64A1, 0x5ECFC45096EBE, 0x5EDEE93B488B2, 0x5B3C11A51BC8F, 0x4CF6B8B0B7018 },
+		  { 0x5B13DC7EA32A7, 0x18FC2DB73131E, 0x7E3651F8F57E3, 0x25656055FA965, 0x08F338D0C85EE },
+		  { 0x3A821991A73BD, 0x03BE6418F5870, 0x1DDC18EAC9EF0, 0x54CE09E998DC2, 0x530D4A82EB078 } },
+		{ { 0x173456C9ABF9E, 0x7892015100DAD, 0x33EE14095FECB, 0x6AD95D67A0964, 0x0DB3E7E00CBFB },
+		  { 0x43630E1F94825, 0x4D1956A6B4009, 0x213FE2DF8B5E0, 0x05CE3A41191E6, 0x65EA753F10177 },
+		  { 0x6FC3EE2096363, 0x7EC36B96D67AC, 0x510EC6A0758B1, 0x0ED87DF022109, 0x02A4EC1921E1A } },
+		{ { 0x06162F1CF795F, 0x324DDCAFE5EB9, 0x018D5E0463218, 0x7E78B9092428E, 0x36D12B5DEC067 },
+		  { 0x6259A3B24B8A2, 0x188B5F4170B9C, 0x681C0DEE15DEB, 0x4DFE665F37445, 0x3D143C5112780 },
+		  { 0x5279179154557, 0x39F8F0741424D, 0x45E6EB357923D, 0x42C9B5EDB746F, 0x2EF517885BA82 } },
+	},
+	{
+		{ { 0x6BFFB305B2F51, 0x5B112B2D712DD, 0x35774974FE4E2, 0x04AF87A96E3A3, 0x57968290BB3A0 },
+		  { 0x7974E8C58AEDC, 0x7757E083488C6, 0x601C62AE7BC8B, 0x45370C2ECAB74, 0x2F1B78FAB143A },
+		  { 0x2B8430A20E101, 0x1A49E1D88FEE3, 0x38BBB47CE4D96, 0x1F0E7BA84D437, 0x7DC43E35DC2AA } },
+		{ { 0x02A5C273E9718, 0x32BC9DFB28B4F, 0x48DF4F8D5DB1A, 0x54C87976C028F, 0x044FB81D82D50 },
+		  { 0x66665887DD9C3, 0x629760A6AB0B2, 0x481E6C7243E6C, 0x097E37046FC77, 0x7EF72016758CC },
+		  { 0x718C5A907E3D9, 0x3B9C98C6B383B, 0x006ED255ECCDC, 0x6976538229A59, 0x7F79823F9C30D } },
+		{ { 0x41FF068F587BA, 0x1C00A191BCD53, 0x7B56F9C209E25, 0x3781E5FCCAABE, 0x64A9B0431C06D },
+		  { 0x4D239A3B513E8, 0x29723F51B1066, 0x642F4CF04D9C3, 0x4DA095AA09B7A, 0x0A4E0373D784D },
+		  { 0x3D6A15B7D2919, 0x41AA75046A5D6, 0x691751EC2D3DA, 0x23638AB6721C4, 0x071A7D0ACE183 } },
+		{ { 0x4355220E14431, 0x0E1362A283981, 0x2757CD8359654, 0x2E9CD7AB10D90, 0x7C69BCF761775 },
+		  { 0x72DAAC887BA0B, 0x0B7F4AC5DDA60, 0x3BDDA2C0498A4, 0x74E67AA180160, 0x2C3BCC7146EA7 },
+		  { 0x0D7EB04E8295F, 0x4A5EA1E6FA0FE, 0x45E635C436C60, 0x28EF4A8D4D18B, 0x6F5A9A7322ACA } },
+		{ { 0x1D4EBA3D944BE, 0x0100F15F3DCE5, 0x61A700E367825, 0x5922292AB3D23, 0x02AB9680EE8D3 },
+		  { 0x1000C2F41C6C5, 0x0219FDF737174, 0x314727F127DE7, 0x7E5277D23B81E, 0x494E21A2E147A },
+		  { 0x48A85DDE50D9A, 0x1C1F734493DF4, 0x47BDB64866889, 0x59A7D048F8EEC, 0x6B5D76CBEA46B } },
+		{ { 0x141171E782522, 0x6806D26DA7C1F, 0x3F31D1BC79AB9, 0x09F20459F5168, 0x16FB869C03DD3 },
+		  { 0x7556CEC0CD994, 0x5EB9A03B7510A, 0x50AD1DD91CB71, 0x1AA5780B48A47, 0x0AE333F685277 },
+		  { 0x6199733B60962, 0x69B157C266511, 0x64740F893F1CA, 0x03AA408FBF684, 0x3F81E38B8F70D } },
+		{ { 0x37F355F17C824, 0x07AE85334815B, 0x7E3ABDDD2E48F, 0x61EEABE1F45E5, 0x0AD3E2D34CDED },
+		  { 0x10FCC7ED9AFFE, 0x4248CB0E96FF2, 0x4311C115172E2, 0x4C9D41CBF6925, 0x50510FC104F50 },
+		  { 0x40FC5336E249D, 0x3386639FB2DE1, 0x7BBF871D17B78, 0x75F796B7E8004, 0x127C158BF0FA1 } },
+		{ { 0x28FC4AE51B974, 0x26E89BFD2DBD4, 0x4E122A07665CF, 0x7CAB1203405C3, 0x4ED82479D167D },
+		  { 0x17C422E9879A2, 0x28A5946C8FEC3, 0x53AB32E912B77, 0x7B44DA09FE0A5, 0x354EF87D07EF4 },
+		  { 0x3B52260C5D975, 0x79D6836171FDC, 0x7D994F140D4BB, 0x1B6C404561854, 0x302D92D205392 } },
+	},
+	{
+		{ { 0x46FB6E4E0F177, 0x53497AD5265B7, 0x1EBDBA01386FC, 0x0302F0CB36A3C, 0x0EDC5F5EB426D },
+		  { 0x3C1A2BCA4283D, 0x23430C7BB2F02, 0x1A3EA1BB58BC2, 0x7265763DE5C61, 0x10E5D3B76F1CA },
+		  { 0x3BFD653DA8E67, 0x584953EC82A8A, 0x55E288FA7707B, 0x5395FC3931D81, 0x45B46C51361CB } },
+		{ { 0x54DDD8A7FE3E4, 0x2CECC41C619D3, 0x43A6562AC4D91, 0x4EFA5ACA7BDD9, 0x5C1C0AEF32122 },
+		  { 0x02ABF314F7FA1, 0x391D19E8A1528, 0x6A2FA13895FC7, 0x09D8EDDEAA591, 0x2177BFA36DCB7 },
+		  { 0x01BBCFA79DB8F, 0x3D84BEB3666E1, 0x20C921D812204, 0x2DD843D3B32CE, 0x4AE619387D8AB } },
+		{ { 0x17E44985BFB83, 0x54E32C626CC22, 0x096412FF38118, 0x6B241D61A246A, 0x75685ABE5BA43 },
+		  { 0x3F6AA5344A32E, 0x69683680F11BB, 0x04C3581F623AA, 0x701AF5875CBA5, 0x1A00D91B17BF3 },
+		  { 0x60933EB61F2B2, 0x5193FE92A4DD2, 0x3D995A550F43E, 0x3556FB93A883D, 0x135529B623B0E } },
+		{ { 0x716BCE22E83FE, 0x33D0130B83EB8, 0x0952ABAD0AFAC, 0x309F64ED31B8A, 0x5972EA051590A },
+		  { 0x0DBD7ADD1D518, 0x119F823E2231E, 0x451D66E5E7DE2, 0x500C39970F838, 0x79B5B81A65CA3 },
+		  { 0x4AC20DC8F7811, 0x29589A9F501FA, 0x4D810D26A6B4A, 0x5EDE00D96B259, 0x4F7E9C95905F3 } },
+		{ { 0x0443D355299FE, 0x39B7D7D5AEE39, 0x692519A2F34EC, 0x6E4404924CF78, 0x1942EEC4A144A },
+		  { 0x74BBC5781302E, 0x73135BB81EC4C, 0x7EF671B61483C, 0x7264614CCD729, 0x31993AD92E638 },
+		  { 0x45319AE234992, 0x2219D47D24FB5, 0x4F04488B06CF6, 0x53AAA9E724A12, 0x2A0A65314EF9C } },
+		{ { 0x61ACD3C1C793A, 0x58B46B78779E6, 0x3369AACBE7AF2, 0x509B0743074D4, 0x055DC39B6DEA1 },
+		  { 0x7937FF7F927C2, 0x0C2FA14C6A5B6, 0x556BDDB6DD07C, 0x6F6ACC179D108, 0x4CF6E218647C2 },
+		  { 0x1227CC28D5BB6, 0x78EE9BFF57623, 0x28CB2241F893A, 0x25B541E3C6772, 0x121A307710AA2 } },
+		{ { 0x1713EC77483C9, 0x6F70572D5FACB, 0x25EF34E22FF81, 0x54D944F141188, 0x527BB94A6CED3 },
+		  { 0x35D5E9F034A97, 0x126069785BC9B, 0x5474EC7854FF0, 0x296A302A348CA, 0x333FC76C7A40E },
+		  { 0x5992A995B482E, 0x78DC707002AC7, 0x5936394D01741, 0x4FBA4281AEF17, 0x6B89069B20A7A } },
+		{ { 0x2FA8CB5C7DB77, 0x718E6982AA810, 0x39E95F81A1A1B, 0x5E794F3646CFB, 0x0473D308A7639 },
+		  { 0x2A0416270220D, 0x75F248B69D025, 0x1CBBC16656A27, 0x5B9FFD6E26728, 0x23BC2103AA73E },
+		  { 0x6792603589E05, 0x248DB9892595D, 0x006A53CAD2D08, 0x20D0150F7BA73, 0x102F73BFDE043 } },
+	},
+	{
+		{ { 0x4DAE0B5511C9A, 0x5257FFFE0D456, 0x54108D1EB2180, 0x096CC0F9BAEFA, 0x3F6BD725DA4EA },
+		  { 0x0B9AB7F5745C6, 0x5CAF0F8D21D63, 0x7DEBEA408EA2B, 0x09EDB93896D16, 0x36597D25EA5C0 },
+		  { 0x58D7B106058AC, 0x3CDF8D20BEE69, 0x00A4CB765015E, 0x36832337C7CC9, 0x7B7ECC19DA60D } },
+		{ { 0x64A51A77CFA9B, 0x29CF470CA0DB5, 0x4B60B6E0898D9, 0x55D04DDFFE6C7, 0x03BEDC661BF5C },
+		  { 0x2373C695C690D, 0x4C0C8520DCF18, 0x384AF4B7494B9, 0x4AB4A8EA22225, 0x4235AD7601743 },
+		  { 0x0CB0D078975F5, 0x292313E530C4B, 0x38DBB9124A509, 0x350D0655A11F1, 0x0E7CE2B0CDF06 } },
+		{ { 0x6FEDFD94B70F9, 0x2383F9745BFD4, 0x4BEAE27C4C301, 0x75AA4416A3F3F, 0x615256138AECE },
+		  { 0x4643AC48C85A3, 0x6878C2735B892, 0x3A53523F4D877, 0x3A504ED8BEE9D, 0x666E0A5D8FB46 },
+		  { 0x3F64E4870CB0D, 0x61548B16D6557, 0x7A261773596F3, 0x7724D5F275D3A, 0x7F0BC810D514D } },
+		{ { 0x49DAD737213A0, 0x745DEE5D31075, 0x7B1A55E7FDBE2, 0x5BA988F176EA1, 0x1D3A907DDEC5A },
+		  { 0x06BA426F4136F, 0x3CAFC0606B720, 0x518F0A2359CDA, 0x5FAE5E46FECA7, 0x0D1F8DBCF8EED },
+		  { 0x693313ED081DC, 0x5B0A366901742, 0x40C872CA4CA7E, 0x6F18094009E01, 0x00011B44A31BF } },
+		{ { 0x61F696A0AA75C, 0x38B0A57AD42CA, 0x1E59AB706FDC9, 0x01308D46EBFCD, 0x63D988A2D2851 },
+		  { 0x7A06C3FC66C0C, 0x1C9BAC1BA47FB, 0x23935C575038E, 0x3F0BD71C59C13, 0x3AC48D916E835 },
+		  { 0x20753AFBD232E, 0x71FBB1ED06002, 0x39CAE47A4AF3A, 0x0337C0B34D9C2, 0x33FAD52B2368A } },
+		{ { 0x4C8D0C422CFE8, 0x760B4275971A5, 0x3DA95BC1CAD3D, 0x0F151FF5B7376, 0x3CC355CCB90A7 },
+		  { 0x649C6C5E41E16, 0x60667EEE6AA80, 0x4179D182BE190, 0x653D9567E6979, 0x16C0F429A256D },
+		  { 0x69443903E9131, 0x16F4AC6F9DD36, 0x2EA4912E29253, 0x2B4643E68D25D, 0x631EAF426BAE7 } },
+		{ { 0x175B9A3700DE8, 0x77C5F00AA48FB, 0x3917785CA0317, 0x05AA9B2C79399, 0x431F2C7F665F8 },
+		  { 0x10410DA66FE9F, 0x24D82DCB4D67D, 0x3E6FE0E17752D, 0x4DADE1ECBB08F, 0x5599648B1EA91 },
+		  { 0x26344858F7B19, 0x5F43D4A295AC0, 0x242A75C52ACD4, 0x5934480220D10, 0x7B04715F91253 } },
+		{ { 0x6C280C4E6BAC6, 0x3ADA3B361766E, 0x42FE5125C3B4F, 0x111D84D4AAC22, 0x48D0ACFA57CDE },
+		  { 0x5BD28ACF6AE43, 0x16FAB8F56907D, 0x7ACB11218D5F2, 0x41FE02023B4DB, 0x59B37BF5C2F65 },
+		  { 0x726E47DABE671, 0x2EC45E746F6C1, 0x6580E53C74686, 0x5EDA104673F74, 0x16234191336D3 } },
+	},
+	{
+		{ { 0x19CD61FF38640, 0x060C6C4B41BA9, 0x75CF70CA7366F, 0x118A8F16C011E, 0x4A25707A203B9 },
+		  { 0x499DEF6267FF6, 0x76E858108773C, 0x693CAC5DDCB29, 0x00311D00A9FF4, 0x2CDFDFECD5D05 },
+		  { 0x7668A53F6ED6A, 0x303BA2E142556, 0x3880584C10909, 0x4FE20000A261D, 0x5721896D248E4 } },
+		{ { 0x55091A1D0DA4E, 0x4F6BFC7C1050B, 0x64E4ECD2EA9BE, 0x07EB1F28BBE70, 0x03C935AFC4B03 },
+		  { 0x65517FD181BAE, 0x3E5772C76816D, 0x019189640898A, 0x1ED2A84DE7499, 0x578EDD74F63C1 },
+		  { 0x276C6492B0C3D, 0x09BFC40BF932E, 0x588E8F11F330B, 0x3D16E694DC26E, 0x3EC2AB590288C } },
+		{ { 0x13A09AE32D1CB, 0x3E81EB85AB4E4, 0x07AACA43CAE1F, 0x62F05D7526374, 0x0E1BF66C6ADBA },
+		  { 0x0D27BE4D87BB9, 0x56C27235DB434, 0x72E6E0EA62D37, 0x5674CD06EE839, 0x2DD5C25A200FC },
+		  { 0x3D5E9792C887E, 0x319724DABBC55, 0x2B97C78680800, 0x7AFDFDD34E6DD, 0x730548B35AE88 } },
+		{ { 0x3094BA1D6E334, 0x6E126A7E3300B, 0x089C0AEFCFBC5, 0x2EEA11F836583, 0x585A2277D8784 },
+		  { 0x551A3CBA8B8EE, 0x3B6422BE2D886, 0x630E1419689BC, 0x4653B07A7A955, 0x3043443B411DB },
+		  { 0x25F8233D48962, 0x6BD8F04AFF431, 0x4F907FD9A6312, 0x40FD3C737D29B, 0x7656278950EF9 } },
+		{ { 0x073A3EA86CF9D, 0x6E0E2ABFB9C2E, 0x60E2A38EA33EE, 0x30B2429F3FE18, 0x28BBF484B613F },
+		  { 0x3CF59D51FC8C0, 0x7A0A0D6DE4718, 0x55C3A3E6FB74B, 0x353135F884FD5, 0x3F4160A8C1B84 },
+		  { 0x12F5C6F136C7C, 0x0FEDBA237DE4C, 0x779BCCEBFAB44, 0x3AEA93F4D6909, 0x1E79CB358188F } },
+		{ { 0x153D8F5E08181, 0x08533BBDB2EFD, 0x1149796129431, 0x17A6E36168643, 0x478AB52D39D1F },
+		  { 0x436C3EEF7E3F1, 0x7FFD3C21F0026, 0x3E77BF20A2DA9, 0x418BFFC8472DE, 0x65D7951B3A3B3 },
+		  { 0x6A4D39252D159, 0x790E35900ECD4, 0x30725BF977786, 0x10A5C1635A053, 0x16D87A411A212 } },
+		{ { 0x4D5E2D54E0583, 0x2E5D7B33F5F74, 0x3A5DE3F887EBF, 0x6EF24BD6139B7, 0x1F990B577A5A6 },
+		  { 0x57E5A42066215, 0x1A18B44983677, 0x3E652DE1E6F8F, 0x6532BE02ED8EB, 0x28F87C8165F38 },
+		  { 0x44EAD1BE8F7D6, 0x5759D4F31F466, 0x0378149F47943, 0x69F3BE32B4F29, 0x45882FE1534D6 } },
+		{ { 0x49929943C6FE4, 0x4347072545B15, 0x3226BCED7E7C5, 0x03A134CED89DF, 0x7DCF843CE405F },
+		  { 0x1345D757983D6, 0x222F54234CCCD, 0x1784A3D8ADBB4, 0x36EBEEE8C2BCC, 0x688FE5B8F626F },
+		  { 0x0D6484A4732C0, 0x7B94AC6532D92, 0x5771B8754850F, 0x48DD9DF1461C8, 0x6739687E73271 } },
+	},
+	{
+		{ { 0x5CC9DC80C1AC0, 0x683671486D4CD, 0x76F5F1A5E8173, 0x6D5D3F5F9DF4A, 0x7DA0B8F68D7E7 },
+		  { 0x02014385675A6, 0x6155FB53D1DEF, 0x37EA32E89927C, 0x059A668F5A82E, 0x46115ABA1D4DC },
+		  { 0x71953C3B5DA76, 0x6642233D37A81, 0x2C9658076B1BD, 0x5A581E63010FF, 0x5A5F887E83674 } },
+		{ { 0x628D3A0A643B9, 0x01CD8640C93D2, 0x0B7B0CAD70F2C, 0x3864DA98144BE, 0x43E37AE2D5D1C },
+		  { 0x301CF70A13D11, 0x2A6A1BA1891EC, 0x2F291FB3F3AE0, 0x21A7B814BEA52, 0x3669B656E44D1 },
+		  { 0x63F06EDA6E133, 0x233342758070F, 0x098E0459CC075, 0x4DF5EAD6C7C1B, 0x6A21E6CD4FD5E } },
+		{ { 0x129126699B2E3, 0x0EE11A2603DE8, 0x60AC2F5C74C21, 0x59B192A196808, 0x45371B07001E8 },
+		  { 0x6170A3046E65F, 0x5401A46A49E38, 0x20ADD5561C4A8, 0x7ABB4EDDE9E46, 0x586BF9F1A195F },
+		  { 0x3088D5EF8790B, 0x38C2126FCB4DB, 0x685BAE149E3C3, 0x0BCD601A4E930, 0x0EAFB03790E52 } },
+		{ { 0x0805E0F75AE1D, 0x464CC59860A28, 0x248E5B7B00BEF, 0x5D99675EF8F75, 0x44AE3344C5435 },
+		  { 0x555C13748042F, 0x4D041754232C0, 0x521B430866907, 0x3308E40FB9C39, 0x309ACC675A02C },
+		  { 0x289B9BBA543EE, 0x3AB592E28539E, 0x64D82ABCDD83A, 0x3C78EC172E327, 0x62D5221B7F946 } },
+		{ { 0x5D4263AF77A3C, 0x23FDD2289AEB0, 0x7DC64F77EB9EC, 0x01BD28338402C, 0x14F29A5383922 },
+		  { 0x4299C18D0936D, 0x5914183418A49, 0x52A18C721AED5, 0x2B151BA82976D, 0x5C0EFDE4BC754 },
+		  { 0x17EDC25B2D7F5, 0x37336A6081BEE, 0x7B5318887E5C3, 0x49F6D491A5BE1, 0x5E72365C7BEE0 } },
+		{ { 0x339062F08B33E, 0x4BBF3E657CFB2, 0x67AF7F56E5967, 0x4DBD67F9ED68F, 0x70B20555CB734 },
+		  { 0x3FC074571217F, 0x3A0D29B2B6AEB, 0x06478CCDDE59D, 0x55E4D051BDDFA, 0x77F1104C47B4E },
+		  { 0x113C555112C4C, 0x7535103F9B7CA, 0x140ED1D9A2108, 0x02522333BC2AF, 0x0E34398F4A064 } },
+		{ { 0x30B093E4B1928, 0x1CE7E7EC80312, 0x4E575BDF78F84, 0x61F7A190BED39, 0x6F8ADED6CA379 },
+		  { 0x522D93ECEBDE8, 0x024F045E0F6CF, 0x16DB63426CFA1, 0x1B93A1FD30FD8, 0x5E5405368A362 },
+		  { 0x0123DFDB7B29A, 0x4344356523C68, 0x79A527921EE5F, 0x74BFCCB3E817E, 0x780DE72EC8D3D } },
+		{ { 0x7EAF300F42772, 0x5455188354CE3, 0x4DCCA4A3DCBAC, 0x3D314D0BFEBCB, 0x1DEFC6AD32B58 },
+		  { 0x28545089AE7BC, 0x1E38FE9A0C15C, 0x12046E0E2377B, 0x6721C560AA885, 0x0EB28BF671928 },
+		  { 0x3BE1AEF5195A7, 0x6F22F62BDB5EB, 0x39768B8523049, 0x43394C8FBFDBD, 0x467D201BF8DD2 } },
+	},
+	{
+		{ { 0x6F4BD567AE7A9, 0x65AC89317B783, 0x07D3B20FD8932, 0x000F208326916, 0x2EF9C5A5BA384 },
+		  { 0x6919A74EF4FAD, 0x59ED4611452BF, 0x691EC04EA09EF, 0x3CBCB2700E984, 0x71C43C4F5BA3C },
+		  { 0x56DF6FA9E74CD, 0x79C95E4CF56DF, 0x7BE643BC609E2, 0x149C12AD9E878, 0x5A758CA390C5F } },
+		{ { 0x0918B1D61DC94, 0x0D350260CD19C, 0x7A2AB4E37B4D9, 0x21FEA735414D7, 0x0A738027F639D },
+		  { 0x72710D9462495, 0x25AAFAA007456, 0x2D21F28EAA31B, 0x17671EA005FD0, 0x2DBAE244B3EB7 },
+		  { 0x74A2F57FFE1CC, 0x1BC3073087301, 0x7EC57F4019C34, 0x34E082E1FA524, 0x2698CA635126A } },
+		{ { 0x5702F5E3DD90E, 0x31C9A4A70C5C7, 0x136A5AA78FC24, 0x1992F3B9F7B01, 0x3C004B0C4AFA3 },
+		  { 0x5318832B0BA78, 0x6F24B9FF17CEC, 0x0A47F30E060C7, 0x58384540DC8D0, 0x1FB43DCC49CAE },
+		  { 0x146AC06F4B82B, 0x4B500D89E7355, 0x3351E1C728A12, 0x10B9F69932FE3, 0x6B43FD01CD1FD } },
+		{ { 0x742583E760EF3, 0x73DC1573216B8, 0x4AE48FDD7714A, 0x4F85F8A13E103, 0x73420B2D6FF0D },
+		  { 0x75D4B4697C544, 0x11BE1FFF7F8F4, 0x119E16857F7E1, 0x38A14345CF5D5, 0x5A68D7105B52F },
+		  { 0x4F6CB9E851E06, 0x278C4471895E5, 0x7EFCDCE3D64E4, 0x64F6D455C4B4C, 0x3DB5632FEA34B } },
+		{ { 0x190B1829825D5, 0x0E7D3513225C9, 0x1C12BE3B7ABAE, 0x58777781E9CA6, 0x59197EA495DF2 },
+		  { 0x6EE2BF75DD9D8, 0x6C72CEB34BE8D, 0x679C9CC345EC7, 0x7898DF96898A4, 0x04321ADF49D75 },
+		  { 0x16019E4E55AAE, 0x74FC5F25D209C, 0x4566A939DED0D, 0x66063E716E0B7, 0x45EAFDC1F4D70 } },
+		{ { 0x64624CFCCB1ED, 0x257AB8072B6C1, 0x0120725676F0A, 0x4A018D04E8EEE, 0x3F73CEEA5D56D },
+		  { 0x401858045D72B, 0x459E5E0CA2D30, 0x488B719308BEA, 0x56F4A0D1B32B5, 0x5A5EEBC80362D },
+		  { 0x7BFD10A4E8DC6, 0x7C899366736F4, 0x55EBBEAF95C01, 0x46DB060903F8A, 0x2605889126621 } },
+		{ { 0x18E3CC676E542, 0x26079D995A990, 0x04A7C217908B2, 0x1DC7603E6655A, 0x0DEDFA10B2444 },
+		  { 0x704A68360FF04, 0x3CECC3CDE8B3E, 0x21CD5470F64FF, 0x6ABC18D953989, 0x54AD0C2E4E615 },
+		  { 0x367D5B82B522A, 0x0D3F4B83D7DC7, 0x3067F4CDBC58D, 0x20452DA697937, 0x62ECB2BAA77A9 } },
+		{ { 0x72836AFB62874, 0x0AF3C2094B240, 0x0C285297F357A, 0x7CC2D5680D6E3, 0x61913D5075663 },
+		  { 0x5795261152B3D, 0x7A1DBBAFA3CBD, 0x5AD31C52588D5, 0x45F3A4164685C, 0x2E59F919A966D },
+		  { 0x62D361A3231DA, 0x65284004E01B8, 0x656533BE91D60, 0x6AE016C00A89F, 0x3DDBC2A131C05 } },
+	},
+	{
+		{ { 0x257A22796BB14, 0x6F360FB443E75, 0x680E47220EAEA, 0x2FCF2A5F10C18, 0x5EE7FB38D8320 },
+		  { 0x40FF9CE5EC54B, 0x57185E261B35B, 0x3E254540E70A9, 0x1B5814003E3F8, 0x78968314AC04B },
+		  { 0x5FDCB41446A8E, 0x5286926FF2A71, 0x0F231E296B3F6, 0x684A357C84693, 0x61D0633C9BCA0 } },
+		{ { 0x328BCF8FC73DF, 0x3B4DE06FF95B4, 0x30AA427BA11A5, 0x5EE31BFDA6D9C, 0x5B23AC2DF8067 },
+		  { 0x44935FFDB2566, 0x12F016D176C6E, 0x4FBB00F16F5AE, 0x3FAB78D99402A, 0x6E965FD847AED },
+		  { 0x2B953EE80527B, 0x55F5BCDB1B35A, 0x43A0B3FA23C66, 0x76E07388B820A, 0x79B9BBB9DD95D } },
+		{ { 0x17DAE8E9F7374, 0x719F76102DA33, 0x5117C2A80CA8B, 0x41A66B65D0936, 0x1BA811460ACCB },
+		  { 0x355406A3126C2, 0x50D1918727D76, 0x6E5EA0B498E0E, 0x0A3B6063214F2, 0x5065F158C9FD2 },
+		  { 0x169FB0C429954, 0x59AEDD9ECEE10, 0x39916EB851802, 0x57917555CC538, 0x3981F39E58A4F } },
+		{ { 0x5DFA56DE66FDE, 0x0058809075908, 0x6D3D8CB854A94, 0x5B2F4E970B1E3, 0x30F4452EDCBC1 },
+		  { 0x38A7559230A93, 0x52C1CDE8BA31F, 0x2A4F2D4745A3D, 0x07E9D42D4A28A, 0x38DC083705ACD },
+		  { 0x52782C5759740, 0x53F3397D990AD, 0x3A939C7E84D15, 0x234C4227E39E0, 0x632D9A1A593F2 } },
+		{ { 0x1FD11ED0C84A7, 0x021B3ED2757E1, 0x73E1DE58FC1C6, 0x5D110C84616AB, 0x3A5A7DF28AF64 },
+		  { 0x36B15B807CBA6, 0x3F78A9E1AFED7, 0x0A59C2C608F1F, 0x52BDD8ECB81B7, 0x0B24F48847ED4 },
+		  { 0x2D4BE511BEAC7, 0x6BDA4D99E5B9B, 0x17E6996914E01, 0x7B1F0CE7FCF80, 0x34FCF74475481 } },
+		{ { 0x31DAB78CFAA98, 0x4E3216E5E54B7, 0x249823973B689, 0x2584984E48885, 0x0119A3042FB37 },
+		  { 0x7E04C789767CA, 0x1671B28CFB832, 0x7E57EA2E1C537, 0x1FBAAEF444141, 0x3D3BDC164DFA6 },
+		  { 0x2D89CE8C2177D, 0x6CD12BA182CF4, 0x20A8AC19A7697, 0x539FAB2CC72D9, 0x56C088F1EDE20 } },
+		{ { 0x35FAC24F38F02, 0x7D75C6197AB03, 0x33E4BC2A42FA7, 0x1C7CD10B48145, 0x038B7EA483590 },
+		  { 0x53D1110A86E17, 0x6416EB65F466D, 0x41CA6235FCE20, 0x5C3FC8A99BB12, 0x09674C6B99108 },
+		  { 0x6F82199316FF8, 0x05D54F1A9F3E9, 0x3BCC5D0BD274A, 0x5B284B8D2D5AD, 0x6E5E31025969E } },
+		{ { 0x4FB0E63066222, 0x130F59747E660, 0x041868FECD41A, 0x3105E8C923BC6, 0x3058AD43D1838 },
+		  { 0x462F587E593FB, 0x3D94BA7CE362D, 0x330F9B52667B7, 0x5D45A48E0F00A, 0x08F5114789A8D },
+		  { 0x40FFDE57663D0, 0x71445D4C20647, 0x2653E68170F7C, 0x64CDEE3C55ED6, 0x26549FA4EFE3D } },
+	},
+	{
+		{ { 0x68549AF3F666E, 0x09E2941D4BB68, 0x2E8311F5DFF3C, 0x6429EF91FFBD2, 0x3A10DFE132CE3 },
+		  { 0x55A461E6BF9D6, 0x78EEEF4B02E83, 0x1D34F648C16CF, 0x07FEA2ABA5132, 0x1926E1DC6401E },
+		  { 0x74E8AEA17CEA0, 0x0C743F83FBC0F, 0x7CB03C4BF5455, 0x68A8BA9917E98, 0x1FA1D01D861E5 } },
+		{ { 0x4AC00D1DF94AB, 0x3BA2101BD271B, 0x7578988B9C4AF, 0x0F2BF89F49F7E, 0x73FCED18EE9A0 },
+		  { 0x055947D599832, 0x346FE2AA41990, 0x0164C8079195B, 0x799CCFB7BBA27, 0x773563BC6A75C },
+		  { 0x1E90863139CB3, 0x4F8B407D9A0D6, 0x58E24CA924F69, 0x7A246BBE76456, 0x1F426B701B864 } },
+		{ { 0x635C891A12552, 0x26AEBD38EDE2F, 0x66DC8FADDAE05, 0x21C7D41A03786, 0x0B76BB1B3FA7E },
+		  { 0x1264C41911C01, 0x702F44584BDF9, 0x43C511FC68EDE, 0x0482C3AED35F9, 0x4E1AF5271D31B },
+		  { 0x0C1F97F92939B, 0x17A88956DC117, 0x6EE005EF99DC7, 0x4AA9172B231CC, 0x7B6DD61EB772A } },
+		{ { 0x0ABF9AB01D2C7, 0x3880287630AE6, 0x32ECA045BEDDB, 0x57F43365F32D0, 0x53FA9B659BFF6 },
+		  { 0x5C1E850F33D92, 0x1EC119AB9F6F5, 0x7F16F6DE663E9, 0x7A7D6CB16DEC6, 0x703E9BCEAF1D2 },
+		  { 0x4C8E994885455, 0x4CCB5DA9CAD82, 0x3596BC610E975, 0x7A80C0DDB9F5E, 0x398D93E5C4C61 } },
+		{ { 0x77C60D2E7E3F2, 0x4061051763870, 0x67BC4E0ECD2AA, 0x2BB941F1373B9, 0x699C9C9002C30 },
+		  { 0x3D16733E248F3, 0x0E2B7E14BE389, 0x42C0DDAF6784A, 0x589EA1FC67850, 0x53B09B5DDF191 },
+		  { 0x6A7235946F1CC, 0x6B99CBB2FBE60, 0x6D3A5D6485C62, 0x4839466E923C0, 0x51CAF30C6FCDD } },
+		{ { 0x2F99A18AC54C7, 0x398A39661EE6F, 0x384331E40CDE3, 0x4CD15C4DE19A6, 0x12AE29C189F8E },
+		  { 0x3A7427674E00A, 0x6142F4F7E74C1, 0x4CC93318C3A15, 0x6D51BAC2B1EE7, 0x5504AA292383F },
+		  { 0x6C0CB1F0D01CF, 0x187469EF5D533, 0x27138883747BF, 0x2F52AE53A90E8, 0x5FD14FE958EBA } },
+		{ { 0x2FE5EBF93CB8E, 0x226DA8ACBE788, 0x10883A2FB7EA1, 0x094707842CF44, 0x7DD73F960725D },
+		  { 0x42DDF2845AB2C, 0x6214FFD3276BB, 0x00B8D181A5246, 0x268A6D579EB20, 0x093FF26E58647 },
+		  { 0x524FE68059829, 0x65B75E47CB621, 0x15EB0A5D5CC19, 0x05209B3929D5A, 0x2F59BCBC86B47 } },
+		{ { 0x1D560B691C301, 0x7F5BAFCE3CE08, 0x4CD561614806C, 0x4588B6170B188, 0x2AA55E3D01082 },
+		  { 0x47D429917135F, 0x3EACFA07AF070, 0x1DEAB46B46E44, 0x7A53F3BA46CDF, 0x5458B42E2E51A },
+		  { 0x192E60C07444F, 0x5AE8843A21DAA, 0x6D721910B1538, 0x3321A95A6417E, 0x13E9004A8A768 } },
+	},
+	{
+		{ { 0x600C9193B877F, 0x21C1B8A0D7765, 0x379927FB38EA2, 0x70D7679DBE01B, 0x5F46040898DE9 },
+		  { 0x58845832FCEDB, 0x135CD7F0C6E73, 0x53FFBDFE8E35B, 0x22F195E06E55B, 0x73937E8814BCE },
+		  { 0x37116297BF48D, 0x45A9E0D069720, 0x25AF71AA744EC, 0x41AF0CB8AABA3, 0x2CF8A4E891D5E } },
+		{ { 0x5487E17D06BA2, 0x3872A032D6596, 0x65E28C09348E0, 0x27B6BB2CE40C2, 0x7A6F7F2891D6A },
+		  { 0x3FD8707110F67, 0x26F8716A92DB2, 0x1CDAA1B753027, 0x504BE58B52661, 0x2049BD6E58252 },
+		  { 0x1FD8D6A9AEF49, 0x7CB67B7216FA1, 0x67AFF53C3B982, 0x20EA610DA9628, 0x6011AADFC5459 } },
+		{ { 0x6D0C802CBF890, 0x141BFED554C7B, 0x6DBB667EF4263, 0x58F3126857EDC, 0x69CE18B779340 },
+		  { 0x7926DCF95F83C, 0x42E25120E2BEC, 0x63DE96DF1FA15, 0x4F06B50F3F9CC, 0x6FC5CC1B0B62F },
+		  { 0x75528B29879CB, 0x79A8FD2125A3D, 0x27C8D4B746AB8, 0x0F8893F02210C, 0x15596B3AE5710 } },
+		{ { 0x731167E5124CA, 0x17B38E8BBE13F, 0x3D55B942F9056, 0x09C1495BE913F, 0x3AA4E241AFB6D },
+		  { 0x739D23F9179A2, 0x632FADBB9E8C4, 0x7C8522BFE0C48, 0x6ED0983EF5AA9, 0x0D2237687B5F4 },
+		  { 0x138BF2A3305F5, 0x1F45D24D86598, 0x5274BAD2160FE, 0x1B6041D58D12A, 0x32FCAA6E4687A } },
+		{ { 0x7A4732787CCDF, 0x11E427C7F0640, 0x03659385F8C64, 0x5F4EAD9766BFB, 0x746F6336C2600 },
+		  { 0x56E8DC57D9AF5, 0x5B3BE17BE4F78, 0x3BF928CF82F4B, 0x52E55600A6F11, 0x4627E9CEFEBD6 },
+		  { 0x2F345AB6C971C, 0x653286E63E7E9, 0x51061B78A23AD, 0x14999ACB54501, 0x7B4917007ED66 } },
+		{ { 0x41B28DD53A2DD, 0x37BE85F87EA86, 0x74BE3D2A85E41, 0x1BE87FAC96CA6, 0x1D03620FE08CD },
+		  { 0x5FB5CAB84B064, 0x2513E778285B0, 0x457383125E043, 0x6BDA3B56E223D, 0x122BA376F844F },
+		  { 0x232CDA2B4E554, 0x0422BA30FF840, 0x751E7667B43F5, 0x6261755DA5F3E, 0x02C70BF52B68E } },
+		{ { 0x532BF458D72E1, 0x40F96E796B59C, 0x22EF79D6F9DA3, 0x501AB67BECA77, 0x6B0697E3FEB43 },
+		  { 0x7EC4B5D0B2FBB, 0x200E910595450, 0x742057105715E, 0x2F07022530F60, 0x26334F0A409EF },
+		  { 0x0F04ADF62A3C0, 0x5E0EDB48BB6D9, 0x7C34AA4FBC003, 0x7D74E4E5CAC24, 0x1CC37F43441B2 } },
+		{ { 0x656F1C9CEAEB9, 0x7031CACAD5AEC, 0x1308CD0716C57, 0x41C1373941942, 0x3A346F772F196 },
+		  { 0x7565A5CC7324F, 0x01CA0D5244A11, 0x116B067418713, 0x0A57D8C55EDAE, 0x6C6809C103803 },
+		  { 0x55112E2DA6AC8, 0x6363D0A3DBA5A, 0x319C98BA6F40C, 0x2E84B03A36EC7, 0x05911B9F6EF7C } },
+	},
+	{
+		{ { 0x1ACF3512EEAEF, 0x2639839692A69, 0x669A234830507, 0x68B920C0603D4, 0x555EF9D1C64B2 },
+		  { 0x39983F5DF0EBB, 0x1EA2589959826, 0x6CE638703CDD6, 0x6311678898505, 0x6B3CECF9AA270 },
+		  { 0x770BA3B73BD08, 0x11475F7E186D4, 0x0251BC9892BBC, 0x24EAB9BFFCC5A, 0x675F4DE133817 } },
+		{ { 0x7F6D93BDAB31D, 0x1F3ACA5BFD425, 0x2FA521C1C9760, 0x62180CE27F9CD, 0x60F450B882CD3 },
+		  { 0x452036B1782FC, 0x02D95B07681C5, 0x5901CF99205B2, 0x290686E5EECB4, 0x13D99DF70164C },
+		  { 0x35EC321E5C0CA, 0x13AE337F44029, 0x4008E813F2DA7, 0x640272F8E0C3A, 0x1C06DE9E55EDA } },
+		{ { 0x52B40FF6D69AA, 0x31B8809377FFA, 0x536625CD14C2C, 0x516AF252E17D1, 0x78096F8E7D32B },
+		  { 0x77AD6A33EC4E2, 0x717C5DC11D321, 0x4A114559823E4, 0x306CE50A1E2B1, 0x4CF38A1FEC2DB },
+		  { 0x2AA650DFA5CE7, 0x54916A8F19415, 0x00DC96FE71278, 0x55F2784E63EB8, 0x373CAD3A26091 } },
+		{ { 0x6A8FB89DDBBAD, 0x78C35D5D97E37, 0x66E3674EF2CB2, 0x34347AC53DD8F, 0x21547EDA5112A },
+		  { 0x4634D82C9F57C, 0x4249268A6D652, 0x6336D687F2FF7, 0x4FE4F4E26D9A0, 0x0040F3D945441 },
+		  { 0x5E939FD5986D3, 0x12A2147019BDF, 0x4C466E7D09CB2, 0x6FA5B95D203DD, 0x63550A334A254 } },
+		{ { 0x2584572547B49, 0x75C58811C1377, 0x4D3C637CC171B, 0x33D30747D34E3, 0x39A92BAFAA7D7 },
+		  { 0x7D6EDB569CF37, 0x60194A5DC2CA0, 0x5AF59745E10A6, 0x7A8F53E004875, 0x3EEA62C7DAF78 },
+		  { 0x4C713E693274E, 0x6ED1B7A6EB3A4, 0x62ACE697D8E15, 0x266B8292AB075, 0x68436A0665C9C } },
+		{ { 0x6D317E820107C, 0x090815D2CA3CA, 0x03FF1EB1499A1, 0x23960F050E319, 0x5373669C91611 },
+		  { 0x235E8202F3F27, 0x44C9F2EB61780, 0x630905B1D7003, 0x4FCC8D274EAD1, 0x17B6E7F68AB78 },
+		  { 0x014AB9A0E5257, 0x09939567F8BA5, 0x4B47B2A423C82, 0x688D7E57AC42D, 0x1CB4B5A678F87 } },
+		{ { 0x4AA62A2A007E7, 0x61E0E38F62D6E, 0x02F888FCC4782, 0x7562B83F21C00, 0x2DC0FD2D82EF6 },
+		  { 0x4C06B394AFC6C, 0x4931B4BF636CC, 0x72B60D0322378, 0x25127C6818B25, 0x330BCA78DE743 },
+		  { 0x6FF841119744E, 0x2C560E8E49305, 0x7254FEFE5A57A, 0x67AE2C560A7DF, 0x3C31BE1B369F1 } },
+		{ { 0x0BC93F9CB4272, 0x3F8F9DB73182D, 0x2B235EABAE1C4, 0x2DDBF8729551A, 0x41CEC1097E7D5 },
+		  { 0x4864D08948AEE, 0x5D237438DF61E, 0x2B285601F7067, 0x25DBCBAE6D753, 0x330B61134262D },
+		  { 0x619D7A26D808A, 0x3C3B3C2ADBEF2, 0x6877C9EEC7F52, 0x3BEB9EBE1B66D, 0x26B44CD91F287 } },
+	},
+	{
+		{ { 0x7F29362730383, 0x7FD7951459C36, 0x7504C512D49E7, 0x087ED7E3BC55F, 0x7DEB10149C726 },
+		  { 0x048478F387475, 0x69397D9678A3E, 0x67C8156C976F3, 0x2EB4D5589226C, 0x2C709E6C1C10A },
+		  { 0x2AF6A8766EE7A, 0x08AAA79A1D96C, 0x42F92D59B2FB0, 0x1752C40009C07, 0x08E68E9FF62CE } },
+		{ { 0x509D50AB8F2F9, 0x1B8AB247BE5E5, 0x5D9B2E6B2E486, 0x4FAA5479A1339, 0x4CB13BD738F71 },
+		  { 0x5500A4BC130AD, 0x127A17A938695, 0x02A26FA34E36D, 0x584D12E1ECC28, 0x2F1F3F87EEBA3 },
+		  { 0x48C75E515B64A, 0x75B6952071EF0, 0x5D46D42965406, 0x7746106989F9F, 0x19A1E353C0AE2 } },
+		{ { 0x172CDD596BDBD, 0x0731DDF881684, 0x10426D64F8115, 0x71A4FD8A9A3DA, 0x736BD3990266A },
+		  { 0x47560BAFA05C3, 0x418DCABCC2FA3, 0x35991CECF8682, 0x24371A94B8C60, 0x41546B11C20C3 },
+		  { 0x32D509334B3B4, 0x16C102CAE70AA, 0x1720DD51BF445, 0x5AE662FAF9821, 0x412295A2B87FA } },
+		{ { 0x55261E293EAC6, 0x06426759B65CC, 0x40265AE116A48, 0x6C02304BAE5BC, 0x0760BB8D195AD },
+		  { 0x19B88F57ED6E9, 0x4CDBF1904A339, 0x42B49CD4E4F2C, 0x71A2E771909D9, 0x14E153EBB52D2 },
+		  { 0x61A17CDE6818A, 0x53DAD34108827, 0x32B32C55C55B6, 0x2F9165F9347A3, 0x6B34BE9BC33AC } },
+		{ { 0x469656571F2D3, 0x0AA61CE6F423F, 0x3F940D71B27A1, 0x185F19D73D16A, 0x01B9C7B62E6DD },
+		  { 0x72F643A78C0B2, 0x3DE45C04F9E7B, 0x706D68D30FA5C, 0x696F63E8E2F24, 0x2012C18F0922D },
+		  { 0x355E55AC89D29, 0x3E8B414EC7101, 0x39DB07C520C90, 0x6F41E9B77EFE1, 0x08AF5B784E4BA } },
+		{ { 0x314D289CC2C4B, 0x23450E2F1BC4E, 0x0CD93392F92F4, 0x1370C6A946B7D, 0x6423C1D5AFD98 },
+		  { 0x499DC881F2533, 0x34EF26476C506, 0x4D107D2741497, 0x346C4BD6EFDB3, 0x32B79D71163A1 },
+		  { 0x5F8D9EDFCB36A, 0x1E6E8DCBF3990, 0x7974F348AF30A, 0x6E6724EF19C7C, 0x480A5EFBC13E2 } },
+		{ { 0x14CE442CE221F, 0x18980A72516CC, 0x072F80DB86677, 0x703331FDA526E, 0x24B31D47691C8 },
+		  { 0x1E70B01622071, 0x1F163B5F8A16A, 0x56AAF341AD417, 0x7989635D830F7, 0x47AA27600CB7B },
+		  { 0x41EEDC015F8C3, 0x7CF8D27EF854A, 0x289E3584693F9, 0x04A7857B309A7, 0x545B585D14DDA } },
+		{ { 0x4E4D0E3B321E1, 0x7451FE3D2AC40, 0x666F678EEA98D, 0x038858667FEAD, 0x4D22DC3E64C8D },
+		  { 0x7275EA0D43A0F, 0x681137DD7CCF7, 0x1E79CBAB79A38, 0x22A214489A66A, 0x0F62F9C332BA5 },
+		  { 0x46589D63B5F39, 0x7EAF979EC3F96, 0x4EBE81572B9A8, 0x21B7F5D61694A, 0x1C0FA01A36371 } },
+	},
+	{
+		{ { 0x02B0E8C936A50, 0x6B83B58B6CD21, 0x37ED8D3E72680, 0x0A037DB9F2A62, 0x4005419B1D2BC },
+		  { 0x604B622943DFF, 0x1C899F6741A58, 0x60219E2F232FB, 0x35FAE92A7F9CB, 0x0FA3614F3B1CA },
+		  { 0x3FEBDB9BE82F0, 0x5E74895921400, 0x553EA38822706, 0x5A17C24CFC88C, 0x1FBA218AEF40A } },
+		{ { 0x657043E7B0194, 0x5C11B55EFE9E7, 0x7737BC6A074FB, 0x0EAE41CE355CC, 0x6C535D13FF776 },
+		  { 0x49448FAC8F53E, 0x34F74C6E8356A, 0x0AD780607DBA2, 0x7213A7EB63EB6, 0x392E3ACAA8C86 },
+		  { 0x534E93E8A35AF, 0x08B10FD02C997, 0x26AC2ACB81E05, 0x09D8C98CE3B79, 0x25E17FE4D50AC } },
+		{ { 0x77FF576F121A7, 0x4E5F9B0FC722B, 0x46F949B0D28C8, 0x4CDE65D17EF26, 0x6BBA828F89698 },
+		  { 0x09BD71E04F676, 0x25AC841F2A145, 0x1A47EAC823871, 0x1A8A8C36C581A, 0x255751442A9FB },
+		  { 0x1BC6690FE3901, 0x314132F5ABC5A, 0x611835132D528, 0x5F24B8EB48A57, 0x559D504F7F6B7 } },
+		{ { 0x091E7F6D266FD, 0x36060EF037389, 0x18788EC1D1286, 0x287441C478EB0, 0x123EA6A3354BD },
+		  { 0x38378B3EB54D5, 0x4D4AAA78F94EE, 0x4A002E875A74D, 0x10B851367B17C, 0x01AB12D5807E3 },
+		  { 0x5189041E32D96, 0x05B062B090231, 0x0C91766E7B78F, 0x0AA0F55A138EC, 0x4A3961E2C918A } },
+		{ { 0x7D644F3233F1E, 0x1C69F9E02C064, 0x36AE5E5266898, 0x08FC1DAD38B79, 0x68ACEEAD9BD41 },
+		  { 0x43BE0F8E6BBA0, 0x68FDFFC614E3B, 0x4E91DAB5B3BE0, 0x3B1D4C9212FF0, 0x2CD6BCE3FB1DB },
+		  { 0x4C90EF3D7C210, 0x496F5A0818716, 0x79CF88CC239B8, 0x2CB9C306CF8DB, 0x595760D5B508F } },
+		{ { 0x2CBEBFD022790, 0x0B8822AEC1105, 0x4D1CFD226BCCC, 0x515B2FA4971BE, 0x2CB2C5DF54515 },
+		  { 0x1BFE104AA6397, 0x11494FF996C25, 0x64251623E5800, 0x0D49FC5E044BE, 0x709FA43EDCB29 },
+		  { 0x25D8C63FD2ACA, 0x4C5CD29DFFD61, 0x32EC0EB48AF05, 0x18F9391F9B77C, 0x70F029ECF0C81 } },
+		{ { 0x2AFAA5E10B0B9, 0x61DE08355254D, 0x0EB587DE3C28D, 0x4F0BB9F7DBBD5, 0x44ECA5A2A74BD },
+		  { 0x307B32EED3E33, 0x6748AB03CE8C2, 0x57C0D9AB810BC, 0x42C64A224E98C, 0x0B7D5D8A6C314 },
+		  { 0x448327B95D543, 0x0146681E3A4BA, 0x38714ADC34E0C, 0x4F26F0E298E30, 0x272224512C7DE } },
+		{ { 0x3BB8A42A975FC, 0x6F2D5B46B17EF, 0x7B6A9223170E5, 0x053713FE3B7E6, 0x19735FD7F6BC2 },
+		  { 0x492AF49C5342E, 0x2365CDF5A0357, 0x32138A7FFBB60, 0x2A1F7D14646FE, 0x11B5DF18A44CC },
+		  { 0x390D042C84266, 0x1EFE32A8FDC75, 0x6925EE7AE1238, 0x4AF9281D0E832, 0x0FEF911191DF8 } },
+	},
+};
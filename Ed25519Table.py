@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+#
+# Generate the Ed25519 base point table
+#
+# Copyright (c) 2025 gabijaba.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. The name of the author may not be used to endorse or promote products
+#    derived from this software without specific prior written permission
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+# IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+# NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Usage: Ed25519Table.py Ed25519Table.c
+#
+# Writes Ed25519Base[i][j] = (j + 1) * 256^i * B for the base point B,
+# as affine (y + x, y - x, 2 * d * x * y) in radix 2^51 limbs. The
+# verifier multiplies B with a signed 4-bit digit per table row and needs
+# no doublings besides four in the middle. The table never changes, the
+# script only documents where it came from.
+#
+
+import sys
+
+P = 2 ** 255 - 19
+D = -121665 * pow(121666, P - 2, P) % P
+
+
+def add(a, b):
+	x1, y1 = a
+	x2, y2 = b
+	t = D * x1 * x2 * y1 * y2 % P
+	x3 = (x1 * y2 + x2 * y1) * pow(1 + t, P - 2, P) % P
+	y3 = (y1 * y2 + x1 * x2) * pow(1 - t, P - 2, P) % P
+	return x3, y3
+
+
+def base_point():
+	y = 4 * pow(5, P - 2, P) % P
+	xx = (y * y - 1) * pow(D * y * y + 1, P - 2, P) % P
+	x = pow(xx, (P + 3) // 8, P)
+	if x * x % P != xx:
+		x = x * pow(2, (P - 1) // 4, P) % P
+	if x & 1:
+		x = P - x
+	return x, y
+
+
+def limbs(value):
+	return '{ ' + ', '.join('0x%013X' % ((value >> (51 * i)) & ((1 << 51) - 1)) for i in range(5)) + ' }'
+
+
+def main():
+	if len(sys.argv) != 2:
+		sys.exit('usage: Ed25519Table.py Ed25519Table.c')
+
+	header = open(__file__).read().split('# Usage:')[0].split('\n', 2)[2]
+	header = ''.join(' *' + line[1:] + '\n' for line in header.splitlines())
+	rows = []
+	point = base_point()
+	for i in range(32):
+		multiple = point
+		entries = []
+		for j in range(8):
+			x, y = multiple
+			entries.append('\t\t{ %s,\n\t\t  %s,\n\t\t  %s },' % (limbs((y + x) % P), limbs((y - x) % P), limbs(2 * D * x * y % P)))
+			multiple = add(multiple, point)
+		rows.append('\t{\n' + '\n'.join(entries) + '\n\t},')
+		for k in range(8):
+			point = add(point, point)
+
+	out = open(sys.argv[1], 'w')
+	out.write('/*\n' + header.replace('Generate the Ed25519 base point table', 'Ed25519 base point table, generated by Ed25519Table.py') + ' */\n\n')
+	out.write('#include <Uefi.h>\n\n#include "Ed25519.h"\n\n')
+	out.write('ED25519_PRECOMP Ed25519Base[32][8] = {\n' + '\n'.join(rows) + '\n};\n')
+
+
+if __name__ == '__main__':
+	main()
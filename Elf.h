@@ -133,6 +133,37 @@ typedef struct {
 	UINT16 ShStrNdx;
 } ELF_HEADER64;
 
+typedef struct {
+	UINT32 NameSz;
+	UINT32 DescSz;
+	UINT32 Type;
+	/* Name and descriptor follow, each padded to 4 bytes */
+} ELF_NOTE64;
+
+#define DT_NULL 0
+#define DT_RELA 7
+#define DT_RELASZ 8
+#define DT_RELAENT 9
+#define DT_REL 17
+#define DT_RELSZ 18
+#define DT_RELRSZ 35
+#define DT_RELR 36
+#define DT_RELRENT 37
+
+typedef struct {
+	INT64 Tag;
+	UINT64 Val;
+} ELF_DYN64;
 
+#define R_X86_64_NONE 0
+#define R_X86_64_RELATIVE 8
+
+#define ELF64_R_TYPE(Info) ((UINT32)(Info))
+
+typedef struct {
+	UINT64 Offset;
+	UINT64 Info;
+	INT64 Addend;
+} ELF_RELA64;
 
 #endif /* __ELF_H__ */
@@ -33,6 +33,7 @@
 #include <Library/BaseLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
 #include <Library/PrintLib.h>
 
 #include "Boot.h"
@@ -0,0 +1,698 @@
+/*
+ * FAT file extents for reads past the file system driver
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+#include <Protocol/BlockIo.h>
+#include <Protocol/BlockIo2.h>
+#include <Protocol/DiskIo.h>
+#include <Protocol/DiskIo2.h>
+
+#include "Boot.h"
+
+/* Largest FAT kept in memory, 4M FAT32 clusters */
+#define FAT_TABLE_MAX SIZE_16MB
+
+#define FAT_ATTRIBUTE_VOLUME    0x08
+#define FAT_ATTRIBUTE_DIRECTORY 0x10
+#define FAT_ATTRIBUTE_LONG_NAME 0x0F
+
+#define FAT_ENTRY_END     0x00
+#define FAT_ENTRY_DELETED 0xE5
+#define FAT_LONG_NAME_LAST 0x40
+
+/* Characters of a long name in each of its entries */
+#define FAT_LONG_NAME_PART 13
+#define FAT_LONG_NAME_MAX  255
+
+#pragma pack(1)
+typedef struct {
+	UINT8 Jump[3];
+	CHAR8 OemName[8];
+	UINT16 BytesPerSector;
+	UINT8 SectorsPerCluster;
+	UINT16 ReservedSectors;
+	UINT8 NumberOfFats;
+	UINT16 RootEntries;
+	UINT16 TotalSectors16;
+	UINT8 Media;
+	UINT16 FatSize16;
+	UINT16 SectorsPerTrack;
+	UINT16 NumberOfHeads;
+	UINT32 HiddenSectors;
+	UINT32 TotalSectors32;
+	/* FAT32 only from here */
+	UINT32 FatSize32;
+	UINT16 ExtendedFlags;
+	UINT16 Version;
+	UINT32 RootCluster;
+} FAT_BOOT_SECTOR;
+
+typedef struct {
+	CHAR8 Name[11];
+	UINT8 Attributes;
+	UINT8 Reserved[8];
+	UINT16 FirstClusterHigh;
+	UINT8 Times[4];
+	UINT16 FirstClusterLow;
+	UINT32 FileSize;
+} FAT_DIRECTORY_ENTRY;
+
+typedef struct {
+	UINT8 Ordinal;
+	UINT16 Name1[5];
+	UINT8 Attributes;
+	UINT8 Type;
+	UINT8 Checksum;
+	UINT16 Name2[6];
+	UINT16 FirstCluster;
+	UINT16 Name3[2];
+} FAT_LONG_NAME_ENTRY;
+#pragma pack()
+
+typedef struct {
+	EFI_DISK_IO_PROTOCOL *DiskIo;
+	EFI_DISK_IO2_PROTOCOL *DiskIo2;   /* NULL when the disk only reads synchronously */
+	EFI_BLOCK_IO_PROTOCOL *BlockIo;   /* Whole blocks go straight to the caller */
+	EFI_BLOCK_IO2_PROTOCOL *BlockIo2;
+	UINT32 MediaId;
+	UINT32 BlockSize;
+	UINT32 IoAlign;                   /* Buffer alignment BlockIo wants, at least 1 */
+	UINTN Bits;                       /* FAT12, FAT16 or FAT32 */
+	UINT32 ClusterSize;
+	UINT32 NumberOfClusters;
+	UINT64 RootStart;                 /* Fixed FAT12 and FAT16 root directory */
+	UINT32 RootSize;
+	UINT32 RootCluster;               /* FAT32 root directory */
+	UINT64 DataStart;                 /* Partition offset of cluster 2 */
+	UINT8 *Table;                     /* First FAT */
+} FAT_VOLUME;
+
+FAT_VOLUME FatVolume;
+
+typedef struct {
+	EFI_DISK_IO2_TOKEN DiskToken;
+	EFI_BLOCK_IO2_TOKEN BlockToken;
+	BOOLEAN Blocks;                   /* Went to BlockIo2 rather than DiskIo2 */
+	EFI_FILE_IO_TOKEN *Token;
+} FAT_READ;
+
+/*
+ * Read the boot sector and the first FAT of the partition on Device, so
+ * files on it can be found without the file system driver.
+ */
+EFI_STATUS boot_fat_init(EFI_HANDLE Device)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_BLOCK_IO_PROTOCOL *BlockIo;
+	EFI_BLOCK_IO_MEDIA *Media;
+	UINT8 Sector[512];
+	FAT_BOOT_SECTOR *Boot = (FAT_BOOT_SECTOR*)Sector;
+	UINT64 TotalSectors;
+	UINT64 FatSectors;
+	UINT64 DataSectors;
+	UINT64 TableSize;
+
+	Status = gBS->HandleProtocol(Device, &gEfiBlockIoProtocolGuid, (VOID**)&BlockIo);
+	if(!EFI_ERROR(Status))
+		Status = gBS->HandleProtocol(Device, &gEfiDiskIoProtocolGuid, (VOID**)&FatVolume.DiskIo);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	if(EFI_ERROR(gBS->HandleProtocol(Device, &gEfiDiskIo2ProtocolGuid, (VOID**)&FatVolume.DiskIo2)))
+		FatVolume.DiskIo2 = NULL;
+
+	/* Direct block reads only for sizes and alignments the buffers can meet */
+	Media = BlockIo->Media;
+	FatVolume.MediaId = Media->MediaId;
+	FatVolume.BlockSize = Media->BlockSize;
+	FatVolume.IoAlign = MAX(Media->IoAlign, 1);
+	if(Media->BlockSize && !(Media->BlockSize & (Media->BlockSize - 1)) && Media->BlockSize <= EFI_PAGE_SIZE &&
+	   !(FatVolume.IoAlign & (FatVolume.IoAlign - 1)) && FatVolume.IoAlign <= EFI_PAGE_SIZE) {
+		FatVolume.BlockIo = BlockIo;
+		if(FatVolume.DiskIo2 && EFI_ERROR(gBS->HandleProtocol(Device, &gEfiBlockIo2ProtocolGuid, (VOID**)&FatVolume.BlockIo2)))
+			FatVolume.BlockIo2 = NULL;
+	}
+
+	Status = FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, 0, sizeof(Sector), Sector);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	if(Sector[510] != 0x55 || Sector[511] != 0xAA ||
+	   Boot->BytesPerSector < 512 || Boot->BytesPerSector > SIZE_4KB || (Boot->BytesPerSector & (Boot->BytesPerSector - 1)) ||
+	   Boot->SectorsPerCluster == 0 || (Boot->SectorsPerCluster & (Boot->SectorsPerCluster - 1)) ||
+	   Boot->ReservedSectors == 0 || Boot->NumberOfFats == 0)
+		return EFI_UNSUPPORTED;
+
+	TotalSectors = Boot->TotalSectors16 ? Boot->TotalSectors16 : Boot->TotalSectors32;
+	FatSectors = Boot->FatSize16 ? Boot->FatSize16 : Boot->FatSize32;
+	FatVolume.RootStart = (Boot->ReservedSectors + Boot->NumberOfFats * FatSectors) * Boot->BytesPerSector;
+	FatVolume.RootSize = Boot->RootEntries * sizeof(FAT_DIRECTORY_ENTRY);
+	FatVolume.DataStart = ALIGN_VALUE(FatVolume.RootStart + FatVolume.RootSize, Boot->BytesPerSector);
+	if(FatSectors == 0 || FatVolume.DataStart >= TotalSectors * Boot->BytesPerSector)
+		return EFI_UNSUPPORTED;
+
+	DataSectors = TotalSectors - FatVolume.DataStart / Boot->BytesPerSector;
+	FatVolume.ClusterSize = Boot->BytesPerSector * Boot->SectorsPerCluster;
+	FatVolume.NumberOfClusters = (UINT32)(DataSectors / Boot->SectorsPerCluster);
+
+	/* The cluster count alone decides the FAT type */
+	if(FatVolume.NumberOfClusters < 4085) {
+		FatVolume.Bits = 12;
+		TableSize = (FatVolume.NumberOfClusters + 2) * 3 / 2 + 1;
+	} else if(FatVolume.NumberOfClusters < 65525) {
+		FatVolume.Bits = 16;
+		TableSize = (FatVolume.NumberOfClusters + 2) * 2;
+	} else {
+		FatVolume.Bits = 32;
+		FatVolume.RootCluster = Boot->RootCluster;
+		TableSize = (FatVolume.NumberOfClusters + 2) * 4;
+	}
+
+	if(TableSize > FatSectors * Boot->BytesPerSector || TableSize > FAT_TABLE_MAX)
+		return EFI_UNSUPPORTED;
+
+	Status = gBS->AllocatePool(EfiLoaderData, TableSize, (VOID**)&FatVolume.Table);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, Boot->ReservedSectors * Boot->BytesPerSector, TableSize, FatVolume.Table);
+	if(EFI_ERROR(Status)) {
+		gBS->FreePool(FatVolume.Table);
+		FatVolume.Table = NULL;
+	}
+
+	return Status;
+}
+
+BOOLEAN boot_fat_async()
+{
+	return FatVolume.DiskIo2 != NULL;
+}
+
+/*
+ * Alignment a buffer should have, relative to the file offset read into
+ * it, for the whole blocks to be read into it directly.
+ */
+UINTN boot_fat_alignment()
+{
+	return FatVolume.BlockIo ? MAX(FatVolume.BlockSize, FatVolume.IoAlign) : 1;
+}
+
+/*
+ * Split Length bytes at partition offset Disk into a head up to the
+ * first block boundary, whole blocks and a tail. The blocks are only
+ * worth a read of their own when Buffer lines up for them.
+ */
+BOOLEAN boot_fat_split(UINT64 Disk, UINTN Length, UINT8 *Buffer, UINTN *Head, UINTN *Body)
+{
+	if(!FatVolume.BlockIo)
+		return FALSE;
+
+	*Head = (UINTN)MIN(Length, (FatVolume.BlockSize - Disk % FatVolume.BlockSize) % FatVolume.BlockSize);
+	*Body = (Length - *Head) & ~((UINTN)FatVolume.BlockSize - 1);
+
+	return *Body && ((UINTN)(Buffer + *Head) & (FatVolume.IoAlign - 1)) == 0;
+}
+
+/*
+ * Read Length bytes at partition offset Disk. The whole blocks go from
+ * BlockIo into Buffer, leaving DiskIo only the partial blocks at either
+ * end, which it reads through a bounce buffer of its own.
+ */
+EFI_STATUS boot_fat_read_disk(UINT64 Disk, UINTN Length, UINT8 *Buffer)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Head;
+	UINTN Body;
+
+	if(!boot_fat_split(Disk, Length, Buffer, &Head, &Body))
+		return FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, Disk, Length, Buffer);
+
+	if(Head)
+		Status = FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, Disk, Head, Buffer);
+	if(!EFI_ERROR(Status))
+		Status = FatVolume.BlockIo->ReadBlocks(FatVolume.BlockIo, FatVolume.MediaId, (Disk + Head) / FatVolume.BlockSize, Body, Buffer + Head);
+	if(!EFI_ERROR(Status) && Length > Head + Body)
+		Status = FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, Disk + Head + Body, Length - Head - Body, Buffer + Head + Body);
+
+	return Status;
+}
+
+/* Next cluster in the chain, 0 at its end or for a cluster out of range */
+UINT32 boot_fat_next(UINT32 Cluster)
+{
+	UINT8 *Entry;
+	UINT32 Next;
+
+	if(Cluster < 2 || Cluster >= FatVolume.NumberOfClusters + 2)
+		return 0;
+
+	switch(FatVolume.Bits) {
+	case 12:
+		Entry = FatVolume.Table + Cluster + Cluster / 2;
+		Next = Entry[0] | (Entry[1] << 8);
+		Next = (Cluster & 1) ? Next >> 4 : Next & 0xFFF;
+		return Next >= 0xFF7 ? 0 : Next;
+	case 16:
+		Entry = FatVolume.Table + Cluster * 2;
+		Next = Entry[0] | (Entry[1] << 8);
+		return Next >= 0xFFF7 ? 0 : Next;
+	default:
+		Next = ((UINT32*)FatVolume.Table)[Cluster] & 0x0FFFFFFF;
+		return Next >= 0x0FFFFFF7 ? 0 : Next;
+	}
+}
+
+/*
+ * Turn the chain from Cluster into runs of contiguous clusters covering
+ * Size bytes, MAX_UINT64 for all of the chain.
+ */
+EFI_STATUS boot_fat_chain(UINT32 Cluster, UINT64 Size, BOOT_FAT_FILE *File)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Capacity = 0;
+	UINT64 Offset = 0;
+	UINT32 Count = 0;
+
+	File->Extents = NULL;
+	File->NumberOfExtents = 0;
+
+	while(Offset < Size && Cluster) {
+		UINT64 Disk = FatVolume.DataStart + (UINT64)(Cluster - 2) * FatVolume.ClusterSize;
+		UINT64 Length = MIN(FatVolume.ClusterSize, Size - Offset);
+		BOOT_EXTENT *Last = File->NumberOfExtents ? &File->Extents[File->NumberOfExtents - 1] : NULL;
+
+		/* A loop in the chain would never end */
+		if(Cluster < 2 || Cluster >= FatVolume.NumberOfClusters + 2 || ++Count > FatVolume.NumberOfClusters) {
+			Status = EFI_VOLUME_CORRUPTED;
+			break;
+		}
+
+		if(Last && Last->Disk + Last->Size == Disk) {
+			Last->Size += Length;
+		} else {
+			if(File->NumberOfExtents == Capacity) {
+				BOOT_EXTENT *Extents;
+
+				Capacity = Capacity ? Capacity * 2 : 8;
+				Status = gBS->AllocatePool(EfiLoaderData, Capacity * sizeof(BOOT_EXTENT), (VOID**)&Extents);
+				if(EFI_ERROR(Status))
+					break;
+				if(File->Extents) {
+					gBS->CopyMem(Extents, File->Extents, File->NumberOfExtents * sizeof(BOOT_EXTENT));
+					gBS->FreePool(File->Extents);
+				}
+				File->Extents = Extents;
+			}
+
+			File->Extents[File->NumberOfExtents].Start = Offset;
+			File->Extents[File->NumberOfExtents].Disk = Disk;
+			File->Extents[File->NumberOfExtents].Size = Length;
+			File->NumberOfExtents++;
+		}
+
+		Offset += Length;
+		Cluster = boot_fat_next(Cluster);
+	}
+
+	if(!EFI_ERROR(Status) && Size != MAX_UINT64 && Offset < Size)
+		Status = EFI_VOLUME_CORRUPTED;
+
+	File->Size = Offset;
+
+	if(EFI_ERROR(Status))
+		boot_fat_close(File);
+
+	return Status;
+}
+
+/* Read Size bytes at Position of File, Size is cut down to the end of it */
+EFI_STATUS boot_fat_read(BOOT_FAT_FILE *File, UINT64 Position, UINTN *Size, VOID *Buffer)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Done = 0;
+
+	*Size = Position < File->Size ? MIN(*Size, File->Size - Position) : 0;
+
+	for(UINTN Index = 0; Index < File->NumberOfExtents && Done < *Size; Index++) {
+		BOOT_EXTENT *Extent = &File->Extents[Index];
+		UINTN Length;
+
+		if(Position + Done >= Extent->Start + Extent->Size)
+			continue;
+
+		Length = MIN(Extent->Start + Extent->Size - (Position + Done), *Size - Done);
+		Status = boot_fat_read_disk(Extent->Disk + (Position + Done - Extent->Start), Length, (UINT8*)Buffer + Done);
+		if(EFI_ERROR(Status))
+			return Status;
+
+		Done += Length;
+	}
+
+	return Status;
+}
+
+VOID EFIAPI boot_fat_read_done(EFI_EVENT Event, VOID *Context)
+{
+	FAT_READ *Read = Context;
+
+	Read->Token->Status = Read->Blocks ? Read->BlockToken.TransactionStatus : Read->DiskToken.TransactionStatus;
+	gBS->SignalEvent(Read->Token->Event);
+	gBS->CloseEvent(Event);
+	gBS->FreePool(Read);
+}
+
+/*
+ * Start reading Token->BufferSize bytes at Position of File, the token
+ * is completed the way EFI_FILE_PROTOCOL.ReadEx would. A read that spans
+ * runs is rare enough to be done on the spot, and so are the partial
+ * blocks around a read that BlockIo2 takes the whole blocks of.
+ */
+EFI_STATUS boot_fat_read_ex(BOOT_FAT_FILE *File, UINT64 Position, EFI_FILE_IO_TOKEN *Token)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	BOOT_EXTENT *Extent = NULL;
+	FAT_READ *Read;
+	UINT8 *Buffer = Token->Buffer;
+	UINT64 Disk;
+	UINTN Head;
+	UINTN Body;
+
+	if(!FatVolume.DiskIo2)
+		return EFI_UNSUPPORTED;
+
+	Token->BufferSize = Position < File->Size ? MIN(Token->BufferSize, File->Size - Position) : 0;
+
+	for(UINTN Index = 0; Index < File->NumberOfExtents; Index++) {
+		if(Position >= File->Extents[Index].Start && Position < File->Extents[Index].Start + File->Extents[Index].Size) {
+			Extent = &File->Extents[Index];
+			break;
+		}
+	}
+
+	if(!Extent || Position + Token->BufferSize > Extent->Start + Extent->Size) {
+		Token->Status = boot_fat_read(File, Position, &Token->BufferSize, Token->Buffer);
+		return gBS->SignalEvent(Token->Event);
+	}
+
+	Status = gBS->AllocatePool(EfiLoaderData, sizeof(FAT_READ), (VOID**)&Read);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Disk = Extent->Disk + (Position - Extent->Start);
+
+	Read->Token = Token;
+	Read->DiskToken.TransactionStatus = EFI_SUCCESS;
+	Read->BlockToken.TransactionStatus = EFI_SUCCESS;
+	Read->Blocks = FatVolume.BlockIo2 && boot_fat_split(Disk, Token->BufferSize, Buffer, &Head, &Body);
+
+	Status = gBS->CreateEvent(EVT_NOTIFY_SIGNAL, TPL_CALLBACK, boot_fat_read_done, Read, &Read->DiskToken.Event);
+	if(EFI_ERROR(Status)) {
+		gBS->FreePool(Read);
+		return Status;
+	}
+
+	if(Read->Blocks) {
+		Read->BlockToken.Event = Read->DiskToken.Event;
+
+		if(Head)
+			Status = FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, Disk, Head, Buffer);
+		if(!EFI_ERROR(Status) && Token->BufferSize > Head + Body)
+			Status = FatVolume.DiskIo->ReadDisk(FatVolume.DiskIo, FatVolume.MediaId, Disk + Head + Body,
+							    Token->BufferSize - Head - Body, Buffer + Head + Body);
+		if(!EFI_ERROR(Status))
+			Status = FatVolume.BlockIo2->ReadBlocksEx(FatVolume.BlockIo2, FatVolume.MediaId, (Disk + Head) / FatVolume.BlockSize,
+								  &Read->BlockToken, Body, Buffer + Head);
+	} else {
+		Status = FatVolume.DiskIo2->ReadDiskEx(FatVolume.DiskIo2, FatVolume.MediaId, Disk,
+						       &Read->DiskToken, Token->BufferSize, Buffer);
+	}
+
+	if(EFI_ERROR(Status)) {
+		gBS->CloseEvent(Read->DiskToken.Event);
+		gBS->FreePool(Read);
+	}
+
+	return Status;
+}
+
+UINT8 boot_fat_short_checksum(CHAR8 *Name)
+{
+	UINT8 Sum = 0;
+
+	for(UINTN Index = 0; Index < 11; Index++)
+		Sum = ((Sum & 1) << 7) + (Sum >> 1) + (UINT8)Name[Index];
+
+	return Sum;
+}
+
+CHAR16 boot_fat_upcase(CHAR16 Char)
+{
+	return Char >= L'a' && Char <= L'z' ? Char - (L'a' - L'A') : Char;
+}
+
+/* Compare Length characters of Name to a path component, ignoring case */
+BOOLEAN boot_fat_match(CHAR16 *Name, UINTN Length, CHAR16 *Component, UINTN ComponentLength)
+{
+	if(Length != ComponentLength)
+		return FALSE;
+
+	for(UINTN Index = 0; Index < Length; Index++) {
+		if(boot_fat_upcase(Name[Index]) != boot_fat_upcase(Component[Index]))
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* The 8.3 name of Entry as NAME.EXT, returns its length */
+UINTN boot_fat_short_name(FAT_DIRECTORY_ENTRY *Entry, CHAR16 *Name)
+{
+	UINTN Length = 0;
+	UINTN End;
+
+	for(End = 8; End > 0 && Entry->Name[End - 1] == ' '; End--);
+	for(UINTN Index = 0; Index < End; Index++)
+		Name[Length++] = (UINT8)Entry->Name[Index];
+
+	/* 0x05 stands for a name starting with 0xE5 */
+	if(Length && Name[0] == 0x05)
+		Name[0] = 0xE5;
+
+	for(End = 11; End > 8 && Entry->Name[End - 1] == ' '; End--);
+	if(End > 8) {
+		Name[Length++] = L'.';
+		for(UINTN Index = 8; Index < End; Index++)
+			Name[Length++] = (UINT8)Entry->Name[Index];
+	}
+
+	return Length;
+}
+
+/* Look Component up in the directory stored in Directory */
+EFI_STATUS boot_fat_lookup(BOOT_FAT_FILE *Directory, CHAR16 *Component, UINTN ComponentLength, FAT_DIRECTORY_ENTRY *Found)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	FAT_DIRECTORY_ENTRY *Entries;
+	UINTN Size = Directory->Size;
+	CHAR16 LongName[FAT_LONG_NAME_MAX + FAT_LONG_NAME_PART];
+	UINTN LongLength = 0;
+	UINT8 LongChecksum = 0;
+	UINT8 LongNext = 0;
+
+	Status = gBS->AllocatePool(EfiLoaderData, MAX(Size, 1), (VOID**)&Entries);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = boot_fat_read(Directory, 0, &Size, Entries);
+
+	for(UINTN Index = 0; !EFI_ERROR(Status) && Index < Size / sizeof(FAT_DIRECTORY_ENTRY); Index++) {
+		FAT_DIRECTORY_ENTRY *Entry = &Entries[Index];
+		CHAR16 ShortName[12];
+		UINTN ShortLength;
+
+		if((UINT8)Entry->Name[0] == FAT_ENTRY_END)
+			break;
+
+		if((UINT8)Entry->Name[0] == FAT_ENTRY_DELETED) {
+			LongLength = 0;
+			continue;
+		}
+
+		/* Long names come in entries from the last part back to the first */
+		if(Entry->Attributes == FAT_ATTRIBUTE_LONG_NAME) {
+			FAT_LONG_NAME_ENTRY *Long = (FAT_LONG_NAME_ENTRY*)Entry;
+			UINT8 Ordinal = Long->Ordinal & ~FAT_LONG_NAME_LAST;
+			CHAR16 *Part;
+
+			if(Long->Ordinal & FAT_LONG_NAME_LAST) {
+				LongNext = Ordinal;
+				LongChecksum = Long->Checksum;
+				LongLength = Ordinal * FAT_LONG_NAME_PART;
+			}
+
+			/* Checked on every part, a rejected sequence must not let its later parts through */
+			if(Ordinal == 0 || Ordinal != LongNext || Long->Checksum != LongChecksum || Ordinal * FAT_LONG_NAME_PART > FAT_LONG_NAME_MAX + FAT_LONG_NAME_PART - 1) {
+				LongNext = 0;
+				LongLength = 0;
+				continue;
+			}
+
+			Part = LongName + (Ordinal - 1) * FAT_LONG_NAME_PART;
+			gBS->CopyMem(Part, Long->Name1, sizeof(Long->Name1));
+			gBS->CopyMem(Part + 5, Long->Name2, sizeof(Long->Name2));
+			gBS->CopyMem(Part + 11, Long->Name3, sizeof(Long->Name3));
+			LongNext--;
+			continue;
+		}
+
+		if(Entry->Attributes & FAT_ATTRIBUTE_VOLUME) {
+			LongLength = 0;
+			continue;
+		}
+
+		ShortLength = boot_fat_short_name(Entry, ShortName);
+		if(boot_fat_match(ShortName, ShortLength, Component, ComponentLength)) {
+			*Found = *Entry;
+			gBS->FreePool(Entries);
+			return EFI_SUCCESS;
+		}
+
+		/* A long name whose parts all came and that belongs to this entry */
+		if(LongNext == 0 && LongLength && LongChecksum == boot_fat_short_checksum(Entry->Name)) {
+			UINTN Length = 0;
+
+			while(Length < LongLength && LongName[Length] != 0)
+				Length++;
+
+			if(boot_fat_match(LongName, Length, Component, ComponentLength)) {
+				*Found = *Entry;
+				gBS->FreePool(Entries);
+				return EFI_SUCCESS;
+			}
+		}
+
+		LongLength = 0;
+	}
+
+	gBS->FreePool(Entries);
+
+	return EFI_ERROR(Status) ? Status : EFI_NOT_FOUND;
+}
+
+/*
+ * Find FileName, a path from the root of the volume, and where its bytes
+ * are on the partition.
+ */
+EFI_STATUS boot_fat_open(CHAR16 *FileName, BOOT_FAT_FILE *File)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	BOOT_FAT_FILE Directory;
+	BOOLEAN IsDirectory = TRUE;
+
+	if(!FatVolume.Table)
+		return EFI_NOT_READY;
+
+	/* The FAT12 and FAT16 root directory is not a chain of clusters */
+	if(FatVolume.Bits == 32) {
+		Status = boot_fat_chain(FatVolume.RootCluster, MAX_UINT64, &Directory);
+		if(EFI_ERROR(Status))
+			return Status;
+	} else {
+		Status = gBS->AllocatePool(EfiLoaderData, sizeof(BOOT_EXTENT), (VOID**)&Directory.Extents);
+		if(EFI_ERROR(Status))
+			return Status;
+		Directory.Extents[0].Start = 0;
+		Directory.Extents[0].Disk = FatVolume.RootStart;
+		Directory.Extents[0].Size = FatVolume.RootSize;
+		Directory.NumberOfExtents = 1;
+		Directory.Size = FatVolume.RootSize;
+	}
+
+	while(*FileName) {
+		FAT_DIRECTORY_ENTRY Entry;
+		UINTN Length = 0;
+		UINT32 Cluster;
+
+		if(*FileName == L'\\' || *FileName == L'/') {
+			FileName++;
+			continue;
+		}
+
+		while(FileName[Length] && FileName[Length] != L'\\' && FileName[Length] != L'/')
+			Length++;
+
+		if(!IsDirectory) {
+			Status = EFI_NOT_FOUND;
+			break;
+		}
+
+		Status = boot_fat_lookup(&Directory, FileName, Length, &Entry);
+		boot_fat_close(&Directory);
+		if(EFI_ERROR(Status))
+			return Status;
+
+		FileName += Length;
+		IsDirectory = (Entry.Attributes & FAT_ATTRIBUTE_DIRECTORY) != 0;
+		Cluster = Entry.FirstClusterLow | (FatVolume.Bits == 32 ? (UINT32)Entry.FirstClusterHigh << 16 : 0);
+
+		/* ".." of a directory in the root points at cluster 0 */
+		if(IsDirectory && Cluster == 0)
+			return boot_fat_open(FileName, File);
+
+		Status = boot_fat_chain(Cluster, IsDirectory ? MAX_UINT64 : Entry.FileSize, &Directory);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+
+	if(!EFI_ERROR(Status) && IsDirectory)
+		Status = EFI_NOT_FOUND;
+
+	if(EFI_ERROR(Status)) {
+		boot_fat_close(&Directory);
+		return Status;
+	}
+
+	*File = Directory;
+
+	return Status;
+}
+
+VOID boot_fat_close(BOOT_FAT_FILE *File)
+{
+	if(File->Extents)
+		gBS->FreePool(File->Extents);
+
+	File->Extents = NULL;
+	File->NumberOfExtents = 0;
+}
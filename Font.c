@@ -0,0 +1,161 @@
+/*
+ * Boot font loading
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Psf.h"
+#include "Boot.h"
+
+VOID boot_psf2_symbol_map(PSF2_HEADER *Header, UINT8 *Table, UINT8 *End, UINT8 *SymbolMap)
+{
+	UINT32 Glyph = 0;
+	BOOLEAN InSequence = FALSE;
+
+	/* Without a unicode table glyphs are indexed by character code */
+	for(UINTN Character = 0; Character < 128; Character++)
+		SymbolMap[Character] = Character < Header->Length ? Character : 0;
+
+	if(!(Header->Flags & PSF2_HAS_UNICODE_TABLE))
+		return;
+
+	/*
+	 * Every glyph owns a list of UTF-8 characters, followed by combining
+	 * sequences introduced with PSF2_STARTSEQ, ended by PSF2_SEPARATOR.
+	 * The console only prints ASCII, so single byte characters are enough.
+	 */
+	for(; Table < End && Glyph < Header->Length; Table++) {
+		if(*Table == PSF2_SEPARATOR) {
+			Glyph++;
+			InSequence = FALSE;
+		} else if(*Table == PSF2_STARTSEQ) {
+			InSequence = TRUE;
+		} else if(!InSequence && *Table < 128 && Glyph < 256) {
+			SymbolMap[*Table] = Glyph;
+		}
+	}
+}
+
+EFI_STATUS boot_load_psf2(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, FONT *Font)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_FILE *FontFile;
+	UINT8 *FileBuffer;
+	UINT8 *SymbolMap;
+	UINTN FileSize;
+	UINTN ReadSize;
+	PSF2_HEADER *Header;
+
+	Status = Volume->Open(
+			Volume,
+			&FontFile,
+			FileName,
+			EFI_FILE_MODE_READ,
+			0);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	FontFile->SetPosition(FontFile, 0xFFFFFFFFFFFFFFFF);
+	FontFile->GetPosition(FontFile, &FileSize);
+	FontFile->SetPosition(FontFile, 0x0);
+
+	if(FileSize < sizeof(PSF2_HEADER)) {
+		Print(L"Invalid PSF2 font: %S\n", FileName);
+		FontFile->Close(FontFile);
+		return EFI_LOAD_ERROR;
+	}
+
+	/* The glyphs are used in place, so this buffer lives as long as the console */
+	Status = gBS->AllocatePool(EfiLoaderData, FileSize + 128, (VOID**)&FileBuffer);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating memory: %S, %lx\n", FileName, Status);
+		FontFile->Close(FontFile);
+		return Status;
+	}
+
+	ReadSize = FileSize;
+	Status = FontFile->Read(FontFile, &ReadSize, FileBuffer);
+	FontFile->Close(FontFile);
+	if(EFI_ERROR(Status) || ReadSize != FileSize) {
+		Print(L"Error while reading PSF2 font: %S, %lx\n", FileName, Status);
+		gBS->FreePool(FileBuffer);
+		return EFI_ERROR(Status) ? Status : EFI_LOAD_ERROR;
+	}
+
+	Header = (PSF2_HEADER*)FileBuffer;
+
+	if(Header->Magic[0] != PSF2_MAGIC0 ||
+	   Header->Magic[1] != PSF2_MAGIC1 ||
+	   Header->Magic[2] != PSF2_MAGIC2 ||
+	   Header->Magic[3] != PSF2_MAGIC3 ||
+	   Header->Version != 0
+	   ) {
+		Print(L"Invalid PSF2 font: %S\n", FileName);
+		gBS->FreePool(FileBuffer);
+		return EFI_LOAD_ERROR;
+	}
+
+	/* Glyphs larger than 32x64 would leave too few cells to be useful */
+	if(Header->Width == 0 || Header->Width > 32 ||
+	   Header->Height == 0 || Header->Height > 64 ||
+	   Header->Length == 0 ||
+	   Header->CharSize != Header->Height * ((Header->Width + 7) / 8) ||
+	   Header->HeaderSize < sizeof(PSF2_HEADER) ||
+	   Header->HeaderSize > FileSize ||
+	   Header->Length > (FileSize - Header->HeaderSize) / Header->CharSize
+	   ) {
+		Print(L"Unsupported PSF2 font geometry: %S, %ux%u\n", FileName, Header->Width, Header->Height);
+		gBS->FreePool(FileBuffer);
+		return EFI_UNSUPPORTED;
+	}
+
+	/* The symbol map lives in the slack after the file contents */
+	SymbolMap = FileBuffer + FileSize;
+	boot_psf2_symbol_map(
+		Header,
+		FileBuffer + Header->HeaderSize + Header->Length * Header->CharSize,
+		FileBuffer + FileSize,
+		SymbolMap);
+
+	Font->Width = Header->Width;
+	Font->Height = Header->Height;
+	Font->BitmapWidth = (Header->Width + 7) / 8;
+	Font->BitmapHeight = Header->Height;
+	Font->NumberOfSymbols = Header->Length;
+	Font->Bitmap = FileBuffer + Header->HeaderSize;
+	Font->PackedBitmap = NULL;
+	Font->PackedSize = 0;
+	Font->SymbolMap = SymbolMap;
+
+	return Status;
+}
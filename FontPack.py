@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+# Compress the built-in console font
+#
+# Copyright (c) 2025 gabijaba.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. The name of the author may not be used to endorse or promote products
+#    derived from this software without specific prior written permission
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+# IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+# NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Usage: FontPack.py 12x22.c 12x22Lz4.c
+#
+# Reads the FONTDATA_ array of a font source file and writes it back as
+# a raw LZ4 block named FONTDATA_<name>_LZ4, which boot_console_init
+# unpacks with boot_lz4_decompress. Run it again whenever the font
+# source changes, the build only compiles the generated file.
+#
+
+import re
+import sys
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_LIMIT = 12
+MAX_OFFSET = 65535
+
+
+def lz4_length(out, length):
+	while length >= 255:
+		out.append(255)
+		length -= 255
+	out.append(length)
+
+
+def lz4_sequence(out, literals, match_length, offset):
+	token_literals = min(len(literals), 15)
+	token_match = 0 if offset is None else min(match_length - MIN_MATCH, 15)
+	out.append((token_literals << 4) | token_match)
+	if token_literals == 15:
+		lz4_length(out, len(literals) - 15)
+	out += literals
+	if offset is None:
+		return
+	out += offset.to_bytes(2, 'little')
+	if token_match == 15:
+		lz4_length(out, match_length - MIN_MATCH - 15)
+
+
+def lz4_compress(data):
+	out = bytearray()
+	chains = {}
+	anchor = 0
+	pos = 0
+	end = len(data) - LAST_LITERALS
+
+	# Greedy parse, but every earlier position is a candidate since
+	# fonts are tiny and the result is checked in
+	while pos + MATCH_LIMIT <= len(data):
+		key = data[pos:pos + MIN_MATCH]
+		best_length = 0
+		best_offset = 0
+		for candidate in reversed(chains.get(key, [])):
+			if pos - candidate > MAX_OFFSET:
+				break
+			length = 0
+			while pos + length < end and data[candidate + length] == data[pos + length]:
+				length += 1
+			if length > best_length:
+				best_length = length
+				best_offset = pos - candidate
+		chains.setdefault(key, []).append(pos)
+
+		if best_length < MIN_MATCH:
+			pos += 1
+			continue
+
+		lz4_sequence(out, data[anchor:pos], best_length, best_offset)
+		for skipped in range(pos + 1, pos + best_length):
+			chains.setdefault(data[skipped:skipped + MIN_MATCH], []).append(skipped)
+		pos += best_length
+		anchor = pos
+
+	lz4_sequence(out, data[anchor:], 0, None)
+	return bytes(out)
+
+
+def main():
+	source = open(sys.argv[1]).read()
+	match = re.search(r'UINT8 (FONTDATA_\w+)\[\] = \{', source)
+	name = match.group(1)
+	body = source[match.end():source.index('};', match.end())]
+	data = bytes(int(value, 16) for value in re.findall(r'0x([0-9a-fA-F]{2}),', body))
+	packed = lz4_compress(data)
+
+	# Keep the license and attribution of the original font source
+	lines = [source[:match.start()].rstrip() + '\n']
+	lines.append('/* Generated by FontPack.py from %s, do not edit */\n' % sys.argv[1])
+	lines.append('/* %u bytes packed into %u */\n\n' % (len(data), len(packed)))
+	lines.append('UINT8 %s_LZ4[] = {\n' % name)
+	for index in range(0, len(packed), 12):
+		lines.append(''.join('0x%02x, ' % value for value in packed[index:index + 12]).rstrip() + '\n')
+	lines.append('};\n\n')
+	lines.append('UINTN %s_LZ4_SIZE = sizeof(%s_LZ4);\n' % (name, name))
+
+	open(sys.argv[2], 'w').write(''.join(lines))
+
+
+if __name__ == '__main__':
+	main()
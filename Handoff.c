@@ -0,0 +1,331 @@
+/*
+ * Exit from the firmware into the kernel
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+#include <Protocol/LoadedImage.h>
+
+#include "Elf.h"
+#include "Boot.h"
+
+/* Stack the kernel starts on */
+#define HANDOFF_STACK_SIZE SIZE_64KB
+
+/* Descriptors the memory map may grow by after its buffer is allocated */
+#define HANDOFF_MAP_SLACK 64
+
+#define MSR_EFER 0xC0000080
+#define EFER_NXE BIT11
+
+/* The 5-level trampoline: code, HANDOFF_LA57 at HANDOFF_LA57_DATA with its stack below, a copy of the root table */
+#define HANDOFF_LA57_PAGES 2
+#define HANDOFF_LA57_DATA 0xF00
+#define HANDOFF_LA57_ROOT EFI_PAGE_SIZE
+
+/* Selectors in HANDOFF_LA57.Gdt */
+#define HANDOFF_CODE32 0x08
+#define HANDOFF_DATA   0x10
+#define HANDOFF_CODE64 0x18
+
+typedef struct {
+	UINT64 Gdt[4];        /* Null, 32-bit code, data, 64-bit code */
+	UINT16 Pad[3];
+	UINT16 GdtLimit;      /* lgdt operand at 0x26, the limit then the base */
+	UINT64 GdtBase;
+	UINT64 Root;          /* 0x30, the tables themselves may be above 4 GB */
+	UINT64 Stack;         /* 0x38 */
+	UINT64 Entry;         /* 0x40 */
+	UINT64 BootInfo;      /* 0x48 */
+} HANDOFF_LA57;
+
+/*
+ * CR4.LA57 can only change with paging off, which in turn needs
+ * compatibility mode and code below 4 GB that is identity mapped on both
+ * sides. boot_handoff_la57 is copied into the trampoline pages: it drops
+ * to a 32-bit segment, turns paging off, sets LA57, turns paging back on
+ * with the root table copy and continues like boot_handoff_jump. The
+ * offsets are those of HANDOFF_LA57 at HANDOFF_LA57_DATA.
+ */
+#ifdef __GNUC__
+__asm__(
+	".pushsection .text\n"
+	".globl boot_handoff_la57\n"
+	".globl boot_handoff_la57_end\n"
+	"boot_handoff_la57:\n"
+	"0:\n\t"
+	"lea 0b(%rip), %rbx\n\t"
+	"lgdt 0xF26(%rbx)\n\t"
+	"mov %cr4, %rax\n\t"
+	"btr $17, %rax\n\t"            /* CR4.PCIDE, paging cannot be turned off with it */
+	"mov %rax, %cr4\n\t"
+	"lea 1f(%rip), %rax\n\t"
+	"pushq $0x08\n\t"
+	"pushq %rax\n\t"
+	"lretq\n"
+	".code32\n"
+	"1:\n\t"
+	"mov $0x10, %eax\n\t"
+	"mov %eax, %ds\n\t"
+	"mov %eax, %es\n\t"
+	"mov %eax, %ss\n\t"
+	"lea 0xF00(%ebx), %esp\n\t"
+	"mov %cr0, %eax\n\t"
+	"btr $31, %eax\n\t"
+	"mov %eax, %cr0\n\t"           /* Paging off, long mode inactive */
+	"mov %cr4, %eax\n\t"
+	"bts $12, %eax\n\t"
+	"mov %eax, %cr4\n\t"           /* CR4.LA57 */
+	"lea 0x1000(%ebx), %eax\n\t"
+	"mov %eax, %cr3\n\t"
+	"mov %cr0, %eax\n\t"
+	"bts $31, %eax\n\t"
+	"mov %eax, %cr0\n\t"           /* EFER.LME is still set, long mode with 5 levels */
+	"lea (2f - 0b)(%ebx), %eax\n\t"
+	"push $0x18\n\t"
+	"push %eax\n\t"
+	"lret\n"
+	".code64\n"
+	"2:\n\t"
+	"mov %ebx, %ebx\n\t"           /* The upper halves are undefined after compatibility mode */
+	"mov 0xF30(%rbx), %rax\n\t"
+	"mov %rax, %cr3\n\t"
+	"mov 0xF38(%rbx), %rsp\n\t"
+	"mov 0xF48(%rbx), %rdi\n\t"
+	"mov 0xF40(%rbx), %rdx\n\t"
+	"pushq $0\n\t"
+	"xor %ebp, %ebp\n\t"
+	"jmp *%rdx\n"
+	"boot_handoff_la57_end:\n"
+	".popsection\n");
+#endif
+
+/* Defined above for GCC, in HandoffJump.nasm otherwise */
+extern UINT8 boot_handoff_la57[];
+extern UINT8 boot_handoff_la57_end[];
+
+/*
+ * Loader code rather than loaded pages, firmware that enforces NX keeps
+ * data types from running. The kernel gets them back as free memory.
+ */
+EFI_STATUS boot_handoff_trampoline(BOOT_HANDOFF *Handoff, PAGE_TABLES *Tables)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_PHYSICAL_ADDRESS Address = SIZE_4GB - 1;
+	HANDOFF_LA57 *Data;
+
+	Status = gBS->AllocatePages(AllocateMaxAddress, EfiLoaderCode, HANDOFF_LA57_PAGES, &Address);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating the 5-level paging trampoline: %lx\n", Status);
+		return Status;
+	}
+
+	Status = boot_paging_map(Tables, Address, Address, EFI_PAGES_TO_SIZE(HANDOFF_LA57_PAGES), PF_R | PF_W | PF_X);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while mapping the 5-level paging trampoline at %lx: %lx\n", Address, Status);
+		return Status;
+	}
+
+	Handoff->Trampoline = (UINT8*)(UINTN)Address;
+	gBS->CopyMem(Handoff->Trampoline, boot_handoff_la57, boot_handoff_la57_end - boot_handoff_la57);
+
+	Data = (HANDOFF_LA57*)(Handoff->Trampoline + HANDOFF_LA57_DATA);
+	Data->Gdt[0] = 0;
+	Data->Gdt[HANDOFF_CODE32 / 8] = 0x00CF9A000000FFFF;
+	Data->Gdt[HANDOFF_DATA / 8] = 0x00CF92000000FFFF;
+	Data->Gdt[HANDOFF_CODE64 / 8] = 0x00AF9A000000FFFF;
+	Data->GdtLimit = sizeof(Data->Gdt) - 1;
+	Data->GdtBase = (UINTN)Data->Gdt;
+
+	return Status;
+}
+
+/*
+ * Get what the exit needs while the firmware can still allocate: the
+ * loader mapped where it runs so it survives the switch to Tables, a
+ * stack for the kernel, and buffers for the memory map and its compacted
+ * ranges with room for whatever the firmware allocates before the exit.
+ * The buffers come last so that only the slack has to cover later changes.
+ */
+EFI_STATUS boot_handoff_prepare(BOOT_HANDOFF *Handoff, EFI_HANDLE ImageHandle, PAGE_TABLES *Tables, UINT64 Entry, BOOT_INFO *BootInfo)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_LOADED_IMAGE_PROTOCOL *LoadedImage;
+	BOOT_MEMORY_MAP *MemoryMap = &Handoff->MemoryMap;
+	EFI_PHYSICAL_ADDRESS Address;
+	UINT64 ImageStart;
+	UINT64 ImageEnd;
+
+	/* Segments are checked as they are mapped, the entry is only jumped to */
+	if(!boot_paging_canonical(Tables->Levels, Entry)) {
+		Print(L"Error while preparing handoff: entry point %lx is not canonical\n", Entry);
+		return EFI_INVALID_PARAMETER;
+	}
+
+	Handoff->Trampoline = NULL;
+	if(Tables->Levels == 5 && !boot_paging_la57_active()) {
+		Status = boot_handoff_trampoline(Handoff, Tables);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+
+	Status = gBS->HandleProtocol(ImageHandle, &gEfiLoadedImageProtocolGuid, (VOID**)&LoadedImage);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	ImageStart = (UINTN)LoadedImage->ImageBase & ~(UINT64)EFI_PAGE_MASK;
+	ImageEnd = ALIGN_VALUE((UINTN)LoadedImage->ImageBase + LoadedImage->ImageSize, EFI_PAGE_SIZE);
+	Status = boot_paging_map(Tables, ImageStart, ImageStart, ImageEnd - ImageStart, PF_R | PF_X);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while mapping the loader at %lx: %lx\n", ImageStart, Status);
+		return Status;
+	}
+
+	Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, EFI_SIZE_TO_PAGES(HANDOFF_STACK_SIZE), &Address);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating the kernel stack: %lx\n", Status);
+		return Status;
+	}
+
+	Handoff->ImageHandle = ImageHandle;
+	Handoff->Tables = Tables;
+	Handoff->BootInfo = BootInfo;
+	Handoff->Entry = Entry;
+	Handoff->Stack = BootConfig.DirectMapOffset + Address + HANDOFF_STACK_SIZE;
+
+	MemoryMap->MapSize = 0;
+	Status = gBS->GetMemoryMap(&MemoryMap->MapSize, NULL, &MemoryMap->MapKey, &MemoryMap->DescriptorSize, &MemoryMap->DescriptorVersion);
+	if(Status != EFI_BUFFER_TOO_SMALL)
+		return EFI_ERROR(Status) ? Status : EFI_DEVICE_ERROR;
+
+	MemoryMap->BufferSize = ALIGN_VALUE(MemoryMap->MapSize + HANDOFF_MAP_SLACK * MemoryMap->DescriptorSize, EFI_PAGE_SIZE);
+	Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, EFI_SIZE_TO_PAGES(MemoryMap->BufferSize / MemoryMap->DescriptorSize * sizeof(BOOT_INFO_MEMORY)), &Address);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating memory ranges: %lx\n", Status);
+		return Status;
+	}
+
+	Handoff->Memory = (BOOT_INFO_MEMORY*)(UINTN)Address;
+
+	Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, EFI_SIZE_TO_PAGES(MemoryMap->BufferSize), &Address);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating memory map buffer: %lx\n", Status);
+		return Status;
+	}
+
+	MemoryMap->Map = (EFI_MEMORY_DESCRIPTOR*)(UINTN)Address;
+
+	BootInfo->DirectMapOffset = BootConfig.DirectMapOffset;
+	BootInfo->MemoryMap = Address;
+
+	return Status;
+}
+
+/*
+ * Switch to the kernel page tables and stack, then jump to Entry with
+ * BootInfo as the first argument. This code is mapped at the same address
+ * on both sides of the switch and nothing is read from the old stack
+ * after it.
+ */
+#ifdef __GNUC__
+VOID boot_handoff_jump(UINT64 Root, UINT64 Stack, UINT64 Entry, UINT64 BootInfo)
+{
+	__asm__ __volatile__(
+		"mov %0, %%cr3\n\t"
+		"mov %1, %%rsp\n\t"
+		"pushq $0\n\t"          /* Return address of the entry, as after a call */
+		"xor %%ebp, %%ebp\n\t"
+		"jmp *%2"
+		: : "a"(Root), "c"(Stack), "d"(Entry), "D"(BootInfo) : "memory");
+}
+#else
+/* HandoffJump.nasm, for compilers without GCC inline assembly */
+VOID boot_handoff_jump(UINT64 Root, UINT64 Stack, UINT64 Entry, UINT64 BootInfo);
+#endif
+
+/*
+ * Leave the firmware and enter the kernel. From reading the memory map to
+ * the jump nothing may allocate or print, the map key would go stale, so
+ * everything else is done by boot_handoff_prepare. Returns only when
+ * ExitBootServices keeps refusing, and then boot services may be gone.
+ */
+EFI_STATUS boot_handoff(BOOT_HANDOFF *Handoff)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	BOOT_MEMORY_MAP *MemoryMap = &Handoff->MemoryMap;
+	BOOT_INFO *BootInfo = Handoff->BootInfo;
+
+	BootInfo->ExitBootServices = boot_timer_ticks();
+
+	/* An event may change the map between the two calls, it is read again once */
+	for(UINTN Attempt = 0; Attempt < 2; Attempt++) {
+		MemoryMap->MapSize = MemoryMap->BufferSize;
+		Status = gBS->GetMemoryMap(&MemoryMap->MapSize, MemoryMap->Map, &MemoryMap->MapKey, &MemoryMap->DescriptorSize, &MemoryMap->DescriptorVersion);
+		if(EFI_ERROR(Status))
+			return Status;
+
+		Status = gBS->ExitBootServices(Handoff->ImageHandle, MemoryMap->MapKey);
+		if(Status != EFI_INVALID_PARAMETER)
+			break;
+	}
+
+	if(EFI_ERROR(Status))
+		return Status;
+
+	DisableInterrupts();
+
+	BootInfo->MemoryMapSize = MemoryMap->MapSize;
+	BootInfo->MemoryMapDescriptorSize = MemoryMap->DescriptorSize;
+	BootInfo->MemoryMapDescriptorVersion = MemoryMap->DescriptorVersion;
+	BootInfo->Memory = (UINTN)Handoff->Memory;
+	BootInfo->NumberOfMemoryRanges = boot_memory_compact(MemoryMap, Handoff->Memory);
+
+	/* The tables use NX whenever the processor has it */
+	if(Handoff->Tables->NxBit)
+		AsmWriteMsr64(MSR_EFER, AsmReadMsr64(MSR_EFER) | EFER_NXE);
+
+	BootInfo->KernelEntry = boot_timer_ticks();
+	if(Handoff->Trampoline) {
+		HANDOFF_LA57 *Data = (HANDOFF_LA57*)(Handoff->Trampoline + HANDOFF_LA57_DATA);
+
+		CopyMem(Handoff->Trampoline + HANDOFF_LA57_ROOT, Handoff->Tables->Root, EFI_PAGE_SIZE);
+		Data->Root = (UINTN)Handoff->Tables->Root;
+		Data->Stack = Handoff->Stack;
+		Data->Entry = Handoff->Entry;
+		Data->BootInfo = BootInfo->DirectMapOffset + (UINTN)BootInfo;
+		((VOID (*)(VOID))(UINTN)Handoff->Trampoline)();
+	}
+
+	boot_handoff_jump((UINTN)Handoff->Tables->Root, Handoff->Stack, Handoff->Entry, BootInfo->DirectMapOffset + (UINTN)BootInfo);
+
+	return EFI_ABORTED;
+}
@@ -0,0 +1,134 @@
+/*
+ * Kernel address space layout randomization
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+/* Keep the kernel clear of low memory that firmware and devices like */
+#define KASLR_MIN_ADDRESS SIZE_16MB
+
+typedef struct {
+	EFI_PHYSICAL_ADDRESS First;  /* Lowest suitable base in the range */
+	UINT64 Slots;                /* Number of Alignment spaced bases */
+} KASLR_RANGE;
+
+/*
+ * Pick a random base for Pages congruent to Offset modulo Alignment out
+ * of the free memory in the map. One pass indexes the ranges that can
+ * hold the image together with how many bases each offers, the random
+ * slot number then selects the range and the base inside it.
+ */
+EFI_STATUS boot_kaslr_pick(BOOT_MEMORY_MAP *MemoryMap, UINTN Pages, UINTN Alignment, UINTN Offset, EFI_PHYSICAL_ADDRESS *Address)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN NumberOfDescriptors = MemoryMap->MapSize / MemoryMap->DescriptorSize;
+	EFI_MEMORY_DESCRIPTOR *Descriptor = MemoryMap->Map;
+	UINT64 Size = EFI_PAGES_TO_SIZE(Pages);
+	KASLR_RANGE *Index;
+	UINTN Count = 0;
+	UINT64 Total = 0;
+
+	Status = gBS->AllocatePool(EfiLoaderData, NumberOfDescriptors * sizeof(KASLR_RANGE), (VOID**)&Index);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	for(UINTN Entry = 0; Entry < NumberOfDescriptors; Entry++, Descriptor = NEXT_MEMORY_DESCRIPTOR(Descriptor, MemoryMap->DescriptorSize)) {
+		EFI_PHYSICAL_ADDRESS Start = Descriptor->PhysicalStart;
+		EFI_PHYSICAL_ADDRESS End = Start + EFI_PAGES_TO_SIZE(Descriptor->NumberOfPages);
+
+		if(Descriptor->Type != EfiConventionalMemory || End <= KASLR_MIN_ADDRESS)
+			continue;
+		if(Start < KASLR_MIN_ADDRESS)
+			Start = KASLR_MIN_ADDRESS;
+
+		Start += (Offset - Start) & (Alignment - 1);
+		if(Start >= End || End - Start < Size)
+			continue;
+
+		Index[Count].First = Start;
+		Index[Count].Slots = (End - Start - Size) / Alignment + 1;
+		Total += Index[Count].Slots;
+		Count++;
+	}
+
+	Status = EFI_NOT_FOUND;
+	if(Total) {
+		UINT64 Slot = boot_random() % Total;
+
+		for(UINTN Range = 0; Range < Count; Range++) {
+			if(Slot < Index[Range].Slots) {
+				*Address = Index[Range].First + Slot * Alignment;
+				Status = EFI_SUCCESS;
+				break;
+			}
+			Slot -= Index[Range].Slots;
+		}
+	}
+
+	gBS->FreePool(Index);
+
+	return Status;
+}
+
+EFI_STATUS boot_kaslr_allocate_pages(EFI_MEMORY_TYPE MemoryType, UINTN Pages, UINTN Alignment, UINTN Offset, EFI_PHYSICAL_ADDRESS *Address)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	BOOT_MEMORY_MAP MemoryMap;
+
+	Status = boot_get_memory_map(&MemoryMap);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = boot_kaslr_pick(&MemoryMap, Pages, Alignment, Offset, Address);
+	gBS->FreePool(MemoryMap.Map);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	return gBS->AllocatePages(AllocateAddress, MemoryType, Pages, Address);
+}
+
+/*
+ * Random load bias for a relocatable image inside the kaslr_window bytes
+ * above kernel_base. The bias is a multiple of the image alignment so Va
+ * stays congruent to the physical base picked above.
+ */
+UINT64 boot_kaslr_bias(ELF_IMAGE *Image)
+{
+	UINT64 Size = Image->Va + EFI_PAGES_TO_SIZE(Image->NumberOfPages);
+
+	if(BootConfig.KaslrWindow < Size)
+		return BootConfig.KernelBase;
+
+	return BootConfig.KernelBase + (boot_random() % ((BootConfig.KaslrWindow - Size) / Image->Alignment + 1)) * Image->Alignment;
+}
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+#
+# Write the CRC32C table the loader checks a kernel against
+#
+# Copyright (c) 2025 gabijaba.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. The name of the author may not be used to endorse or promote products
+#    derived from this software without specific prior written permission
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+# IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+# NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Usage: KernelCrc.py [--chunk-size BYTES] kernel
+#
+# Writes kernel.crc next to the file: a header with the chunk size and
+# the file size, followed by the CRC32C of each chunk of --chunk-size
+# bytes (1 MB by default). Run it on the file as it goes on the ESP,
+# after KernelPack.py if the kernel is compressed. The loader checks each
+# chunk as soon as it has been read and stops at the first bad one.
+#
+
+import argparse
+import struct
+import sys
+
+CRC_TABLE_MAGIC = 0x54435243
+CRC32C_POLYNOMIAL = 0x82F63B78
+
+
+def crc32c_table():
+	table = []
+	for index in range(256):
+		value = index
+		for bit in range(8):
+			value = (value >> 1) ^ (CRC32C_POLYNOMIAL if value & 1 else 0)
+		table.append(value)
+	return table
+
+
+def crc32c(table, data):
+	crc = 0xFFFFFFFF
+	for byte in data:
+		crc = table[(crc ^ byte) & 0xFF] ^ (crc >> 8)
+	return crc ^ 0xFFFFFFFF
+
+
+def main():
+	parser = argparse.ArgumentParser()
+	parser.add_argument('--chunk-size', type=lambda value: int(value, 0), default=1 << 20)
+	parser.add_argument('input')
+	args = parser.parse_args()
+
+	if args.chunk_size < 4096 or args.chunk_size & (args.chunk_size - 1):
+		sys.exit('KernelCrc.py: the chunk size must be a power of two of at least 4096')
+
+	data = open(args.input, 'rb').read()
+	table = crc32c_table()
+	crcs = [crc32c(table, data[offset:offset + args.chunk_size]) for offset in range(0, len(data), args.chunk_size)]
+
+	output = args.input + '.crc'
+	open(output, 'wb').write(struct.pack('<IIQ', CRC_TABLE_MAGIC, args.chunk_size, len(data)) +
+				 struct.pack('<%uI' % len(crcs), *crcs))
+	print('%s: %u chunks of %u bytes' % (output, len(crcs), args.chunk_size))
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+# Pack a kernel into independent Zstandard or LZ4 frames with a seek table
+#
+# Copyright (c) 2025 gabijaba.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. The name of the author may not be used to endorse or promote products
+#    derived from this software without specific prior written permission
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+# IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+# NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Usage: KernelPack.py [--frame-size BYTES] [--level N] [--lz4] kernel kernel.zst
+#
+# Splits the kernel into frames of --frame-size bytes (4 MB by default),
+# compresses each one on its own with the zstd command, or lz4 with
+# --lz4, and appends a seek table in the Zstandard seekable format. This
+# is the same layout as zstd seekable images from other tools, which the
+# loader reads as well. It finds the frames through the table and
+# decompresses them on all processors at once. Smaller frames spread
+# better across processors, larger ones compress a little better.
+#
+
+import argparse
+import shutil
+import struct
+import subprocess
+import sys
+
+SEEK_TABLE_SKIPPABLE_MAGIC = 0x184D2A5E
+SEEK_TABLE_MAGIC = 0x8F92EAB1
+
+
+def lz4_frame(data, level):
+	# Independent 4 MB blocks, the loader has no use for checksums
+	return subprocess.run(['lz4', '-q', '-%u' % level, '-B7', '-BI', '--no-frame-crc', '-c', '-'],
+			      input=data, stdout=subprocess.PIPE, check=True).stdout
+
+
+def zstd_frame(data, level):
+	# One frame per call, with the content size and without a checksum
+	return subprocess.run(['zstd', '-q', '--ultra', '-%u' % level, '--no-check', '--stream-size=%u' % len(data), '-c', '-'],
+			      input=data, stdout=subprocess.PIPE, check=True).stdout
+
+
+def main():
+	parser = argparse.ArgumentParser()
+	parser.add_argument('--frame-size', type=lambda value: int(value, 0), default=4 << 20)
+	parser.add_argument('--level', type=int)
+	parser.add_argument('--lz4', action='store_true')
+	parser.add_argument('input')
+	parser.add_argument('output')
+	args = parser.parse_args()
+
+	command, compress, level = ('lz4', lz4_frame, 9) if args.lz4 else ('zstd', zstd_frame, 19)
+	if args.level is not None:
+		level = args.level
+	if not shutil.which(command):
+		sys.exit('KernelPack.py: the %s command is required' % command)
+
+	data = open(args.input, 'rb').read()
+	frames = []
+	entries = bytearray()
+	for offset in range(0, len(data), args.frame_size):
+		chunk = data[offset:offset + args.frame_size]
+		frame = compress(chunk, level)
+		frames.append(frame)
+		entries += struct.pack('<II', len(frame), len(chunk))
+
+	footer = struct.pack('<IBI', len(frames), 0, SEEK_TABLE_MAGIC)
+	table = struct.pack('<II', SEEK_TABLE_SKIPPABLE_MAGIC, len(entries) + len(footer)) + entries + footer
+
+	packed = b''.join(frames) + table
+	open(args.output, 'wb').write(packed)
+	print('%s: %u bytes in %u frames, %u bytes packed' % (args.output, len(data), len(frames), len(packed)))
+
+
+if __name__ == '__main__':
+	main()
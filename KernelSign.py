@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# Sign kernels and build the public key into the loader
+#
+# Copyright (c) 2025 gabijaba.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. The name of the author may not be used to endorse or promote products
+#    derived from this software without specific prior written permission
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+# IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+# IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+# NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Usage: KernelSign.py key boot.pub PublicKey.c
+#        KernelSign.py sign [--blake3] boot.key kernel
+#
+# The loader verifies an Ed25519 signature over the 32-byte digest of the
+# kernel file as stored, after KernelPack.py if it is compressed. That is
+# the BLAKE3 digest when kernel_blake3 or kernel.b3 is set up and the
+# SHA-256 digest otherwise. A key pair comes from openssl:
+#
+#   openssl genpkey -algorithm ed25519 -out boot.key
+#   openssl pkey -in boot.key -pubout -out boot.pub
+#
+# "key" writes the public key into PublicKey.c, after which Boot.efi
+# refuses kernels without a good kernel.sig next to them. "sign" writes
+# kernel.sig with openssl pkeyutl. The initrd= and module= files of
+# boot.cfg are checked the same way and need a .sig of their own.
+#
+
+import argparse
+import hashlib
+import subprocess
+import sys
+import tempfile
+
+# DER SubjectPublicKeyInfo prefix of an Ed25519 public key
+ED25519_SPKI_PREFIX = bytes.fromhex('302a300506032b6570032100')
+
+
+def public_key(path):
+	der = subprocess.run(['openssl', 'pkey', '-pubin', '-in', path, '-outform', 'DER'],
+			     stdout=subprocess.PIPE, check=True).stdout
+	if len(der) != 44 or not der.startswith(ED25519_SPKI_PREFIX):
+		sys.exit('KernelSign.py: %s is not an Ed25519 public key' % path)
+	return der[12:]
+
+
+def write_key(args):
+	key = public_key(args.public)
+	header = open(__file__).read().split('# Usage:')[0].split('\n', 2)[2]
+	header = ''.join(' *' + line[1:] + '\n' for line in header.splitlines())
+	header = header.replace('Sign kernels and build the public key into the loader', 'Kernel signing key, written by KernelSign.py')
+	rows = ',\n'.join('\t' + ', '.join('0x%02X' % byte for byte in key[offset:offset + 8]) for offset in range(0, 32, 8))
+
+	open(args.output, 'w').write('/*\n' + header + ' */\n\n#include <Uefi.h>\n\n#include "Boot.h"\n\n' +
+				     '/* Kernels must carry an Ed25519 signature by this key, all zero turns the check off */\n' +
+				     'UINT8 BootPublicKey[32] = {\n' + rows + ',\n};\n')
+	print('%s: %s' % (args.output, key.hex()))
+
+
+def blake3_digest(data):
+	# The blake3 module if it is installed, the b3sum command otherwise
+	try:
+		import blake3
+		return blake3.blake3(data).digest()
+	except ImportError:
+		return subprocess.run(['b3sum', '--raw', '--length', '32', '-'], input=data,
+				      stdout=subprocess.PIPE, check=True).stdout
+
+
+def sign(args):
+	data = open(args.kernel, 'rb').read()
+	if args.blake3:
+		digest = blake3_digest(data)
+	else:
+		digest = hashlib.sha256(data).digest()
+
+	# pkeyutl only signs raw Ed25519 input from a file it can size up
+	output = args.kernel + '.sig'
+	with tempfile.NamedTemporaryFile() as message:
+		message.write(digest)
+		message.flush()
+		subprocess.run(['openssl', 'pkeyutl', '-sign', '-rawin', '-inkey', args.private, '-in', message.name, '-out', output], check=True)
+	print('%s: %s %s' % (output, 'BLAKE3' if args.blake3 else 'SHA-256', digest.hex()))
+
+
+def main():
+	parser = argparse.ArgumentParser()
+	commands = parser.add_subparsers(dest='command', required=True)
+
+	key = commands.add_parser('key')
+	key.add_argument('public')
+	key.add_argument('output')
+	key.set_defaults(run=write_key)
+
+	signing = commands.add_parser('sign')
+	signing.add_argument('--blake3', action='store_true')
+	signing.add_argument('private')
+	signing.add_argument('kernel')
+	signing.set_defaults(run=sign)
+
+	args = parser.parse_args()
+	args.run(args)
+
+
+if __name__ == '__main__':
+	main()
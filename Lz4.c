@@ -0,0 +1,201 @@
+/*
+ * LZ4 block decompression
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Lz4.h"
+#include "Boot.h"
+
+#define LZ4_MIN_MATCH 4
+
+/*
+ * Lengths of 15 continue in the following bytes, every 255 means
+ * another byte follows.
+ */
+BOOLEAN boot_lz4_length(UINT8 **Input, UINT8 *InputEnd, UINTN *Length)
+{
+	UINT8 Extra;
+
+	if(*Length != 15)
+		return TRUE;
+
+	do {
+		if(*Input >= InputEnd)
+			return FALSE;
+		Extra = *(*Input)++;
+		*Length += Extra;
+	} while(Extra == 255);
+
+	return TRUE;
+}
+
+/*
+ * The decoder copies with BaseMemoryLib rather than boot services, it
+ * also runs on application processors.
+ */
+
+/*
+ * Decompress one raw LZ4 block. Matches may reach up to Prefix bytes
+ * before Destination, which is how linked blocks of a frame refer to
+ * the output of the blocks before them.
+ */
+EFI_STATUS boot_lz4_decompress_prefix(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, UINTN Prefix, UINTN *DecompressedSize)
+{
+	UINT8 *Input = Source;
+	UINT8 *InputEnd = Source + SourceSize;
+	UINT8 *Output = Destination;
+	UINT8 *OutputEnd = Destination + DestinationSize;
+
+	while(Input < InputEnd) {
+		UINT8 Token = *Input++;
+		UINTN Length = Token >> 4;
+		UINTN Offset;
+		UINT8 *Match;
+
+		/* Literals */
+		if(!boot_lz4_length(&Input, InputEnd, &Length) ||
+		   Length > (UINTN)(InputEnd - Input) ||
+		   Length > (UINTN)(OutputEnd - Output))
+			return EFI_VOLUME_CORRUPTED;
+
+		CopyMem((VOID*)Output, (VOID*)Input, Length);
+		Input += Length;
+		Output += Length;
+
+		/* The last sequence ends after its literals */
+		if(Input == InputEnd)
+			break;
+
+		/* Match */
+		if(InputEnd - Input < 2)
+			return EFI_VOLUME_CORRUPTED;
+
+		Offset = Input[0] | (Input[1] << 8);
+		Input += 2;
+
+		Length = Token & 0xF;
+		if(!boot_lz4_length(&Input, InputEnd, &Length))
+			return EFI_VOLUME_CORRUPTED;
+		Length += LZ4_MIN_MATCH;
+
+		if(Offset == 0 ||
+		   Offset > (UINTN)(Output - Destination) + Prefix ||
+		   Length > (UINTN)(OutputEnd - Output))
+			return EFI_VOLUME_CORRUPTED;
+
+		Match = Output - Offset;
+		if(Offset >= Length) {
+			CopyMem((VOID*)Output, (VOID*)Match, Length);
+			Output += Length;
+		} else {
+			/* Overlapping matches repeat the last Offset bytes */
+			while(Length--)
+				*Output++ = *Match++;
+		}
+	}
+
+	*DecompressedSize = Output - Destination;
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS boot_lz4_decompress(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, UINTN *DecompressedSize)
+{
+	return boot_lz4_decompress_prefix(Source, SourceSize, Destination, DestinationSize, 0, DecompressedSize);
+}
+
+UINT32 boot_lz4_le32(UINT8 *Bytes)
+{
+	return Bytes[0] | (Bytes[1] << 8) | (Bytes[2] << 16) | ((UINT32)Bytes[3] << 24);
+}
+
+/*
+ * Decompress a whole LZ4 frame held in memory. Linked blocks find their
+ * history in the output written so far. Checksums are not verified.
+ */
+EFI_STATUS boot_lz4_frame_decompress(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, UINTN *DecompressedSize)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT8 *Input = Source;
+	UINT8 *InputEnd = Source + SourceSize;
+	UINTN Output = 0;
+	UINT8 Flg;
+
+	if(SourceSize < 7 || boot_lz4_le32(Input) != LZ4_FRAME_MAGIC)
+		return EFI_VOLUME_CORRUPTED;
+
+	Flg = Input[4];
+	if(LZ4_FLG_VERSION(Flg) != 1 || (Flg & LZ4_FLG_DICTIONARY))
+		return EFI_UNSUPPORTED;
+
+	Input += 4 + 2 + ((Flg & LZ4_FLG_CONTENT_SIZE) ? 8 : 0) + 1;
+
+	for(;;) {
+		UINT32 BlockSize;
+		UINTN DataSize;
+		UINTN Length;
+
+		if(InputEnd - Input < 4)
+			return EFI_VOLUME_CORRUPTED;
+
+		BlockSize = boot_lz4_le32(Input);
+		Input += 4;
+		if(BlockSize == 0)
+			break;
+
+		DataSize = BlockSize & ~LZ4_BLOCK_UNCOMPRESSED;
+		if(DataSize > (UINTN)(InputEnd - Input))
+			return EFI_VOLUME_CORRUPTED;
+
+		if(BlockSize & LZ4_BLOCK_UNCOMPRESSED) {
+			if(DataSize > DestinationSize - Output)
+				return EFI_VOLUME_CORRUPTED;
+
+			CopyMem(Destination + Output, Input, DataSize);
+			Length = DataSize;
+		} else {
+			Status = boot_lz4_decompress_prefix(Input, DataSize, Destination + Output, DestinationSize - Output,
+							    (Flg & LZ4_FLG_INDEPENDENT) ? 0 : Output, &Length);
+			if(EFI_ERROR(Status))
+				return Status;
+		}
+
+		Input += DataSize + ((Flg & LZ4_FLG_BLOCK_CHECKSUM) ? 4 : 0);
+		Output += Length;
+	}
+
+	*DecompressedSize = Output;
+
+	return Status;
+}
@@ -0,0 +1,253 @@
+/*
+ * Boot memory allocation
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+/*
+ * Allocate Pages so that the returned address is congruent to Offset
+ * modulo Alignment. The range is over-allocated by one Alignment and the
+ * unused head and tail are given back.
+ */
+EFI_STATUS boot_allocate_aligned_pages(EFI_MEMORY_TYPE MemoryType, UINTN Pages, UINTN Alignment, UINTN Offset, EFI_PHYSICAL_ADDRESS *Address)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	EFI_PHYSICAL_ADDRESS Base;
+	EFI_PHYSICAL_ADDRESS Start;
+	UINTN SlackPages;
+	UINTN HeadPages;
+
+	if(Alignment <= EFI_PAGE_SIZE)
+		return gBS->AllocatePages(AllocateAnyPages, MemoryType, Pages, Address);
+
+	SlackPages = EFI_SIZE_TO_PAGES(Alignment);
+
+	Status = gBS->AllocatePages(AllocateAnyPages, MemoryType, Pages + SlackPages, &Base);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Start = Base + ((Offset - Base) & (Alignment - 1));
+	HeadPages = EFI_SIZE_TO_PAGES(Start - Base);
+
+	if(HeadPages)
+		gBS->FreePages(Base, HeadPages);
+	if(SlackPages - HeadPages)
+		gBS->FreePages(Start + EFI_PAGES_TO_SIZE(Pages), SlackPages - HeadPages);
+
+	*Address = Start;
+
+	return Status;
+}
+
+/*
+ * Fetch the current memory map into a fresh pool buffer. A few spare
+ * descriptors are added since the allocation itself can split a range.
+ */
+EFI_STATUS boot_get_memory_map(BOOT_MEMORY_MAP *MemoryMap)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	MemoryMap->Map = NULL;
+	MemoryMap->MapSize = 0;
+
+	Status = gBS->GetMemoryMap(&MemoryMap->MapSize, NULL, &MemoryMap->MapKey, &MemoryMap->DescriptorSize, &MemoryMap->DescriptorVersion);
+	if(Status != EFI_BUFFER_TOO_SMALL)
+		return EFI_ERROR(Status) ? Status : EFI_DEVICE_ERROR;
+
+	do {
+		MemoryMap->MapSize += 8 * MemoryMap->DescriptorSize;
+		MemoryMap->BufferSize = MemoryMap->MapSize;
+
+		if(MemoryMap->Map)
+			gBS->FreePool(MemoryMap->Map);
+
+		Status = gBS->AllocatePool(EfiLoaderData, MemoryMap->BufferSize, (VOID**)&MemoryMap->Map);
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while allocating memory map buffer: %lx\n", Status);
+			return Status;
+		}
+
+		Status = gBS->GetMemoryMap(&MemoryMap->MapSize, MemoryMap->Map, &MemoryMap->MapKey, &MemoryMap->DescriptorSize, &MemoryMap->DescriptorVersion);
+	} while(Status == EFI_BUFFER_TOO_SMALL);
+
+	return Status;
+}
+
+BOOLEAN boot_memory_is_ram(UINT32 Type)
+{
+	switch(Type) {
+	case EfiLoaderCode:
+	case EfiLoaderData:
+	case EfiBootServicesCode:
+	case EfiBootServicesData:
+	case EfiRuntimeServicesCode:
+	case EfiRuntimeServicesData:
+	case EfiConventionalMemory:
+	case EfiACPIReclaimMemory:
+	case EfiACPIMemoryNVS:
+	case EfiPersistentMemory:
+	case BOOT_EFI_MEMORY_LOADED:
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/*
+ * What a firmware memory type is to the kernel. Loader code and data left
+ * at the exit is pool, console buffers and the font, as free as boot
+ * services memory, since what the kernel keeps is BOOT_EFI_MEMORY_LOADED.
+ */
+UINT32 boot_memory_kind(UINT32 Type)
+{
+	switch(Type) {
+	case EfiConventionalMemory:
+		return BOOT_MEMORY_USABLE;
+	case EfiLoaderCode:
+	case EfiLoaderData:
+	case EfiBootServicesCode:
+	case EfiBootServicesData:
+		return BOOT_MEMORY_RECLAIMABLE;
+	case BOOT_EFI_MEMORY_LOADED:
+		return BOOT_MEMORY_LOADED;
+	case EfiACPIReclaimMemory:
+		return BOOT_MEMORY_ACPI_RECLAIMABLE;
+	case EfiACPIMemoryNVS:
+		return BOOT_MEMORY_ACPI_NVS;
+	case EfiRuntimeServicesCode:
+	case EfiRuntimeServicesData:
+		return BOOT_MEMORY_RUNTIME;
+	case EfiPersistentMemory:
+		return BOOT_MEMORY_PERSISTENT;
+	}
+
+	return BOOT_MEMORY_RESERVED;
+}
+
+/*
+ * Reduce the memory map to sorted, coalesced ranges of RAM regardless of
+ * type, so the result stays valid while the loader keeps allocating.
+ */
+EFI_STATUS boot_memory_ram_ranges(BOOT_MEMORY_MAP *MemoryMap, BOOT_MEMORY_RANGE **Ranges, UINTN *NumberOfRanges)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN NumberOfDescriptors = MemoryMap->MapSize / MemoryMap->DescriptorSize;
+	EFI_MEMORY_DESCRIPTOR *Descriptor = MemoryMap->Map;
+	BOOT_MEMORY_RANGE *Range;
+	UINTN Count = 0;
+
+	Status = gBS->AllocatePool(EfiLoaderData, NumberOfDescriptors * sizeof(BOOT_MEMORY_RANGE), (VOID**)&Range);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating memory range list: %lx\n", Status);
+		return Status;
+	}
+
+	for(UINTN Index = 0; Index < NumberOfDescriptors; Index++, Descriptor = NEXT_MEMORY_DESCRIPTOR(Descriptor, MemoryMap->DescriptorSize)) {
+		BOOT_MEMORY_RANGE Next;
+
+		if(!boot_memory_is_ram(Descriptor->Type) || Descriptor->NumberOfPages == 0)
+			continue;
+
+		Next.Start = Descriptor->PhysicalStart;
+		Next.End = Descriptor->PhysicalStart + EFI_PAGES_TO_SIZE(Descriptor->NumberOfPages);
+
+		/* Firmware maps are almost always sorted already */
+		UINTN Slot = Count;
+		while(Slot > 0 && Range[Slot - 1].Start > Next.Start) {
+			Range[Slot] = Range[Slot - 1];
+			Slot--;
+		}
+		Range[Slot] = Next;
+		Count++;
+	}
+
+	UINTN Merged = 0;
+	for(UINTN Index = 0; Index < Count; Index++) {
+		if(Merged > 0 && Range[Merged - 1].End >= Range[Index].Start) {
+			if(Range[Index].End > Range[Merged - 1].End)
+				Range[Merged - 1].End = Range[Index].End;
+		} else {
+			Range[Merged++] = Range[Index];
+		}
+	}
+
+	*Ranges = Range;
+	*NumberOfRanges = Merged;
+
+	return Status;
+}
+
+/*
+ * Reduce the memory map to BOOT_INFO_MEMORY ranges sorted by address, with
+ * touching ranges of the same kind merged. Called after ExitBootServices,
+ * so it only works in place: Ranges must have room for one entry per
+ * descriptor. Returns the number of ranges.
+ */
+UINTN boot_memory_compact(BOOT_MEMORY_MAP *MemoryMap, BOOT_INFO_MEMORY *Ranges)
+{
+	UINTN NumberOfDescriptors = MemoryMap->MapSize / MemoryMap->DescriptorSize;
+	EFI_MEMORY_DESCRIPTOR *Descriptor = MemoryMap->Map;
+	UINTN Count = 0;
+
+	for(UINTN Index = 0; Index < NumberOfDescriptors; Index++, Descriptor = NEXT_MEMORY_DESCRIPTOR(Descriptor, MemoryMap->DescriptorSize)) {
+		BOOT_INFO_MEMORY Next;
+
+		if(Descriptor->NumberOfPages == 0)
+			continue;
+
+		Next.Pa = Descriptor->PhysicalStart;
+		Next.Size = EFI_PAGES_TO_SIZE(Descriptor->NumberOfPages);
+		Next.Type = boot_memory_kind(Descriptor->Type);
+		Next.Reserved = 0;
+
+		/* Firmware maps are almost always sorted already */
+		UINTN Slot = Count;
+		while(Slot > 0 && Ranges[Slot - 1].Pa > Next.Pa) {
+			Ranges[Slot] = Ranges[Slot - 1];
+			Slot--;
+		}
+		Ranges[Slot] = Next;
+		Count++;
+	}
+
+	UINTN Merged = 0;
+	for(UINTN Index = 0; Index < Count; Index++) {
+		if(Merged > 0 && Ranges[Merged - 1].Type == Ranges[Index].Type && Ranges[Merged - 1].Pa + Ranges[Merged - 1].Size == Ranges[Index].Pa)
+			Ranges[Merged - 1].Size += Ranges[Index].Size;
+		else
+			Ranges[Merged++] = Ranges[Index];
+	}
+
+	return Merged;
+}
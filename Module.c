@@ -0,0 +1,164 @@
+/*
+ * Initrd and modules loaded along with the kernel
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+typedef struct {
+	BOOT_STREAM Stream;
+	BOOLEAN Open;
+	BOOT_VERIFY Verify;
+	UINT64 Size;
+	UINT64 Disk;          /* Partition offset of the first byte, MAX_UINT64 if unknown */
+	UINT64 Offset;        /* Where the file goes in the shared allocation */
+} MODULE_LOAD;
+
+/*
+ * Load the files of Manifest into one allocation and describe them in
+ * Modules, in manifest order. Every file is opened and sized before the
+ * first read, so the reads go back to back without directory lookups in
+ * between, in the order the files lie on the disk. Files read through
+ * the driver follow in manifest order.
+ */
+EFI_STATUS boot_load_modules(BOOT_MANIFEST *Manifest, EFI_FILE_PROTOCOL *Volume, BOOT_INFO_MODULE *Modules)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Count = Manifest->NumberOfEntries;
+	MODULE_LOAD *Loads;
+	UINTN *Order;
+	UINT64 Total = 0;
+	EFI_PHYSICAL_ADDRESS Base = 0;
+	UINTN Pages = 0;
+#ifdef BOOT_BENCHMARK
+	UINT64 Start = boot_timer_ticks();
+#endif
+
+	if(Count == 0)
+		return Status;
+
+	Status = gBS->AllocatePool(EfiLoaderData, Count * (sizeof(MODULE_LOAD) + sizeof(UINTN)), (VOID**)&Loads);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating memory: %lx\n", Status);
+		return Status;
+	}
+
+	gBS->SetMem(Loads, Count * sizeof(MODULE_LOAD), 0);
+	Order = (UINTN*)(Loads + Count);
+
+	for(UINTN Index = 0; Index < Count; Index++) {
+		MODULE_LOAD *Load = &Loads[Index];
+		CHAR16 *FileName = Manifest->Entries[Index].FileName;
+		UINTN Slot = Index;
+
+		Status = boot_verify_prepare(FileName, Volume, NULL, NULL, &Load->Verify);
+		if(EFI_ERROR(Status))
+			break;
+
+		Status = boot_stream_open(FileName, Volume, Load->Verify.Hash, &Load->Stream);
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while opening module: %S, %lx\n", FileName, Status);
+			break;
+		}
+		Load->Open = TRUE;
+
+		Status = boot_stream_size(&Load->Stream, &Load->Size);
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while sizing module: %S, %lx\n", FileName, Status);
+			break;
+		}
+
+		/* Each file starts on a page of its own */
+		Load->Offset = Total;
+		Load->Disk = boot_stream_disk_offset(&Load->Stream);
+		Total += ALIGN_VALUE(Load->Size, EFI_PAGE_SIZE);
+
+		while(Slot > 0 && Loads[Order[Slot - 1]].Disk > Load->Disk) {
+			Order[Slot] = Order[Slot - 1];
+			Slot--;
+		}
+		Order[Slot] = Index;
+	}
+
+	if(!EFI_ERROR(Status)) {
+		Pages = MAX(EFI_SIZE_TO_PAGES(Total), 1);
+		Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, Pages, &Base);
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while allocating module memory: %lx\n", Status);
+			Pages = 0;
+		}
+	}
+
+	for(UINTN Step = 0; !EFI_ERROR(Status) && Step < Count; Step++) {
+		BOOT_MANIFEST_ENTRY *Entry = &Manifest->Entries[Order[Step]];
+		MODULE_LOAD *Load = &Loads[Order[Step]];
+		UINT8 *Destination = (UINT8*)(UINTN)(Base + Load->Offset);
+		UINTN Size = Load->Size;
+
+		Status = boot_stream_read(&Load->Stream, 0, &Size, Destination);
+		if(!EFI_ERROR(Status) && Size != Load->Size)
+			Status = EFI_VOLUME_CORRUPTED;
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while reading module: %S, %lx\n", Entry->FileName, Status);
+			break;
+		}
+
+		Status = boot_verify_finish(Entry->FileName, &Load->Stream, &Load->Verify);
+		if(EFI_ERROR(Status))
+			break;
+
+		/* The rest of the last page is zero */
+		gBS->SetMem(Destination + Size, ALIGN_VALUE(Size, EFI_PAGE_SIZE) - Size, 0);
+		boot_info_module(&Modules[Order[Step]], Entry->FileName, Entry->Type, Base + Load->Offset, Load->Size);
+
+		boot_stream_close(Entry->FileName, &Load->Stream);
+		Load->Open = FALSE;
+	}
+
+	for(UINTN Index = 0; Index < Count; Index++) {
+		if(Loads[Index].Open)
+			boot_stream_close(Manifest->Entries[Index].FileName, &Loads[Index].Stream);
+	}
+
+	if(EFI_ERROR(Status) && Pages)
+		gBS->FreePages(Base, Pages);
+
+	gBS->FreePool(Loads);
+
+#ifdef BOOT_BENCHMARK
+	if(!EFI_ERROR(Status))
+		Print(L"Modules: %lu files, %lu KB in %lu us\n", Count, Total / SIZE_1KB, boot_timer_us(boot_timer_ticks() - Start));
+#endif
+
+	return Status;
+}
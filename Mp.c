@@ -0,0 +1,103 @@
+/*
+ * Work on application processors
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+#include <Protocol/MpService.h>
+
+#include "Boot.h"
+
+/*
+ * Procedures started here run on every enabled AP at once while the BSP
+ * carries on. They must not call boot services, and they share work with
+ * the BSP through the argument they are given.
+ */
+
+EFI_MP_SERVICES_PROTOCOL *BootMp;
+UINTN BootMpProcessors;
+
+/* Number of enabled processors including the BSP */
+UINTN boot_mp_processors()
+{
+	UINTN NumberOfProcessors;
+
+	if(BootMpProcessors)
+		return BootMpProcessors;
+
+	BootMpProcessors = 1;
+	if(EFI_ERROR(gBS->LocateProtocol(&gEfiMpServiceProtocolGuid, NULL, (VOID**)&BootMp))) {
+		BootMp = NULL;
+		return BootMpProcessors;
+	}
+
+	if(EFI_ERROR(BootMp->GetNumberOfProcessors(BootMp, &NumberOfProcessors, &BootMpProcessors)) || BootMpProcessors == 0)
+		BootMpProcessors = 1;
+
+	return BootMpProcessors;
+}
+
+/*
+ * Start Procedure on all APs without waiting for it. Done is set to the
+ * event boot_mp_wait waits on, or NULL if no AP took the work.
+ */
+EFI_STATUS boot_mp_start(BOOT_AP_PROCEDURE Procedure, VOID *Argument, EFI_EVENT *Done)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	*Done = NULL;
+
+	if(boot_mp_processors() < 2)
+		return EFI_NOT_STARTED;
+
+	Status = gBS->CreateEvent(0, TPL_CALLBACK, NULL, NULL, Done);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = BootMp->StartupAllAPs(BootMp, (EFI_AP_PROCEDURE)Procedure, FALSE, *Done, 0, Argument, NULL);
+	if(EFI_ERROR(Status)) {
+		gBS->CloseEvent(*Done);
+		*Done = NULL;
+	}
+
+	return Status;
+}
+
+VOID boot_mp_wait(EFI_EVENT Done)
+{
+	UINTN Index;
+
+	if(!Done)
+		return;
+
+	gBS->WaitForEvent(1, &Done, &Index);
+	gBS->CloseEvent(Done);
+}
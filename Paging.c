@@ -0,0 +1,302 @@
+/*
+ * x86-64 page table construction
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Elf.h"
+#include "Boot.h"
+
+#define PTE_PRESENT 0x1ULL
+#define PTE_WRITE   0x2ULL
+#define PTE_LARGE   0x80ULL                   /* PS bit of PDPTE and PDE */
+#define PTE_NX      0x8000000000000000ULL
+#define PTE_ADDRESS 0x000FFFFFFFFFF000ULL
+
+/* Level 1 is the page table, level 4 the PML4, level 5 the PML5 */
+#define PAGE_LEVEL_SHIFT(Level) (12 + 9 * ((Level) - 1))
+#define PAGE_LEVEL_SIZE(Level) (1ULL << PAGE_LEVEL_SHIFT(Level))
+#define PAGE_LEVEL_INDEX(Va, Level) (((Va) >> PAGE_LEVEL_SHIFT(Level)) & 0x1FF)
+
+/*
+ * Worst case number of table pages needed to map Size bytes: one table per
+ * level for every span it covers, plus one at each end for misalignment.
+ */
+UINTN boot_paging_estimate(UINT64 Size, UINTN Levels)
+{
+	UINTN Pages = (Size >> 21) + (Size >> 30) + (Size >> 39) + 6;
+
+	if(Levels == 5)
+		Pages += (Size >> 48) + 2;
+
+	return Pages;
+}
+
+/*
+ * The direct map only needs small tables at the unaligned ends of every
+ * range, so its cost follows the number of ranges rather than their size.
+ */
+UINTN boot_paging_estimate_direct(BOOT_MEMORY_RANGE *Ranges, UINTN NumberOfRanges, UINTN Levels)
+{
+	BOOLEAN Gigabyte = boot_paging_gigabyte();
+	UINTN Pages = 0;
+
+	for(UINTN Index = 0; Index < NumberOfRanges; Index++) {
+		UINT64 Size = Ranges[Index].End - Ranges[Index].Start;
+
+		Pages += 2 + (Gigabyte ? 2 : (Size >> 30) + 2) + (Size >> 39) + 2;
+		if(Levels == 5)
+			Pages += (Size >> 48) + 2;
+	}
+
+	return Pages;
+}
+
+UINTN boot_paging_estimate_image(ELF_IMAGE *Image, UINTN Levels)
+{
+	UINTN Pages = 1;
+
+	for(UINTN Index = 0; Index < Image->NumberOfSegments; Index++)
+		Pages += boot_paging_estimate(EFI_PAGES_TO_SIZE(Image->Segments[Index].NumberOfPages), Levels);
+
+	return Pages;
+}
+
+UINT64 *boot_paging_alloc(PAGE_TABLES *Tables)
+{
+	UINT64 *Table;
+
+	if(Tables->UsedPages == Tables->PoolPages)
+		return NULL;
+
+	Table = (UINT64*)(Tables->Pool + EFI_PAGES_TO_SIZE(Tables->UsedPages));
+	Tables->UsedPages++;
+
+	gBS->SetMem((VOID*)Table, EFI_PAGE_SIZE, 0);
+
+	return Table;
+}
+
+UINT32 boot_paging_features()
+{
+	UINT32 MaxExtended;
+	UINT32 Edx = 0;
+
+	AsmCpuid(0x80000000, &MaxExtended, NULL, NULL, NULL);
+	if(MaxExtended >= 0x80000001)
+		AsmCpuid(0x80000001, NULL, NULL, NULL, &Edx);
+
+	return Edx;
+}
+
+BOOLEAN boot_paging_gigabyte()
+{
+	/* CPUID.80000001H:EDX.Page1GB */
+	return (boot_paging_features() & (1 << 26)) != 0;
+}
+
+/*
+ * 5-level paging needs CPUID.(EAX=07H,ECX=0):ECX.LA57. Firmware that
+ * already runs with CR4.LA57 set can only be handed 5-level tables, on
+ * 4-level firmware boot_handoff switches with a trampoline.
+ */
+BOOLEAN boot_paging_la57_supported()
+{
+	UINT32 MaxLeaf;
+	UINT32 Ecx = 0;
+
+	AsmCpuid(0, &MaxLeaf, NULL, NULL, NULL);
+	if(MaxLeaf >= 7)
+		AsmCpuidEx(7, 0, NULL, NULL, &Ecx, NULL);
+
+	return (Ecx & (1 << 16)) != 0;
+}
+
+BOOLEAN boot_paging_la57_active()
+{
+	return (AsmReadCr4() & (1 << 12)) != 0;
+}
+
+UINTN boot_paging_levels(BOOLEAN Requested)
+{
+	if(boot_paging_la57_active())
+		return 5;
+
+	if(!Requested)
+		return 4;
+
+	if(!boot_paging_la57_supported()) {
+		Print(L"5-level paging requested but not supported, using 4 levels\n");
+		return 4;
+	}
+
+	return 5;
+}
+
+/* Bits above the top level must copy the highest bit it translates */
+BOOLEAN boot_paging_canonical(UINTN Levels, UINT64 Va)
+{
+	UINTN Shift = 64 - (PAGE_LEVEL_SHIFT(Levels) + 9);
+
+	return (UINT64)((INT64)(Va << Shift) >> Shift) == Va;
+}
+
+EFI_STATUS boot_paging_init(PAGE_TABLES *Tables, UINTN PoolPages, UINTN Levels)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	/* NX is a reserved bit without EFER.NXE support */
+	Tables->NxBit = (boot_paging_features() & (1 << 20)) ? PTE_NX : 0;
+	Tables->Gigabyte = boot_paging_gigabyte();
+
+	Status = gBS->AllocatePages(AllocateAnyPages, BOOT_MEMORY_TYPE_LOADED, PoolPages, (EFI_PHYSICAL_ADDRESS *)&Tables->Pool);
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while allocating page table pool: %lx\n", Status);
+		return Status;
+	}
+
+	Tables->PoolPages = PoolPages;
+	Tables->UsedPages = 0;
+	Tables->Levels = Levels;
+	Tables->Root = boot_paging_alloc(Tables);
+
+	return Status;
+}
+
+/*
+ * Walk down to the entry mapping Va at Level, creating the missing
+ * tables on the way.
+ */
+EFI_STATUS boot_paging_entry(PAGE_TABLES *Tables, UINT64 Va, UINTN Level, UINT64 **Entry)
+{
+	UINT64 *Table = Tables->Root;
+
+	for(UINTN Current = Tables->Levels; Current > Level; Current--) {
+		UINT64 *Parent = &Table[PAGE_LEVEL_INDEX(Va, Current)];
+
+		if(!(*Parent & PTE_PRESENT)) {
+			UINT64 *Next = boot_paging_alloc(Tables);
+			if(!Next)
+				return EFI_OUT_OF_RESOURCES;
+
+			/* Leaves decide the permissions */
+			*Parent = (UINTN)Next | PTE_PRESENT | PTE_WRITE;
+		} else if(*Parent & PTE_LARGE) {
+			return EFI_ACCESS_DENIED;
+		}
+
+		Table = (UINT64*)(UINTN)(*Parent & PTE_ADDRESS);
+	}
+
+	*Entry = &Table[PAGE_LEVEL_INDEX(Va, Level)];
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS boot_paging_map(PAGE_TABLES *Tables, UINT64 Va, UINT64 Pa, UINT64 Size, UINTN ElfPermFlags)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 Bits = PTE_PRESENT;
+	UINT64 *Entry;
+
+	if(ElfPermFlags & PF_W)
+		Bits |= PTE_WRITE;
+	if(!(ElfPermFlags & PF_X))
+		Bits |= Tables->NxBit;
+
+	/* PAGE_LEVEL_INDEX ignores the upper bits, a range outside one canonical half would alias */
+	if(Size && (Va + Size - 1 < Va || ((Va ^ (Va + Size - 1)) >> 63) != 0 ||
+		    !boot_paging_canonical(Tables->Levels, Va) || !boot_paging_canonical(Tables->Levels, Va + Size - 1)))
+		return EFI_INVALID_PARAMETER;
+
+	while(Size) {
+		UINTN Level = 1;
+
+		/* Use the largest leaf that Va, Pa and the remaining size allow */
+		if(Tables->Gigabyte && ((Va | Pa) & (SIZE_1GB - 1)) == 0 && Size >= SIZE_1GB)
+			Level = 3;
+		else if(((Va | Pa) & (SIZE_2MB - 1)) == 0 && Size >= SIZE_2MB)
+			Level = 2;
+
+		Status = boot_paging_entry(Tables, Va, Level, &Entry);
+		if(EFI_ERROR(Status))
+			return Status;
+
+		if(*Entry & PTE_PRESENT) {
+			/* Neighbouring segments may share a page, it gets both permissions */
+			if(Level != 1 || (*Entry & PTE_ADDRESS) != Pa)
+				return EFI_ACCESS_DENIED;
+
+			*Entry = ((*Entry | Bits) & ~Tables->NxBit) | (*Entry & Bits & Tables->NxBit);
+		} else {
+			*Entry = Pa | Bits | (Level > 1 ? PTE_LARGE : 0);
+		}
+
+		Va += PAGE_LEVEL_SIZE(Level);
+		Pa += PAGE_LEVEL_SIZE(Level);
+		Size -= PAGE_LEVEL_SIZE(Level);
+	}
+
+	return Status;
+}
+
+EFI_STATUS boot_paging_map_image(PAGE_TABLES *Tables, ELF_IMAGE *Image)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	for(UINTN Index = 0; Index < Image->NumberOfSegments; Index++) {
+		ELF_SEGMENT_DESCRIPTOR *Segment = &Image->Segments[Index];
+
+		Status = boot_paging_map(Tables, Segment->Va, Segment->Pa, EFI_PAGES_TO_SIZE(Segment->NumberOfPages), Segment->ElfPermFlags);
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while mapping segment at %lx: %lx\n", Segment->Va, Status);
+			return Status;
+		}
+	}
+
+	return Status;
+}
+
+EFI_STATUS boot_paging_map_direct(PAGE_TABLES *Tables, BOOT_MEMORY_RANGE *Ranges, UINTN NumberOfRanges, UINT64 Offset)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	for(UINTN Index = 0; Index < NumberOfRanges; Index++) {
+		Status = boot_paging_map(Tables, Offset + Ranges[Index].Start, Ranges[Index].Start, Ranges[Index].End - Ranges[Index].Start, PF_R | PF_W);
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while direct mapping %lx-%lx: %lx\n", Ranges[Index].Start, Ranges[Index].End, Status);
+			return Status;
+		}
+	}
+
+	return Status;
+}
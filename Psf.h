@@ -0,0 +1,58 @@
+/*
+ * PC Screen Font definitions
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __PSF_H__
+#define __PSF_H__
+
+#define PSF2_MAGIC0 0x72
+#define PSF2_MAGIC1 0xB5
+#define PSF2_MAGIC2 0x4A
+#define PSF2_MAGIC3 0x86
+
+#define PSF2_HAS_UNICODE_TABLE 0x1
+
+#define PSF2_SEPARATOR 0xFF
+#define PSF2_STARTSEQ 0xFE
+
+typedef struct {
+	UINT8 	Magic[4];
+	UINT32 	Version;
+	UINT32 	HeaderSize;
+
+	/*
+	 *	0x1 PSF2_HAS_UNICODE_TABLE Unicode table follows the glyphs
+	 */
+	UINT32 	Flags;
+	UINT32 	Length;		/* Number of glyphs */
+	UINT32 	CharSize;	/* Bytes per glyph, Height * ((Width + 7) / 8) */
+	UINT32 	Height;
+	UINT32 	Width;
+} PSF2_HEADER;
+
+#endif /* __PSF_H__ */
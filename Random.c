@@ -0,0 +1,130 @@
+/*
+ * Boot entropy
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+#include <Protocol/Rng.h>
+
+#include "Boot.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define RANDOM_RDSEED
+#endif
+
+/*
+ * Entropy for KASLR, best source first: EFI_RNG_PROTOCOL, RDRAND,
+ * RDSEED and finally TSC jitter. The first source that answers is used.
+ */
+
+UINT64 boot_random_mix(UINT64 Value)
+{
+	/* splitmix64 finalizer */
+	Value ^= Value >> 30;
+	Value *= 0xBF58476D1CE4E5B9;
+	Value ^= Value >> 27;
+	Value *= 0x94D049BB133111EB;
+	Value ^= Value >> 31;
+
+	return Value;
+}
+
+BOOLEAN boot_random_rng(UINT64 *Value)
+{
+	EFI_RNG_PROTOCOL *Rng;
+
+	if(EFI_ERROR(gBS->LocateProtocol(&gEfiRngProtocolGuid, NULL, (VOID**)&Rng)))
+		return FALSE;
+
+	return !EFI_ERROR(Rng->GetRNG(Rng, NULL, sizeof(UINT64), (UINT8*)Value));
+}
+
+BOOLEAN boot_random_rdrand(UINT64 *Value)
+{
+	UINT32 Ecx;
+
+	AsmCpuid(1, NULL, NULL, &Ecx, NULL);
+	if(!(Ecx & BIT30))
+		return FALSE;
+
+	/* RDRAND can run dry for a moment, a few retries are recommended */
+	for(UINTN Retry = 0; Retry < 10; Retry++) {
+		if(AsmRdRand64(Value))
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+BOOLEAN boot_random_rdseed(UINT64 *Value)
+{
+#ifdef RANDOM_RDSEED
+	UINT32 Ebx;
+
+	AsmCpuidEx(7, 0, NULL, &Ebx, NULL, NULL);
+	if(!(Ebx & BIT18))
+		return FALSE;
+
+	for(UINTN Retry = 0; Retry < 100; Retry++) {
+		UINT8 Ok;
+
+		__asm__ __volatile__("rdseed %0; setc %1" : "=r"(*Value), "=qm"(Ok) : : "cc");
+		if(Ok)
+			return TRUE;
+	}
+#endif
+
+	return FALSE;
+}
+
+UINT64 boot_random_jitter()
+{
+	UINT64 Value = AsmReadTsc();
+
+	/* The low bits of short TSC intervals wander with cache and bus state */
+	for(UINTN Round = 0; Round < 64; Round++) {
+		UINT64 Start = AsmReadTsc();
+		Value = boot_random_mix(Value + Round);
+		Value ^= AsmReadTsc() - Start;
+	}
+
+	return boot_random_mix(Value);
+}
+
+UINT64 boot_random()
+{
+	UINT64 Value;
+
+	if(boot_random_rng(&Value) || boot_random_rdrand(&Value) || boot_random_rdseed(&Value))
+		return Value;
+
+	return boot_random_jitter();
+}
@@ -0,0 +1,209 @@
+/*
+ * ELF relocation
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Elf.h"
+#include "Boot.h"
+
+/*
+ * Relocations are applied to the loaded image through its physical
+ * allocation: link time VAddr + Delta is where the byte lives right now.
+ */
+typedef struct {
+	UINTN Delta;          /* Loaded address minus link time VAddr */
+	UINT64 Start;         /* Link time VAddr range of the image */
+	UINT64 End;
+	UINT64 Bias;          /* New minus link time virtual address */
+} ELF_RELOCATION;
+
+UINT64 *boot_reloc_target(ELF_RELOCATION *Reloc, UINT64 VAddr, UINTN Size)
+{
+	if(VAddr < Reloc->Start || VAddr > Reloc->End - Size)
+		return NULL;
+
+	return (UINT64*)(UINTN)(VAddr + Reloc->Delta);
+}
+
+EFI_STATUS boot_reloc_rela(ELF_RELOCATION *Reloc, ELF_RELA64 *Rela, UINTN Count)
+{
+	for(UINTN Index = 0; Index < Count; Index++) {
+		UINT64 *Target;
+
+		switch(ELF64_R_TYPE(Rela[Index].Info)) {
+		case R_X86_64_RELATIVE:
+			Target = boot_reloc_target(Reloc, Rela[Index].Offset, sizeof(UINT64));
+			if(!Target)
+				return EFI_LOAD_ERROR;
+
+			*Target = Reloc->Bias + Rela[Index].Addend;
+			break;
+		case R_X86_64_NONE:
+			break;
+		default:
+			/* A kernel has nothing to resolve symbols against */
+			Print(L"Unsupported relocation type %u at %lx\n", ELF64_R_TYPE(Rela[Index].Info), Rela[Index].Offset);
+			return EFI_UNSUPPORTED;
+		}
+	}
+
+	return EFI_SUCCESS;
+}
+
+/*
+ * RELR packs relative relocations: an even entry is the address of the
+ * next word to relocate, an odd entry is a bitmap of the 63 words that
+ * follow the last address.
+ */
+EFI_STATUS boot_reloc_relr(ELF_RELOCATION *Reloc, UINT64 *Relr, UINTN Count)
+{
+	UINT64 *Where = NULL;
+
+	for(UINTN Index = 0; Index < Count; Index++) {
+		UINT64 Entry = Relr[Index];
+
+		if((Entry & 1) == 0) {
+			Where = boot_reloc_target(Reloc, Entry, sizeof(UINT64));
+			if(!Where)
+				return EFI_LOAD_ERROR;
+
+			*Where++ += Reloc->Bias;
+			continue;
+		}
+
+		if(!Where)
+			return EFI_LOAD_ERROR;
+
+		/* Bit N relocates Where[N - 1], the highest one bounds the span */
+		if(Entry != 1 && !boot_reloc_target(Reloc, (UINTN)(Where + HighBitSet64(Entry) - 1) - Reloc->Delta, sizeof(UINT64)))
+			return EFI_LOAD_ERROR;
+
+		for(UINT64 *Word = Where; (Entry >>= 1) != 0; Word++) {
+			if(Entry & 1)
+				*Word += Reloc->Bias;
+		}
+
+		Where += 63;
+	}
+
+	return EFI_SUCCESS;
+}
+
+/*
+ * Move a loaded ET_DYN image up by Bias. Only R_X86_64_RELATIVE is
+ * supported, which is all a static PIE kernel carries. Everything is
+ * found through PT_DYNAMIC, section headers are not needed.
+ */
+EFI_STATUS boot_relocate_elf(CHAR16 *FileName, ELF_IMAGE *Image, UINT64 DynamicVAddr, UINTN DynamicSize, UINT64 Bias)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	ELF_RELOCATION Reloc;
+	ELF_DYN64 *Dynamic;
+	UINT64 Rela = 0, RelaSize = 0, RelaEnt = sizeof(ELF_RELA64);
+	UINT64 Relr = 0, RelrSize = 0, RelrEnt = sizeof(UINT64);
+#ifdef BOOT_BENCHMARK
+	UINT64 Start = boot_timer_ticks();
+#endif
+
+	Reloc.Delta = Image->Pa - Image->Va;
+	Reloc.Start = Image->Va;
+	Reloc.End = Image->Va + EFI_PAGES_TO_SIZE(Image->NumberOfPages);
+	Reloc.Bias = Bias;
+
+	/* No PT_DYNAMIC means nothing to fix up, the image just moves */
+	Dynamic = (ELF_DYN64*)boot_reloc_target(&Reloc, DynamicVAddr, DynamicSize);
+	if(DynamicSize != 0 && !Dynamic) {
+		Print(L"PT_DYNAMIC outside of the loaded image: %S\n", FileName);
+		return EFI_LOAD_ERROR;
+	}
+
+	for(UINTN Index = 0; Index < DynamicSize / sizeof(ELF_DYN64) && Dynamic[Index].Tag != DT_NULL; Index++) {
+		switch(Dynamic[Index].Tag) {
+		case DT_RELA:    Rela = Dynamic[Index].Val; break;
+		case DT_RELASZ:  RelaSize = Dynamic[Index].Val; break;
+		case DT_RELAENT: RelaEnt = Dynamic[Index].Val; break;
+		case DT_RELR:    Relr = Dynamic[Index].Val; break;
+		case DT_RELRSZ:  RelrSize = Dynamic[Index].Val; break;
+		case DT_RELRENT: RelrEnt = Dynamic[Index].Val; break;
+		case DT_REL:
+		case DT_RELSZ:
+			Print(L"DT_REL relocations are not used on x86-64: %S\n", FileName);
+			return EFI_UNSUPPORTED;
+		}
+	}
+
+	if(RelaEnt != sizeof(ELF_RELA64) || RelrEnt != sizeof(UINT64)) {
+		Print(L"Unsupported relocation entry size: %S\n", FileName);
+		return EFI_UNSUPPORTED;
+	}
+
+	if(RelaSize) {
+		ELF_RELA64 *RelaTable = (ELF_RELA64*)boot_reloc_target(&Reloc, Rela, RelaSize);
+		if(!RelaTable) {
+			Print(L"DT_RELA outside of the loaded image: %S\n", FileName);
+			return EFI_LOAD_ERROR;
+		}
+
+		Status = boot_reloc_rela(&Reloc, RelaTable, RelaSize / sizeof(ELF_RELA64));
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while applying DT_RELA relocations: %S, %lx\n", FileName, Status);
+			return Status;
+		}
+	}
+
+	if(RelrSize) {
+		UINT64 *RelrTable = boot_reloc_target(&Reloc, Relr, RelrSize);
+		if(!RelrTable) {
+			Print(L"DT_RELR outside of the loaded image: %S\n", FileName);
+			return EFI_LOAD_ERROR;
+		}
+
+		Status = boot_reloc_relr(&Reloc, RelrTable, RelrSize / sizeof(UINT64));
+		if(EFI_ERROR(Status)) {
+			Print(L"Error while applying DT_RELR relocations: %S, %lx\n", FileName, Status);
+			return Status;
+		}
+	}
+
+	/* From here on the image lives at its new virtual address */
+	for(UINTN Index = 0; Index < Image->NumberOfSegments; Index++)
+		Image->Segments[Index].Va += Reloc.Bias;
+	Image->Va += Reloc.Bias;
+	Image->Entry += Reloc.Bias;
+
+#ifdef BOOT_BENCHMARK
+	Print(L"Relocated %S: %lu RELA, %lu RELR entries in %lu us\n", FileName, RelaSize / sizeof(ELF_RELA64), RelrSize / sizeof(UINT64), boot_timer_us(boot_timer_ticks() - Start));
+#endif
+
+	return Status;
+}
@@ -0,0 +1,229 @@
+/*
+ * SHA-256
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+#if defined (_M_X64) || defined (_M_AMD64) || defined(__x86_64__)
+#include <immintrin.h>
+#define SHA256_SHANI
+#endif
+
+#ifdef __GNUC__
+#define SHA256_SHANI_TARGET __attribute__((target("sha,sse4.1")))
+#else
+#define SHA256_SHANI_TARGET
+#endif
+
+#define ROR32(Value, Count) (((Value) >> (Count)) | ((Value) << (32 - (Count))))
+
+UINT32 Sha256K[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+VOID boot_sha256_blocks_generic(UINT32 *State, CONST UINT8 *Data, UINTN Blocks)
+{
+	for(; Blocks; Blocks--, Data += 64) {
+		UINT32 W[64];
+		UINT32 A = State[0], B = State[1], C = State[2], D = State[3];
+		UINT32 E = State[4], F = State[5], G = State[6], H = State[7];
+
+		for(UINTN Index = 0; Index < 16; Index++)
+			W[Index] = ((UINT32)Data[4 * Index] << 24) | (Data[4 * Index + 1] << 16) | (Data[4 * Index + 2] << 8) | Data[4 * Index + 3];
+
+		for(UINTN Index = 16; Index < 64; Index++) {
+			UINT32 S0 = ROR32(W[Index - 15], 7) ^ ROR32(W[Index - 15], 18) ^ (W[Index - 15] >> 3);
+			UINT32 S1 = ROR32(W[Index - 2], 17) ^ ROR32(W[Index - 2], 19) ^ (W[Index - 2] >> 10);
+
+			W[Index] = W[Index - 16] + S0 + W[Index - 7] + S1;
+		}
+
+		for(UINTN Index = 0; Index < 64; Index++) {
+			UINT32 T1 = H + (ROR32(E, 6) ^ ROR32(E, 11) ^ ROR32(E, 25)) + ((E & F) ^ (~E & G)) + Sha256K[Index] + W[Index];
+			UINT32 T2 = (ROR32(A, 2) ^ ROR32(A, 13) ^ ROR32(A, 22)) + ((A & B) ^ (A & C) ^ (B & C));
+
+			H = G;
+			G = F;
+			F = E;
+			E = D + T1;
+			D = C;
+			C = B;
+			B = A;
+			A = T1 + T2;
+		}
+
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+}
+
+#ifdef SHA256_SHANI
+/*
+ * The SHA extensions keep the state as ABEF and CDGH and run two rounds
+ * per SHA256RNDS2, the message schedule is four words per group.
+ */
+SHA256_SHANI_TARGET
+VOID boot_sha256_blocks_shani(UINT32 *State, CONST UINT8 *Data, UINTN Blocks)
+{
+	__m128i Mask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+	__m128i State0, State1, Saved0, Saved1, Message, Temp;
+	__m128i Group[4];
+
+	Temp = _mm_shuffle_epi32(_mm_loadu_si128((__m128i*)&State[0]), 0xB1);
+	State1 = _mm_shuffle_epi32(_mm_loadu_si128((__m128i*)&State[4]), 0x1B);
+	State0 = _mm_alignr_epi8(Temp, State1, 8);
+	State1 = _mm_blend_epi16(State1, Temp, 0xF0);
+
+	for(; Blocks; Blocks--, Data += 64) {
+		Saved0 = State0;
+		Saved1 = State1;
+
+		for(UINTN Index = 0; Index < 16; Index++) {
+			if(Index < 4) {
+				Group[Index] = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(Data + 16 * Index)), Mask);
+			} else {
+				/* W[t-16] + s0(W[t-15]) + W[t-7] + s1(W[t-2]) */
+				Temp = _mm_sha256msg1_epu32(Group[Index & 3], Group[(Index + 1) & 3]);
+				Temp = _mm_add_epi32(Temp, _mm_alignr_epi8(Group[(Index + 3) & 3], Group[(Index + 2) & 3], 4));
+				Group[Index & 3] = _mm_sha256msg2_epu32(Temp, Group[(Index + 3) & 3]);
+			}
+
+			Message = _mm_add_epi32(Group[Index & 3], _mm_loadu_si128((__m128i*)&Sha256K[4 * Index]));
+			State1 = _mm_sha256rnds2_epu32(State1, State0, Message);
+			State0 = _mm_sha256rnds2_epu32(State0, State1, _mm_shuffle_epi32(Message, 0x0E));
+		}
+
+		State0 = _mm_add_epi32(State0, Saved0);
+		State1 = _mm_add_epi32(State1, Saved1);
+	}
+
+	Temp = _mm_shuffle_epi32(State0, 0x1B);
+	State1 = _mm_shuffle_epi32(State1, 0xB1);
+	_mm_storeu_si128((__m128i*)&State[0], _mm_blend_epi16(Temp, State1, 0xF0));
+	_mm_storeu_si128((__m128i*)&State[4], _mm_alignr_epi8(State1, Temp, 8));
+}
+
+BOOLEAN boot_sha256_shani_supported()
+{
+	UINT32 Ebx, Ecx;
+
+	AsmCpuid(1, NULL, NULL, &Ecx, NULL);
+	if(!(Ecx & BIT19))
+		return FALSE;
+
+	AsmCpuidEx(7, 0, NULL, &Ebx, NULL, NULL);
+	return (Ebx & BIT29) != 0;
+}
+#endif
+
+VOID boot_sha256_init(SHA256_CONTEXT *Context)
+{
+	Context->State[0] = 0x6A09E667;
+	Context->State[1] = 0xBB67AE85;
+	Context->State[2] = 0x3C6EF372;
+	Context->State[3] = 0xA54FF53A;
+	Context->State[4] = 0x510E527F;
+	Context->State[5] = 0x9B05688C;
+	Context->State[6] = 0x1F83D9AB;
+	Context->State[7] = 0x5BE0CD19;
+	Context->Length = 0;
+	Context->Fill = 0;
+
+	Context->Blocks = boot_sha256_blocks_generic;
+#ifdef SHA256_SHANI
+	if(boot_sha256_shani_supported())
+		Context->Blocks = boot_sha256_blocks_shani;
+#endif
+}
+
+/* Whole blocks are hashed where they lie, only the ends are buffered */
+VOID boot_sha256_update(SHA256_CONTEXT *Context, CONST VOID *Data, UINTN Size)
+{
+	CONST UINT8 *Bytes = Data;
+
+	Context->Length += Size;
+
+	if(Context->Fill) {
+		UINTN Length = MIN(64 - Context->Fill, Size);
+
+		CopyMem(Context->Buffer + Context->Fill, Bytes, Length);
+		Context->Fill += Length;
+		Bytes += Length;
+		Size -= Length;
+
+		if(Context->Fill < 64)
+			return;
+
+		Context->Blocks(Context->State, Context->Buffer, 1);
+		Context->Fill = 0;
+	}
+
+	if(Size >= 64) {
+		Context->Blocks(Context->State, Bytes, Size / 64);
+		Bytes += Size & ~(UINTN)63;
+		Size &= 63;
+	}
+
+	CopyMem(Context->Buffer, Bytes, Size);
+	Context->Fill = Size;
+}
+
+VOID boot_sha256_final(SHA256_CONTEXT *Context, UINT8 *Digest)
+{
+	UINT64 Bits = Context->Length * 8;
+	UINT8 Padding[72] = { 0x80 };
+	UINTN PaddingSize = (Context->Fill < 56 ? 56 : 120) - Context->Fill;
+
+	for(UINTN Index = 0; Index < 8; Index++)
+		Padding[PaddingSize + Index] = (UINT8)(Bits >> (56 - 8 * Index));
+
+	boot_sha256_update(Context, Padding, PaddingSize + 8);
+
+	for(UINTN Index = 0; Index < 32; Index++)
+		Digest[Index] = (UINT8)(Context->State[Index / 4] >> (24 - 8 * (Index & 3)));
+}
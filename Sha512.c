@@ -0,0 +1,168 @@
+/*
+ * SHA-512
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+#define ROR64(Value, Count) (((Value) >> (Count)) | ((Value) << (64 - (Count))))
+
+UINT64 Sha512K[80] = {
+	0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL, 0xE9B5DBA58189DBBCULL,
+	0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL, 0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL,
+	0xD807AA98A3030242ULL, 0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+	0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL, 0xC19BF174CF692694ULL,
+	0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL, 0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL,
+	0x2DE92C6F592B0275ULL, 0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+	0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL, 0xBF597FC7BEEF0EE4ULL,
+	0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL, 0x06CA6351E003826FULL, 0x142929670A0E6E70ULL,
+	0x27B70A8546D22FFCULL, 0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+	0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL, 0x92722C851482353BULL,
+	0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL, 0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL,
+	0xD192E819D6EF5218ULL, 0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+	0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL, 0x34B0BCB5E19B48A8ULL,
+	0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL, 0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL,
+	0x748F82EE5DEFB2FCULL, 0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+	0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL, 0xC67178F2E372532BULL,
+	0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL, 0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL,
+	0x06F067AA72176FBAULL, 0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+	0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL, 0x431D67C49C100D4CULL,
+	0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL, 0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL,
+};
+
+VOID boot_sha512_blocks(UINT64 *State, CONST UINT8 *Data, UINTN Blocks)
+{
+	for(; Blocks; Blocks--, Data += 128) {
+		UINT64 W[80];
+		UINT64 A = State[0], B = State[1], C = State[2], D = State[3];
+		UINT64 E = State[4], F = State[5], G = State[6], H = State[7];
+
+		for(UINTN Index = 0; Index < 16; Index++) {
+			W[Index] = 0;
+			for(UINTN Byte = 0; Byte < 8; Byte++)
+				W[Index] = (W[Index] << 8) | Data[8 * Index + Byte];
+		}
+
+		for(UINTN Index = 16; Index < 80; Index++) {
+			UINT64 S0 = ROR64(W[Index - 15], 1) ^ ROR64(W[Index - 15], 8) ^ (W[Index - 15] >> 7);
+			UINT64 S1 = ROR64(W[Index - 2], 19) ^ ROR64(W[Index - 2], 61) ^ (W[Index - 2] >> 6);
+
+			W[Index] = W[Index - 16] + S0 + W[Index - 7] + S1;
+		}
+
+		for(UINTN Index = 0; Index < 80; Index++) {
+			UINT64 T1 = H + (ROR64(E, 14) ^ ROR64(E, 18) ^ ROR64(E, 41)) + ((E & F) ^ (~E & G)) + Sha512K[Index] + W[Index];
+			UINT64 T2 = (ROR64(A, 28) ^ ROR64(A, 34) ^ ROR64(A, 39)) + ((A & B) ^ (A & C) ^ (B & C));
+
+			H = G;
+			G = F;
+			F = E;
+			E = D + T1;
+			D = C;
+			C = B;
+			B = A;
+			A = T1 + T2;
+		}
+
+		State[0] += A;
+		State[1] += B;
+		State[2] += C;
+		State[3] += D;
+		State[4] += E;
+		State[5] += F;
+		State[6] += G;
+		State[7] += H;
+	}
+}
+
+VOID boot_sha512_init(SHA512_CONTEXT *Context)
+{
+	Context->State[0] = 0x6A09E667F3BCC908ULL;
+	Context->State[1] = 0xBB67AE8584CAA73BULL;
+	Context->State[2] = 0x3C6EF372FE94F82BULL;
+	Context->State[3] = 0xA54FF53A5F1D36F1ULL;
+	Context->State[4] = 0x510E527FADE682D1ULL;
+	Context->State[5] = 0x9B05688C2B3E6C1FULL;
+	Context->State[6] = 0x1F83D9ABFB41BD6BULL;
+	Context->State[7] = 0x5BE0CD19137E2179ULL;
+	Context->Length = 0;
+	Context->Fill = 0;
+}
+
+VOID boot_sha512_update(SHA512_CONTEXT *Context, CONST VOID *Data, UINTN Size)
+{
+	CONST UINT8 *Bytes = Data;
+
+	Context->Length += Size;
+
+	if(Context->Fill) {
+		UINTN Length = MIN(128 - Context->Fill, Size);
+
+		CopyMem(Context->Buffer + Context->Fill, Bytes, Length);
+		Context->Fill += Length;
+		Bytes += Length;
+		Size -= Length;
+
+		if(Context->Fill < 128)
+			return;
+
+		boot_sha512_blocks(Context->State, Context->Buffer, 1);
+		Context->Fill = 0;
+	}
+
+	if(Size >= 128) {
+		boot_sha512_blocks(Context->State, Bytes, Size / 128);
+		Bytes += Size & ~(UINTN)127;
+		Size &= 127;
+	}
+
+	CopyMem(Context->Buffer, Bytes, Size);
+	Context->Fill = Size;
+}
+
+/* The length field is 128 bits, messages here never need the upper half */
+VOID boot_sha512_final(SHA512_CONTEXT *Context, UINT8 *Digest)
+{
+	UINT64 Bits = Context->Length * 8;
+	UINT8 Padding[144] = { 0x80 };
+	UINTN PaddingSize = (Context->Fill < 112 ? 112 : 240) - Context->Fill;
+
+	for(UINTN Index = 0; Index < 8; Index++)
+		Padding[PaddingSize + 8 + Index] = (UINT8)(Bits >> (56 - 8 * Index));
+
+	boot_sha512_update(Context, Padding, PaddingSize + 16);
+
+	for(UINTN Index = 0; Index < 64; Index++)
+		Digest[Index] = (UINT8)(Context->State[Index / 8] >> (56 - 8 * (Index & 7)));
+}
@@ -0,0 +1,1471 @@
+/*
+ * Streaming file reads with LZ4 and Zstandard decompression
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/PrintLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Lz4.h"
+#include "Zstd.h"
+#include "Boot.h"
+
+/* Reads are hashed in pieces of this size while they are still in cache */
+#define STREAM_CHUNK SIZE_1MB
+
+/* BLAKE3 pieces are split over the processors, up to this many of them */
+#define STREAM_BLAKE3_SPLIT 16
+
+/* Largest hole between reads that chunk checks alone fill in to stay in line */
+#define STREAM_HASH_GAP SIZE_2MB
+
+/* Start of a hashed file kept in memory, for reads that go back to its headers */
+#define STREAM_HEAD SIZE_64KB
+
+/* Sidecar of chunk CRC32C values, "CRCT" */
+#define STREAM_CRC_MAGIC 0x54435243
+
+typedef struct {
+	UINT32 Magic;
+	UINT32 ChunkSize;     /* Power of two, at least 4 KB */
+	UINT64 FileSize;
+	/* UINT32 CRC32C of each chunk follows */
+} STREAM_CRC_HEADER;
+
+EFI_STATUS boot_stream_file_read_partial(BOOT_STREAM *Stream, UINTN *Size, VOID *Buffer);
+EFI_STATUS boot_stream_hash(BOOT_STREAM *Stream, UINT64 Position, UINT8 *Buffer, UINTN Size);
+
+EFI_STATUS boot_stream_seek(BOOT_STREAM *Stream, UINT64 Position)
+{
+	EFI_STATUS Status = Stream->File->SetPosition(Stream->File, Position);
+
+	if(!EFI_ERROR(Status))
+		Stream->FilePosition = Position;
+
+	return Status;
+}
+
+/* The disk failed a read, leave the rest of the file to the file system driver */
+EFI_STATUS boot_stream_drop_disk(BOOT_STREAM *Stream)
+{
+	boot_fat_close(&Stream->Disk);
+	Stream->Async = Stream->Async && Stream->File->Revision >= EFI_FILE_PROTOCOL_REVISION2;
+
+	return Stream->File->SetPosition(Stream->File, Stream->FilePosition);
+}
+
+/* Read at FilePosition, from the extents on disk while there are any */
+EFI_STATUS boot_stream_file_io(BOOT_STREAM *Stream, UINTN *Size, VOID *Buffer)
+{
+	if(Stream->Disk.Extents) {
+		UINTN Length = *Size;
+
+		if(!EFI_ERROR(boot_fat_read(&Stream->Disk, Stream->FilePosition, &Length, Buffer))) {
+			*Size = Length;
+			return EFI_SUCCESS;
+		}
+
+		if(EFI_ERROR(boot_stream_drop_disk(Stream)))
+			return EFI_DEVICE_ERROR;
+	}
+
+	return Stream->File->Read(Stream->File, Size, Buffer);
+}
+
+/* Start an asynchronous read at FilePosition */
+EFI_STATUS boot_stream_file_io_ex(BOOT_STREAM *Stream, EFI_FILE_IO_TOKEN *Token)
+{
+	if(Stream->Disk.Extents)
+		return boot_fat_read_ex(&Stream->Disk, Stream->FilePosition, Token);
+
+	return Stream->File->ReadEx(Stream->File, Token);
+}
+
+/*
+ * Hash [HashPosition, End) of the file, or up to its end. Nothing reads
+ * these bytes for use, so they are read into scratch space, except for
+ * the tail, which is hashed from the copy it was used from. The file
+ * position is left where it was.
+ */
+EFI_STATUS boot_stream_hash_range(BOOT_STREAM *Stream, UINT64 End)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 FilePosition = Stream->FilePosition;
+	UINT8 *Scratch;
+
+	Status = gBS->AllocatePool(EfiLoaderData, Stream->HashChunk, (VOID**)&Scratch);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = boot_stream_seek(Stream, Stream->HashPosition);
+
+	while(!EFI_ERROR(Status) && Stream->HashPosition < End) {
+		UINTN Length = MIN(End - Stream->HashPosition, Stream->HashChunk);
+
+		if(Stream->Tail && Stream->HashPosition >= Stream->TailPosition) {
+			if(Stream->HashPosition >= Stream->TailPosition + Stream->TailSize)
+				break;
+
+			Length = MIN(Length, Stream->TailPosition + Stream->TailSize - Stream->HashPosition);
+			Status = boot_stream_hash(Stream, Stream->HashPosition, Stream->Tail + (Stream->HashPosition - Stream->TailPosition), Length);
+			continue;
+		}
+
+		if(Stream->Tail)
+			Length = MIN(Length, Stream->TailPosition - Stream->HashPosition);
+
+		Status = boot_stream_file_read_partial(Stream, &Length, Scratch);
+		if(Length == 0)
+			break;
+	}
+
+	gBS->FreePool(Scratch);
+
+	if(EFI_ERROR(Status))
+		return Status;
+
+	return boot_stream_seek(Stream, FilePosition);
+}
+
+/* Wait for every piece read ahead, the file is then free to be moved in */
+VOID boot_stream_drain(BOOT_STREAM *Stream)
+{
+	UINTN Index;
+
+	for(UINTN Slot = 0; Slot < BOOT_STREAM_DEPTH; Slot++) {
+		BOOT_STREAM_READ *Read = &Stream->Reads[Slot];
+
+		if(Read->Busy && !Read->Done) {
+			gBS->WaitForEvent(1, &Read->Token.Event, &Index);
+			Read->Done = TRUE;
+		}
+	}
+}
+
+/*
+ * Chunk ChunkStart of the file failed its CRC32C. Read it once more, the
+ * medium may have hiccuped, and put the good copy in Chunk if it is
+ * still in the caller's hands there.
+ */
+EFI_STATUS boot_stream_crc_retry(BOOT_STREAM *Stream, UINT64 ChunkStart, UINTN Size, UINT32 Crc, UINT8 *Chunk)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 FilePosition = Stream->FilePosition;
+	UINT8 *Scratch;
+
+	if(!Chunk || Stream->Pending)
+		return EFI_CRC_ERROR;
+
+	boot_stream_drain(Stream);
+
+	Status = gBS->AllocatePool(EfiLoaderData, Size, (VOID**)&Scratch);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = boot_stream_seek(Stream, ChunkStart);
+	if(!EFI_ERROR(Status))
+		Status = boot_stream_file_io(Stream, &Size, Scratch);
+	if(!EFI_ERROR(Status))
+		Status = boot_crc32c(0, Scratch, Size) == Crc ? EFI_SUCCESS : EFI_CRC_ERROR;
+	if(!EFI_ERROR(Status))
+		gBS->CopyMem(Chunk, Scratch, Size);
+
+	gBS->FreePool(Scratch);
+
+	if(EFI_ERROR(boot_stream_seek(Stream, FilePosition)))
+		return EFI_DEVICE_ERROR;
+
+	return Status;
+}
+
+/*
+ * Check Size bytes at HashPosition against the chunk CRC32C values. The
+ * first bad chunk stops the load right away unless reading it again
+ * gives the expected bytes.
+ */
+EFI_STATUS boot_stream_crc(BOOT_STREAM *Stream, UINT8 *Buffer, UINTN Size)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 Position = Stream->HashPosition;
+	UINT64 Start = boot_timer_ticks();
+	UINTN Done = 0;
+
+	while(Done < Size) {
+		UINT64 Chunk = (Position + Done) / Stream->CrcChunk;
+		UINT64 ChunkStart = Chunk * Stream->CrcChunk;
+		UINT64 ChunkEnd = MIN(ChunkStart + Stream->CrcChunk, Stream->CrcFileSize);
+		UINTN Length;
+
+		if(Chunk >= Stream->NumberOfCrcs) {
+			Print(L"File is larger than its CRC32C table\n");
+			return EFI_CRC_ERROR;
+		}
+
+		Length = MIN(ChunkEnd - (Position + Done), Size - Done);
+		Stream->Crc = boot_crc32c(Stream->Crc, Buffer + Done, Length);
+		Done += Length;
+		if(Position + Done < ChunkEnd)
+			break;
+
+		if(Stream->Crc != Stream->Crcs[Chunk]) {
+			/* Only a chunk read whole by this call can be patched */
+			Status = boot_stream_crc_retry(Stream, ChunkStart, ChunkEnd - ChunkStart, Stream->Crcs[Chunk],
+						       ChunkStart >= Position ? Buffer + (ChunkStart - Position) : NULL);
+			Print(L"CRC32C mismatch in bytes %lx-%lx, %s\n", ChunkStart, ChunkEnd - 1,
+			      EFI_ERROR(Status) ? L"refusing to load" : L"read it again");
+			if(EFI_ERROR(Status))
+				return EFI_CRC_ERROR;
+		}
+
+		Stream->Crc = 0;
+	}
+
+	Stream->CrcTicks += boot_timer_ticks() - Start;
+
+	return Status;
+}
+
+/*
+ * Line the checks up with a read of Size bytes at Position. While
+ * hashing, the hole between what has been hashed and a read ahead of it
+ * is pulled in first. Chunk checks alone only do that for a hole of up
+ * to STREAM_HASH_GAP, after a read further out of line they go back to
+ * the start of the chunk the read is in instead.
+ */
+EFI_STATUS boot_stream_hash_align(BOOT_STREAM *Stream, UINT64 Position, UINTN Size)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	/* Chunk checks alone start over at the chunk of a read out of line */
+	if(!Stream->Hashing && (Position + Size <= Stream->HashPosition ||
+				(Position > Stream->HashPosition && Position - Stream->HashPosition > STREAM_HASH_GAP))) {
+		Stream->HashPosition = Position & ~((UINT64)Stream->CrcChunk - 1);
+		Stream->Crc = 0;
+	}
+
+	if(Position > Stream->HashPosition && !Stream->Pending && !Stream->InFlight &&
+	   (Stream->Hashing || Position - Stream->HashPosition <= MAX(STREAM_HASH_GAP, Stream->CrcChunk))) {
+		Status = boot_stream_hash_range(Stream, Position);
+		if(Status == EFI_CRC_ERROR || (Stream->Hashing && EFI_ERROR(Status)))
+			return Status;
+	}
+
+	return EFI_SUCCESS;
+}
+
+/*
+ * Feed bytes read at Position to the checks in file order. While hashing
+ * they are the bytes that get used, so they have to be next in line, and
+ * the ones the tail was read ahead for have to match it.
+ */
+EFI_STATUS boot_stream_hash(BOOT_STREAM *Stream, UINT64 Position, UINT8 *Buffer, UINTN Size)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 Start;
+
+	if(!Stream->Hashing && !Stream->Crcs)
+		return EFI_SUCCESS;
+
+	Status = boot_stream_hash_align(Stream, Position, Size);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	if(Stream->Hashing && Size != 0 && Position != Stream->HashPosition) {
+		Print(L"Bytes %lx-%lx read out of order with the hash, refusing to load\n", Position, Position + Size - 1);
+		return EFI_SECURITY_VIOLATION;
+	}
+
+	if(Position + Size <= Stream->HashPosition || Position > Stream->HashPosition)
+		return EFI_SUCCESS;
+
+	Buffer += Stream->HashPosition - Position;
+	Size = Position + Size - Stream->HashPosition;
+	Position = Stream->HashPosition;
+
+	if(Stream->Crcs) {
+		Status = boot_stream_crc(Stream, Buffer, Size);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+
+	if(!Stream->Hashing) {
+		Stream->HashPosition = Position + Size;
+		return EFI_SUCCESS;
+	}
+
+	if(Stream->Tail && Position + Size > Stream->TailPosition && Position < Stream->TailPosition + Stream->TailSize) {
+		UINT64 From = MAX(Position, Stream->TailPosition);
+		UINT64 To = MIN(Position + Size, Stream->TailPosition + Stream->TailSize);
+
+		if(CompareMem(Buffer + (From - Position), Stream->Tail + (From - Stream->TailPosition), To - From) != 0) {
+			Print(L"Bytes %lx-%lx changed since they were first read, refusing to load\n", From, To - 1);
+			return EFI_SECURITY_VIOLATION;
+		}
+	}
+
+	if(Position < STREAM_HEAD)
+		gBS->CopyMem(Stream->Head + Position, Buffer, MIN(Size, STREAM_HEAD - Position));
+
+	Start = boot_timer_ticks();
+	if(Stream->Hashing == BOOT_HASH_BLAKE3)
+		boot_blake3_update(&Stream->Blake3, Buffer, Size);
+	else
+		boot_sha256_update(&Stream->Sha256, Buffer, Size);
+	Stream->HashTicks += boot_timer_ticks() - Start;
+	Stream->HashPosition = Position + Size;
+
+	return EFI_SUCCESS;
+}
+
+/*
+ * While hashing, bytes before HashPosition were hashed from the buffer
+ * they were first read into, and reading them again could give something
+ * else. The start of a read that goes back is copied from the head kept
+ * in memory instead, and the file position moved past it. A read that
+ * goes back further than the head is refused.
+ */
+EFI_STATUS boot_stream_replay(BOOT_STREAM *Stream, UINTN Size, UINT8 *Buffer, UINTN *Replayed)
+{
+	UINT64 Position = Stream->FilePosition;
+	UINTN Length;
+
+	*Replayed = 0;
+	if(!Stream->Hashing || Position >= Stream->HashPosition || Size == 0)
+		return EFI_SUCCESS;
+
+	Length = (UINTN)MIN(Size, Stream->HashPosition - Position);
+	if(Position + Length > STREAM_HEAD) {
+		Print(L"Bytes %lx-%lx read again after they were hashed, refusing to load\n", Position, Position + Length - 1);
+		return EFI_SECURITY_VIOLATION;
+	}
+
+	gBS->CopyMem(Buffer, Stream->Head + Position, Length);
+	*Replayed = Length;
+
+	return boot_stream_seek(Stream, Position + Length);
+}
+
+EFI_STATUS boot_stream_file_read_partial(BOOT_STREAM *Stream, UINTN *Size, VOID *Buffer)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 Position;
+	UINT64 Start;
+	UINTN Replayed;
+	UINTN Length;
+
+	Status = boot_stream_replay(Stream, *Size, Buffer, &Replayed);
+	if(EFI_ERROR(Status) || Replayed == *Size)
+		return Status;
+
+	Position = Stream->FilePosition;
+	Length = *Size - Replayed;
+	Start = boot_timer_ticks();
+	Status = boot_stream_file_io(Stream, &Length, (UINT8*)Buffer + Replayed);
+	Stream->ReadTicks += boot_timer_ticks() - Start;
+	if(EFI_ERROR(Status))
+		return Status;
+
+	*Size = Replayed + Length;
+	Stream->ReadBytes += Length;
+	Stream->FilePosition += Length;
+
+	return boot_stream_hash(Stream, Position, (UINT8*)Buffer + Replayed, Length);
+}
+
+/* Read Size bytes at Position past the checks, for what is needed before the hash gets there */
+EFI_STATUS boot_stream_file_read_at(BOOT_STREAM *Stream, UINT64 Position, UINTN Size, VOID *Buffer)
+{
+	EFI_STATUS Status = boot_stream_seek(Stream, Position);
+	UINTN Length = Size;
+
+	if(!EFI_ERROR(Status))
+		Status = boot_stream_file_io(Stream, &Length, Buffer);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Stream->ReadBytes += Length;
+	Stream->FilePosition += Length;
+
+	return Length == Size ? EFI_SUCCESS : EFI_VOLUME_CORRUPTED;
+}
+
+EFI_STATUS boot_stream_file_read(BOOT_STREAM *Stream, UINTN Size, VOID *Buffer)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN ReadSize = Size;
+
+	Status = boot_stream_file_read_partial(Stream, &ReadSize, Buffer);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	return ReadSize == Size ? EFI_SUCCESS : EFI_VOLUME_CORRUPTED;
+}
+
+/*
+ * Piece of at most Chunk bytes of a read of Remaining bytes at Position.
+ * The pieces end on file offsets that are multiples of Chunk, so only the
+ * first one starts part way into a disk block. With chunk checks they end
+ * on chunk boundaries, so a bad chunk can be read again in place.
+ */
+UINTN boot_stream_piece(BOOT_STREAM *Stream, UINT64 Position, UINTN Remaining, UINTN Chunk)
+{
+	UINTN Length = MIN(Remaining, Chunk - (UINTN)(Position % Chunk));
+
+	if(Stream->Crcs && Length < Remaining && (Position + Length) % Stream->CrcChunk < Length)
+		Length -= (Position + Length) % Stream->CrcChunk;
+
+	return Length;
+}
+
+/* Token events for the pieces read ahead, made on first use */
+BOOLEAN boot_stream_reads_ready(BOOT_STREAM *Stream)
+{
+	if(!Stream->Async || Stream->ReadsReady)
+		return Stream->Async;
+
+	for(UINTN Slot = 0; Slot < BOOT_STREAM_DEPTH; Slot++) {
+		if(EFI_ERROR(gBS->CreateEvent(0, TPL_CALLBACK, NULL, NULL, &Stream->Reads[Slot].Token.Event))) {
+			Stream->Async = FALSE;
+			return FALSE;
+		}
+	}
+
+	Stream->ReadsReady = TRUE;
+
+	return TRUE;
+}
+
+typedef VOID (*STREAM_PROGRESS)(VOID *Context, UINTN Done);
+
+/*
+ * Read Size bytes at the file position into Buffer, up to
+ * BOOT_STREAM_DEPTH pieces of boot_tune_chunk() bytes at a time through
+ * ReadEx. The pieces that are in are checked and hashed in runs of about
+ * HashChunk while the ones after them are still being read, then
+ * Progress is told how many bytes from the start of Buffer are ready.
+ * Without ReadEx, or once the firmware refuses one, pieces of HashChunk
+ * are read one after another. Size is updated to what was read.
+ */
+EFI_STATUS boot_stream_file_read_ahead(BOOT_STREAM *Stream, UINTN *Size, UINT8 *Buffer, STREAM_PROGRESS Progress, VOID *Context)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT64 Position = Stream->FilePosition;
+	UINTN Issued;
+	UINTN Done;
+	UINTN Checked;
+	UINTN Head = 0;
+	UINT64 RunStart;
+	UINTN RunChunk = 0;
+	BOOLEAN End = FALSE;
+	BOOLEAN DiskError = FALSE;
+	UINTN Index;
+
+	/* Bytes that were hashed already come from the head, not the medium */
+	Status = boot_stream_replay(Stream, *Size, Buffer, &Done);
+	if(EFI_ERROR(Status))
+		return Status;
+	if(Done && Progress)
+		Progress(Context, Done);
+	Issued = Checked = Done;
+
+	/* The hole before the read is filled while nothing is in flight yet */
+	if((Stream->Hashing || Stream->Crcs) && Done < *Size) {
+		Status = boot_stream_hash_align(Stream, Position + Done, *Size - Done);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+
+	RunStart = boot_timer_ticks();
+	while(!End && Done < *Size && (Stream->InFlight || boot_stream_reads_ready(Stream))) {
+		BOOT_STREAM_READ *Read;
+		UINT64 Start;
+		UINTN Length;
+
+		while(Stream->Async && Issued < *Size && Stream->InFlight < BOOT_STREAM_DEPTH) {
+			Read = &Stream->Reads[(Head + Stream->InFlight) % BOOT_STREAM_DEPTH];
+			Read->Position = Position + Issued;
+			Read->Chunk = boot_tune_chunk();
+			Read->Size = boot_stream_piece(Stream, Read->Position, *Size - Issued, Read->Chunk);
+			Read->Done = FALSE;
+			Read->Token.Status = EFI_SUCCESS;
+			Read->Token.BufferSize = Read->Size;
+			Read->Token.Buffer = Buffer + Issued;
+
+			if(EFI_ERROR(boot_stream_file_io_ex(Stream, &Read->Token))) {
+				Stream->Async = FALSE;
+				break;
+			}
+
+			Read->Busy = TRUE;
+			Stream->InFlight++;
+			Stream->FilePosition += Read->Size;
+			Issued += Read->Size;
+		}
+
+		if(!Stream->InFlight)
+			break;
+
+		Read = &Stream->Reads[Head];
+		Start = boot_timer_ticks();
+		if(!Read->Done)
+			gBS->WaitForEvent(1, &Read->Token.Event, &Index);
+		Stream->ReadTicks += boot_timer_ticks() - Start;
+		Read->Done = TRUE;
+		Read->Busy = FALSE;
+		Stream->InFlight--;
+		Head = (Head + 1) % BOOT_STREAM_DEPTH;
+
+		Length = Read->Token.BufferSize;
+		Status = Read->Token.Status;
+		DiskError = EFI_ERROR(Status) && Stream->Disk.Extents;
+		if(!EFI_ERROR(Status)) {
+			Stream->ReadBytes += Length;
+			RunChunk = Checked == Done || RunChunk == Read->Chunk ? Read->Chunk : 0;
+			Done += Length;
+		}
+
+		/* Runs end where a piece of HashChunk would, so a bad chunk is still in the buffer */
+		if(!EFI_ERROR(Status) && Checked < Done && (Length < Read->Size || Done == *Size || (Done - Checked >= Stream->HashChunk &&
+				(!Stream->Crcs || (Position + Done) % Stream->CrcChunk == 0)))) {
+			Status = boot_stream_hash(Stream, Position + Checked, Buffer + Checked, Done - Checked);
+			if(EFI_ERROR(Status)) {
+				Done = Checked;
+			} else {
+				/* A run is timed with its checks, from the end of the one before */
+				Start = boot_timer_ticks();
+				boot_tune_run(RunChunk, Done - Checked, Start - RunStart);
+				RunStart = Start;
+				Checked = Done;
+				if(Progress)
+					Progress(Context, Checked);
+			}
+		}
+
+		/* After an error or the end of the file the rest only drains */
+		if(EFI_ERROR(Status) || Length < Read->Size) {
+			End = TRUE;
+			while(Stream->InFlight) {
+				Read = &Stream->Reads[Head];
+				if(!Read->Done)
+					gBS->WaitForEvent(1, &Read->Token.Event, &Index);
+				Read->Busy = FALSE;
+				Stream->InFlight--;
+				Head = (Head + 1) % BOOT_STREAM_DEPTH;
+			}
+		}
+
+		if(EFI_ERROR(Status))
+			break;
+	}
+
+	if(End && Stream->FilePosition != Position + Done && EFI_ERROR(boot_stream_seek(Stream, Position + Done)) && !EFI_ERROR(Status))
+		Status = EFI_DEVICE_ERROR;
+
+	/* What the disk failed to read, the file system driver gets to try */
+	if(DiskError && !EFI_ERROR(boot_stream_drop_disk(Stream))) {
+		Status = EFI_SUCCESS;
+		End = FALSE;
+	}
+
+	/* Pieces that were in before ReadEx stopped working */
+	if(!EFI_ERROR(Status) && Checked < Done) {
+		Status = boot_stream_hash(Stream, Position + Checked, Buffer + Checked, Done - Checked);
+		if(!EFI_ERROR(Status) && Progress)
+			Progress(Context, Done);
+	}
+	if(EFI_ERROR(Status))
+		Done = MIN(Done, Checked);
+
+	while(!End && !EFI_ERROR(Status) && Done < *Size) {
+		UINTN Length = boot_stream_piece(Stream, Position + Done, *Size - Done, Stream->HashChunk);
+
+		Status = boot_stream_file_read_partial(Stream, &Length, Buffer + Done);
+		if(Length == 0)
+			break;
+		Done += Length;
+		if(!EFI_ERROR(Status) && Progress)
+			Progress(Context, Done);
+	}
+
+	*Size = Done;
+
+	return Status;
+}
+
+/* Bytes to read for a block: data, checksum and the next block header */
+UINTN boot_stream_block_input(BOOT_STREAM *Stream, UINT32 BlockSize)
+{
+	return (BlockSize & ~LZ4_BLOCK_UNCOMPRESSED) + (Stream->BlockChecksum ? 4 : 0) + 4;
+}
+
+/*
+ * Start reading the next block into the idle input buffer while the
+ * current one is decoded. Firmware without ReadEx, or one that refuses
+ * the request, gets a plain Read once the block is needed.
+ */
+VOID boot_stream_prefetch(BOOT_STREAM *Stream)
+{
+	/* A block that was hashed already has to come from the head */
+	if(!Stream->Async || Stream->NextBlockSize == 0 || (Stream->Hashing && Stream->FilePosition < Stream->HashPosition))
+		return;
+
+	Stream->Token.Status = EFI_SUCCESS;
+	Stream->Token.BufferSize = boot_stream_block_input(Stream, Stream->NextBlockSize);
+	Stream->Token.Buffer = Stream->Input[Stream->InputIndex];
+
+	if(EFI_ERROR(boot_stream_file_io_ex(Stream, &Stream->Token))) {
+		Stream->Async = FALSE;
+		return;
+	}
+
+	Stream->Pending = TRUE;
+	Stream->PendingPosition = Stream->FilePosition;
+	Stream->FilePosition += Stream->Token.BufferSize;
+}
+
+EFI_STATUS boot_stream_wait(BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status;
+	UINTN Index;
+	UINT64 Start;
+
+	if(!Stream->Pending)
+		return EFI_SUCCESS;
+
+	Start = boot_timer_ticks();
+	gBS->WaitForEvent(1, &Stream->Token.Event, &Index);
+	Stream->ReadTicks += boot_timer_ticks() - Start;
+	Stream->ReadBytes += Stream->Token.BufferSize;
+	Stream->Pending = FALSE;
+
+	/* What the disk failed to read, the file system driver gets to try */
+	if(EFI_ERROR(Stream->Token.Status) && Stream->Disk.Extents) {
+		Status = boot_stream_drop_disk(Stream);
+		if(!EFI_ERROR(Status))
+			Status = boot_stream_seek(Stream, Stream->PendingPosition);
+		if(!EFI_ERROR(Status))
+			Status = boot_stream_file_read_partial(Stream, &Stream->Token.BufferSize, Stream->Token.Buffer);
+		return Status;
+	}
+
+	if(EFI_ERROR(Stream->Token.Status))
+		return Stream->Token.Status;
+
+	return boot_stream_hash(Stream, Stream->PendingPosition, Stream->Token.Buffer, Stream->Token.BufferSize);
+}
+
+/* Go back to the first block, the frame can only be decoded forwards */
+EFI_STATUS boot_stream_rewind(BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status = boot_stream_wait(Stream);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Stream->NextBlockSize = Stream->FirstBlockSize;
+	Stream->History = 0;
+	Stream->Block = NULL;
+	Stream->BlockStart = 0;
+	Stream->BlockEnd = 0;
+
+	return boot_stream_seek(Stream, Stream->FrameStart);
+}
+
+/*
+ * Decode the next block to Target, which holds at least BlockMax bytes,
+ * and make it the current block.
+ */
+EFI_STATUS boot_stream_next_block(BOOT_STREAM *Stream, UINT8 *Target)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT32 BlockSize = Stream->NextBlockSize;
+	UINTN DataSize = BlockSize & ~LZ4_BLOCK_UNCOMPRESSED;
+	UINTN InputSize = boot_stream_block_input(Stream, BlockSize);
+	UINT8 *Input = Stream->Input[Stream->InputIndex];
+	UINTN Length;
+	UINT64 Start;
+
+	if(DataSize > Stream->BlockMax)
+		return EFI_VOLUME_CORRUPTED;
+
+	if(Stream->Pending)
+		Status = boot_stream_wait(Stream);
+	else
+		Status = boot_stream_file_read(Stream, InputSize, Input);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Stream->NextBlockSize = boot_lz4_le32(Input + InputSize - 4);
+	Stream->InputIndex ^= 1;
+	boot_stream_prefetch(Stream);
+
+	Start = boot_timer_ticks();
+	if(BlockSize & LZ4_BLOCK_UNCOMPRESSED) {
+		gBS->CopyMem(Target, Input, DataSize);
+		Length = DataSize;
+	} else {
+		Status = boot_lz4_decompress_prefix(Input, DataSize, Target, Stream->BlockMax, Stream->Linked ? Stream->History : 0, &Length);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+	Stream->DecodeTicks += boot_timer_ticks() - Start;
+	Stream->DecodeBytes += Length;
+
+	Stream->BlockStart = Stream->BlockEnd;
+	Stream->BlockEnd += Length;
+	Stream->Block = Target;
+
+	/* Keep the last 64 KB of output right before where the next block goes */
+	if(Stream->Linked) {
+		UINTN Keep = MIN(LZ4_HISTORY, Stream->History + Length);
+
+		gBS->CopyMem(Stream->Window + LZ4_HISTORY - Keep, Target + Length - Keep, Keep);
+		Stream->History = Keep;
+	}
+
+	return Status;
+}
+
+EFI_STATUS boot_stream_open_frame(BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT8 Header[11];
+	UINTN HeaderSize = 2;
+	UINT8 Flg;
+
+	/* FLG and BD, then the optional content size and the header checksum */
+	Status = boot_stream_file_read(Stream, HeaderSize, Header);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Flg = Header[0];
+	if(LZ4_FLG_VERSION(Flg) != 1 || (Flg & LZ4_FLG_DICTIONARY))
+		return EFI_UNSUPPORTED;
+
+	if(Flg & LZ4_FLG_CONTENT_SIZE)
+		HeaderSize += 8;
+	HeaderSize++;
+
+	Status = boot_stream_file_read(Stream, HeaderSize - 2, Header + 2);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	switch((Header[1] >> 4) & 0x7) {
+	case 4: Stream->BlockMax = SIZE_64KB; break;
+	case 5: Stream->BlockMax = SIZE_256KB; break;
+	case 6: Stream->BlockMax = SIZE_1MB; break;
+	case 7: Stream->BlockMax = SIZE_4MB; break;
+	default: return EFI_UNSUPPORTED;
+	}
+
+	Stream->Linked = !(Flg & LZ4_FLG_INDEPENDENT);
+	Stream->BlockChecksum = (Flg & LZ4_FLG_BLOCK_CHECKSUM) != 0;
+
+	/* Without a content size the frame has to be decoded to know it */
+	if(Flg & LZ4_FLG_CONTENT_SIZE)
+		Stream->Size = boot_lz4_le32(Header + 2) | (UINT64)boot_lz4_le32(Header + 6) << 32;
+	else
+		Stream->Size = MAX_UINT64;
+
+	Status = boot_stream_file_read(Stream, 4, Header);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Stream->FirstBlockSize = boot_lz4_le32(Header);
+	Stream->NextBlockSize = Stream->FirstBlockSize;
+	Stream->FrameStart = 4 + HeaderSize + 4;
+
+	Status = gBS->AllocatePool(EfiLoaderData, 2 * (Stream->BlockMax + 8) + LZ4_HISTORY + Stream->BlockMax, (VOID**)&Stream->Input[0]);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Stream->Input[1] = Stream->Input[0] + Stream->BlockMax + 8;
+	Stream->Window = Stream->Input[1] + Stream->BlockMax + 8;
+
+	/* Overlap reads with decoding where the firmware can read asynchronously */
+	if(Stream->Async && EFI_ERROR(gBS->CreateEvent(0, TPL_CALLBACK, NULL, NULL, &Stream->Token.Event)))
+		Stream->Async = FALSE;
+
+	return Status;
+}
+
+/*
+ * A multi-frame image ends in a seek table, whose footer is the last
+ * thing in the file. EFI_NOT_FOUND means the file is a single frame.
+ * What is read of the end of the file is kept as the tail, the hash
+ * takes it from there once it gets that far.
+ */
+EFI_STATUS boot_stream_open_frames(BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	SEEK_TABLE_FOOTER Footer;
+	UINT64 FileSize;
+	UINT64 TableStart;
+	UINTN EntrySize;
+	UINTN TableSize;
+	UINT8 *Table;
+	UINT64 Offset = 0;
+	UINT64 Start = 0;
+	UINT32 FrameMax = 0;
+
+	if(EFI_ERROR(Stream->File->SetPosition(Stream->File, MAX_UINT64)) ||
+	   EFI_ERROR(Stream->File->GetPosition(Stream->File, &FileSize)) ||
+	   FileSize < 8 + sizeof(SEEK_TABLE_FOOTER) ||
+	   EFI_ERROR(boot_stream_file_read_at(Stream, FileSize - sizeof(SEEK_TABLE_FOOTER), sizeof(SEEK_TABLE_FOOTER), &Footer)))
+		return EFI_NOT_FOUND;
+
+	Status = gBS->AllocatePool(EfiLoaderData, sizeof(SEEK_TABLE_FOOTER), (VOID**)&Stream->Tail);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	gBS->CopyMem(Stream->Tail, &Footer, sizeof(SEEK_TABLE_FOOTER));
+	Stream->TailPosition = FileSize - sizeof(SEEK_TABLE_FOOTER);
+	Stream->TailSize = sizeof(SEEK_TABLE_FOOTER);
+
+	if(Footer.Magic != SEEK_TABLE_MAGIC)
+		return EFI_NOT_FOUND;
+
+	EntrySize = sizeof(SEEK_TABLE_ENTRY) + ((Footer.Descriptor & SEEK_TABLE_CHECKSUM) ? 4 : 0);
+	TableSize = Footer.NumberOfFrames * EntrySize;
+	if(Footer.NumberOfFrames == 0 || TableSize > FileSize - 8 - sizeof(SEEK_TABLE_FOOTER))
+		return EFI_VOLUME_CORRUPTED;
+
+	TableStart = FileSize - sizeof(SEEK_TABLE_FOOTER) - TableSize - 8;
+
+	/* The table and its footer become the tail */
+	Status = gBS->AllocatePool(EfiLoaderData, 8 + TableSize + sizeof(SEEK_TABLE_FOOTER), (VOID**)&Table);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Status = boot_stream_file_read_at(Stream, TableStart, 8 + TableSize, Table);
+	if(!EFI_ERROR(Status) &&
+	   (boot_lz4_le32(Table) != SEEK_TABLE_SKIPPABLE_MAGIC || boot_lz4_le32(Table + 4) != TableSize + sizeof(SEEK_TABLE_FOOTER)))
+		Status = EFI_VOLUME_CORRUPTED;
+	if(!EFI_ERROR(Status))
+		Status = gBS->AllocatePool(EfiLoaderData, Footer.NumberOfFrames * sizeof(BOOT_STREAM_FRAME), (VOID**)&Stream->Frames);
+	if(EFI_ERROR(Status)) {
+		gBS->FreePool(Table);
+		return Status;
+	}
+
+	gBS->CopyMem(Table + 8 + TableSize, &Footer, sizeof(SEEK_TABLE_FOOTER));
+	gBS->FreePool(Stream->Tail);
+	Stream->Tail = Table;
+	Stream->TailPosition = TableStart;
+	Stream->TailSize = 8 + TableSize + sizeof(SEEK_TABLE_FOOTER);
+
+	for(UINTN Index = 0; Index < Footer.NumberOfFrames; Index++) {
+		SEEK_TABLE_ENTRY *Entry = (SEEK_TABLE_ENTRY*)(Table + 8 + Index * EntrySize);
+		BOOT_STREAM_FRAME *Frame = &Stream->Frames[Index];
+
+		Frame->Offset = Offset;
+		Frame->Start = Start;
+		Frame->CompressedSize = Entry->CompressedSize;
+		Frame->Size = Entry->DecompressedSize;
+
+		Offset += Frame->CompressedSize;
+		Start += Frame->Size;
+		FrameMax = MAX(FrameMax, Frame->Size);
+	}
+
+	Stream->NumberOfFrames = Footer.NumberOfFrames;
+	Stream->Size = Start;
+	Stream->CachedFrame = MAX_UINTN;
+
+	/* The frames have to fill the file up to the seek table */
+	if(Offset != TableStart)
+		return EFI_VOLUME_CORRUPTED;
+
+	return gBS->AllocatePool(EfiLoaderData, MAX(FrameMax, 1), (VOID**)&Stream->FrameCache);
+}
+
+/*
+ * A Zstandard file without a seek table is a single frame. It is read
+ * as a table of one frame, so the frame has to give its content size.
+ */
+EFI_STATUS boot_stream_open_zstd_frame(BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT32 Magic = ZSTD_FRAME_MAGIC;
+	UINT8 Header[18];
+	UINTN ReadSize = sizeof(Header) - sizeof(Magic);
+	UINTN HeaderSize;
+	UINT64 ContentSize;
+	UINT64 FileSize;
+
+	if(EFI_ERROR(Stream->File->SetPosition(Stream->File, MAX_UINT64)) ||
+	   EFI_ERROR(Stream->File->GetPosition(Stream->File, &FileSize)))
+		return EFI_VOLUME_CORRUPTED;
+
+	/* The magic was read already, the header is at most 14 bytes more */
+	Status = boot_stream_seek(Stream, sizeof(Magic));
+	if(!EFI_ERROR(Status))
+		Status = boot_stream_file_read_partial(Stream, &ReadSize, Header + sizeof(Magic));
+	if(EFI_ERROR(Status))
+		return Status;
+
+	gBS->CopyMem(Header, &Magic, sizeof(Magic));
+	Status = boot_zstd_frame_header(Header, sizeof(Magic) + ReadSize, &HeaderSize, &ContentSize);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	if(ContentSize > MAX_UINT32 || FileSize > MAX_UINT32)
+		return EFI_UNSUPPORTED;
+
+	Status = gBS->AllocatePool(EfiLoaderData, sizeof(BOOT_STREAM_FRAME), (VOID**)&Stream->Frames);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Stream->Frames[0].Offset = 0;
+	Stream->Frames[0].Start = 0;
+	Stream->Frames[0].CompressedSize = (UINT32)FileSize;
+	Stream->Frames[0].Size = (UINT32)ContentSize;
+	Stream->NumberOfFrames = 1;
+	Stream->Size = ContentSize;
+	Stream->CachedFrame = MAX_UINTN;
+
+	return gBS->AllocatePool(EfiLoaderData, MAX((UINTN)ContentSize, 1), (VOID**)&Stream->FrameCache);
+}
+
+/*
+ * Load <FileName>.crc if there is one. Chunks of the file as stored are
+ * then checked against it as they are read.
+ */
+EFI_STATUS boot_stream_open_crc(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	CHAR16 CrcFileName[256];
+	STREAM_CRC_HEADER Header;
+	EFI_FILE *CrcFile;
+	UINTN ReadSize = sizeof(Header);
+	UINTN TableSize;
+
+	UnicodeSPrint(CrcFileName, sizeof(CrcFileName), L"%s.crc", FileName);
+	if(EFI_ERROR(Volume->Open(Volume, &CrcFile, CrcFileName, EFI_FILE_MODE_READ, 0)))
+		return EFI_SUCCESS;
+
+	Status = CrcFile->Read(CrcFile, &ReadSize, &Header);
+	if(!EFI_ERROR(Status) && (ReadSize != sizeof(Header) || Header.Magic != STREAM_CRC_MAGIC ||
+				  Header.ChunkSize < SIZE_4KB || (Header.ChunkSize & (Header.ChunkSize - 1))))
+		Status = EFI_VOLUME_CORRUPTED;
+
+	if(!EFI_ERROR(Status)) {
+		Stream->NumberOfCrcs = (UINTN)DivU64x32(Header.FileSize + Header.ChunkSize - 1, Header.ChunkSize);
+		TableSize = ReadSize = Stream->NumberOfCrcs * sizeof(UINT32);
+		Status = gBS->AllocatePool(EfiLoaderData, MAX(TableSize, 1), (VOID**)&Stream->Crcs);
+	}
+	if(!EFI_ERROR(Status)) {
+		Status = CrcFile->Read(CrcFile, &ReadSize, Stream->Crcs);
+		if(!EFI_ERROR(Status) && ReadSize != TableSize)
+			Status = EFI_VOLUME_CORRUPTED;
+	}
+
+	CrcFile->Close(CrcFile);
+
+	if(EFI_ERROR(Status)) {
+		Print(L"Error while reading CRC32C table: %S, %lx\n", CrcFileName, Status);
+		if(Stream->Crcs)
+			gBS->FreePool(Stream->Crcs);
+		Stream->Crcs = NULL;
+		return Status;
+	}
+
+	Stream->CrcChunk = Header.ChunkSize;
+	Stream->CrcFileSize = Header.FileSize;
+
+	return Status;
+}
+
+/*
+ * Find where FileName is on the boot volume, so reads can go to the disk
+ * past the file system driver. The driver has to agree on the size of
+ * the file, otherwise it is read through the driver as usual.
+ */
+VOID boot_stream_open_disk(CHAR16 *FileName, BOOT_STREAM *Stream)
+{
+	UINT64 FileSize;
+
+	if(!BootConfig.DiskIo || EFI_ERROR(boot_fat_open(FileName, &Stream->Disk)))
+		return;
+
+	if(EFI_ERROR(Stream->File->SetPosition(Stream->File, MAX_UINT64)) ||
+	   EFI_ERROR(Stream->File->GetPosition(Stream->File, &FileSize)) ||
+	   EFI_ERROR(Stream->File->SetPosition(Stream->File, 0)) ||
+	   FileSize != Stream->Disk.Size)
+		boot_fat_close(&Stream->Disk);
+}
+
+/*
+ * Open FileName for boot_stream_read. With Hash other than BOOT_HASH_NONE,
+ * a digest of the file as stored is taken along the way for
+ * boot_stream_digest.
+ */
+EFI_STATUS boot_stream_open(CHAR16 *FileName, EFI_FILE_PROTOCOL *Volume, UINTN Hash, BOOT_STREAM *Stream)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINT8 Magic[4];
+
+	gBS->SetMem(Stream, sizeof(BOOT_STREAM), 0);
+
+	Stream->Hashing = Hash;
+	Stream->HashChunk = STREAM_CHUNK;
+	if(Hash == BOOT_HASH_SHA256)
+		boot_sha256_init(&Stream->Sha256);
+
+	/* BLAKE3 hashes a piece on every processor, give each one a chunk */
+	if(Hash == BOOT_HASH_BLAKE3) {
+		boot_blake3_init(&Stream->Blake3);
+		Stream->HashChunk = STREAM_CHUNK * MIN(boot_mp_processors(), STREAM_BLAKE3_SPLIT);
+	}
+
+	Status = Volume->Open(Volume, &Stream->File, FileName, EFI_FILE_MODE_READ, 0);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	boot_stream_open_disk(FileName, Stream);
+	Stream->Async = Stream->Disk.Extents ? boot_fat_async() : Stream->File->Revision >= EFI_FILE_PROTOCOL_REVISION2;
+
+	if(Hash != BOOT_HASH_NONE)
+		Status = gBS->AllocatePool(EfiLoaderData, STREAM_HEAD, (VOID**)&Stream->Head);
+	if(!EFI_ERROR(Status))
+		Status = boot_stream_open_crc(FileName, Volume, Stream);
+	if(EFI_ERROR(Status)) {
+		if(Stream->Head)
+			gBS->FreePool(Stream->Head);
+		Stream->File->Close(Stream->File);
+		return Status;
+	}
+
+	/* Anything that does not start with a frame magic is read as is */
+	if(EFI_ERROR(boot_stream_file_read(Stream, sizeof(Magic), Magic)) ||
+	   (boot_lz4_le32(Magic) != LZ4_FRAME_MAGIC && boot_lz4_le32(Magic) != ZSTD_FRAME_MAGIC))
+		return EFI_SUCCESS;
+
+	Stream->Compressed = TRUE;
+	Stream->Zstd = boot_lz4_le32(Magic) == ZSTD_FRAME_MAGIC;
+
+	Status = boot_stream_open_frames(Stream);
+	if(Status == EFI_NOT_FOUND && Stream->Zstd) {
+		Status = boot_stream_open_zstd_frame(Stream);
+	} else if(Status == EFI_NOT_FOUND) {
+		Status = boot_stream_seek(Stream, sizeof(Magic));
+		if(!EFI_ERROR(Status))
+			Status = boot_stream_open_frame(Stream);
+	}
+
+	/* Every processor decoding Zstandard frames needs a workspace of its own */
+	if(!EFI_ERROR(Status) && Stream->Zstd)
+		Status = gBS->AllocatePool(EfiLoaderData, (Stream->NumberOfFrames > 1 ? boot_mp_processors() : 1) * sizeof(ZSTD_WORKSPACE),
+					   (VOID**)&Stream->Workspace);
+
+	if(EFI_ERROR(Status)) {
+		Print(L"Unsupported compressed file: %S, %lx\n", FileName, Status);
+		boot_stream_close(FileName, Stream);
+	}
+
+	return Status;
+}
+
+/* Bound the compressed data held in memory for one round of frames */
+#define STREAM_BATCH SIZE_64MB
+
+typedef struct {
+	BOOT_STREAM_FRAME *Frames;
+	UINT32 Count;
+	UINT8 *Input;           /* Compressed frames as read, Frames[0] first */
+	UINT8 *Output;          /* Where Frames[0] decompresses to */
+	BOOLEAN Zstd;
+	UINT8 *Workspace;       /* ZSTD_WORKSPACE for each processor */
+	volatile UINT32 Workers;/* Processors that took a workspace */
+	volatile UINT32 Next;   /* Next frame to claim */
+	volatile UINT32 Read;   /* Frames whose input is in memory */
+	volatile EFI_STATUS Status;
+} STREAM_WORK;
+
+/* Let the processors at the frames that are wholly in memory now */
+VOID boot_stream_work_read(VOID *Context, UINTN Done)
+{
+	STREAM_WORK *Work = Context;
+	UINT32 Read = Work->Read;
+
+	while(Read < Work->Count && Work->Frames[Read].Offset + Work->Frames[Read].CompressedSize - Work->Frames[0].Offset <= Done)
+		Read++;
+
+	MemoryFence();
+	Work->Read = Read;
+}
+
+/*
+ * Runs on the APs and on the BSP once it is done reading. Each processor
+ * claims the next frame, waits until it has been read and decompresses
+ * it straight to its place in the output.
+ */
+VOID EFIAPI boot_stream_worker(VOID *Argument)
+{
+	STREAM_WORK *Work = Argument;
+	UINT8 *Workspace = NULL;
+
+	if(Work->Zstd)
+		Workspace = Work->Workspace + (InterlockedIncrement(&Work->Workers) - 1) * sizeof(ZSTD_WORKSPACE);
+
+	for(;;) {
+		UINT32 Index = InterlockedIncrement(&Work->Next) - 1;
+		BOOT_STREAM_FRAME *Frame;
+		EFI_STATUS Status;
+		UINT8 *Input;
+		UINT8 *Output;
+		UINTN Length;
+
+		if(Index >= Work->Count)
+			return;
+
+		Frame = &Work->Frames[Index];
+
+		while(Work->Read <= Index)
+			CpuPause();
+
+		/* Reading failed, keep the BSP's error and only drain the frames */
+		if(EFI_ERROR(Work->Status))
+			continue;
+
+		Input = Work->Input + (Frame->Offset - Work->Frames[0].Offset);
+		Output = Work->Output + (Frame->Start - Work->Frames[0].Start);
+		if(Work->Zstd)
+			Status = boot_zstd_frame_decompress(Input, Frame->CompressedSize, Output, Frame->Size, Workspace, &Length);
+		else
+			Status = boot_lz4_frame_decompress(Input, Frame->CompressedSize, Output, Frame->Size, &Length);
+
+		if(EFI_ERROR(Status) || Length != Frame->Size)
+			Work->Status = EFI_VOLUME_CORRUPTED;
+	}
+}
+
+EFI_STATUS boot_stream_decode_frames(BOOT_STREAM *Stream, UINTN First, UINTN Count, UINT8 *Output)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Alignment = boot_fat_alignment();
+
+	while(Count) {
+		STREAM_WORK Work;
+		EFI_EVENT Done;
+		UINT64 InputSize = 0;
+		UINT64 OutputSize = 0;
+		UINTN Batch = 0;
+		UINTN Length;
+		EFI_PHYSICAL_ADDRESS Base;
+		UINTN Pages;
+		UINT64 Start = boot_timer_ticks();
+		UINT64 ReadTicks = Stream->ReadTicks;
+
+		while(Batch < Count && (Batch == 0 || InputSize + Stream->Frames[First + Batch].CompressedSize <= STREAM_BATCH)) {
+			InputSize += Stream->Frames[First + Batch].CompressedSize;
+			OutputSize += Stream->Frames[First + Batch].Size;
+			Batch++;
+		}
+
+		Work.Frames = &Stream->Frames[First];
+		Work.Count = Batch;
+		Work.Output = Output;
+		Work.Zstd = Stream->Zstd;
+		Work.Workspace = Stream->Workspace;
+		Work.Workers = 0;
+		Work.Next = 0;
+		Work.Read = 0;
+		Work.Status = EFI_SUCCESS;
+
+		/* Start the input as far into a page as the first frame is into a disk block */
+		Pages = EFI_SIZE_TO_PAGES(InputSize + Alignment);
+		Status = gBS->AllocatePages(AllocateAnyPages, EfiLoaderData, Pages, &Base);
+		if(EFI_ERROR(Status))
+			return Status;
+		Work.Input = (UINT8*)(UINTN)Base + Work.Frames[0].Offset % Alignment;
+
+		Status = boot_stream_seek(Stream, Work.Frames[0].Offset);
+		if(EFI_ERROR(Status)) {
+			gBS->FreePages(Base, Pages);
+			return Status;
+		}
+
+		if(Batch > 1)
+			boot_mp_start(boot_stream_worker, &Work, &Done);
+		else
+			Done = NULL;
+
+		/* The APs start on each frame as soon as it is in memory */
+		Length = InputSize;
+		Status = boot_stream_file_read_ahead(Stream, &Length, Work.Input, boot_stream_work_read, &Work);
+		if(!EFI_ERROR(Status) && Length != InputSize)
+			Status = EFI_VOLUME_CORRUPTED;
+
+		/* Let waiting processors run through, the output is dropped */
+		if(EFI_ERROR(Status))
+			Work.Status = Status;
+
+		MemoryFence();
+		Work.Read = Batch;
+
+		boot_stream_worker(&Work);
+		boot_mp_wait(Done);
+
+		Stream->DecodeTicks += (boot_timer_ticks() - Start) - (Stream->ReadTicks - ReadTicks);
+		Stream->DecodeBytes += OutputSize;
+
+		gBS->FreePages(Base, Pages);
+
+		if(EFI_ERROR(Work.Status))
+			return Work.Status;
+
+		First += Batch;
+		Count -= Batch;
+		Output += OutputSize;
+	}
+
+	return Status;
+}
+
+EFI_STATUS boot_stream_read_frames(BOOT_STREAM *Stream, UINT64 Offset, UINTN *Size, UINT8 *Buffer)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Done = 0;
+
+	while(Done < *Size && Offset + Done < Stream->Size) {
+		UINT64 Position = Offset + Done;
+		UINTN Low = 0;
+		UINTN High = Stream->NumberOfFrames;
+		BOOT_STREAM_FRAME *Frame;
+		UINT64 Length;
+
+		while(High - Low > 1) {
+			UINTN Middle = (Low + High) / 2;
+
+			if(Stream->Frames[Middle].Start <= Position)
+				Low = Middle;
+			else
+				High = Middle;
+		}
+
+		Frame = &Stream->Frames[Low];
+
+		/* Whole frames go straight to the caller, on every processor, unless one is decoded already */
+		if(Position == Frame->Start && *Size - Done >= Frame->Size && Stream->CachedFrame != Low) {
+			UINTN Count = 0;
+
+			Length = 0;
+			while(Low + Count < Stream->NumberOfFrames && Length + Stream->Frames[Low + Count].Size <= *Size - Done)
+				Length += Stream->Frames[Low + Count++].Size;
+
+			Status = boot_stream_decode_frames(Stream, Low, Count, Buffer + Done);
+			if(EFI_ERROR(Status))
+				return Status;
+
+			Done += Length;
+			continue;
+		}
+
+		if(Stream->CachedFrame != Low) {
+			Stream->CachedFrame = MAX_UINTN;
+
+			Status = boot_stream_decode_frames(Stream, Low, 1, Stream->FrameCache);
+			if(EFI_ERROR(Status))
+				return Status;
+
+			Stream->CachedFrame = Low;
+		}
+
+		Length = MIN(Frame->Start + Frame->Size - Position, *Size - Done);
+		gBS->CopyMem(Buffer + Done, Stream->FrameCache + (Position - Frame->Start), Length);
+		Done += Length;
+	}
+
+	*Size = Done;
+
+	return Status;
+}
+
+/*
+ * Read Size bytes at Offset of the file contents, Size is updated to
+ * what was available. Decompressed reads that cover a whole block are
+ * decoded straight into Buffer.
+ */
+EFI_STATUS boot_stream_read(BOOT_STREAM *Stream, UINT64 Offset, UINTN *Size, VOID *Buffer)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	UINTN Done = 0;
+
+	if(!Stream->Compressed) {
+		Status = boot_stream_seek(Stream, Offset);
+		if(EFI_ERROR(Status))
+			return Status;
+
+		/* While checking, each piece is taken care of as the next ones arrive */
+		if(Stream->Hashing || Stream->Crcs)
+			return boot_stream_file_read_ahead(Stream, Size, Buffer, NULL, NULL);
+
+		return boot_stream_file_read_partial(Stream, Size, Buffer);
+	}
+
+	if(Stream->Frames)
+		return boot_stream_read_frames(Stream, Offset, Size, Buffer);
+
+	while(Done < *Size) {
+		UINT64 Position = Offset + Done;
+		UINT8 *Output = (UINT8*)Buffer + Done;
+
+		if(Stream->Block && Position >= Stream->BlockStart && Position < Stream->BlockEnd) {
+			UINTN Length = MIN(Stream->BlockEnd - Position, *Size - Done);
+
+			gBS->CopyMem(Output, Stream->Block + (Position - Stream->BlockStart), Length);
+			Done += Length;
+			continue;
+		}
+
+		if(Position < Stream->BlockEnd) {
+			Status = boot_stream_rewind(Stream);
+			if(EFI_ERROR(Status))
+				return Status;
+			continue;
+		}
+
+		if(Stream->NextBlockSize == 0)
+			break;
+
+		if(!Stream->Linked && Position == Stream->BlockEnd && *Size - Done >= Stream->BlockMax) {
+			Status = boot_stream_next_block(Stream, Output);
+			if(EFI_ERROR(Status))
+				return Status;
+
+			/* Only the caller has this block now */
+			Stream->Block = NULL;
+			Done += Stream->BlockEnd - Stream->BlockStart;
+			continue;
+		}
+
+		Status = boot_stream_next_block(Stream, Stream->Window + LZ4_HISTORY);
+		if(EFI_ERROR(Status))
+			return Status;
+	}
+
+	*Size = Done;
+
+	return Status;
+}
+
+/* Bytes boot_stream_read has to give out, known before any are read */
+EFI_STATUS boot_stream_size(BOOT_STREAM *Stream, UINT64 *Size)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+
+	if(Stream->Compressed) {
+		*Size = Stream->Size;
+		return Stream->Size == MAX_UINT64 ? EFI_UNSUPPORTED : EFI_SUCCESS;
+	}
+
+	Status = boot_stream_wait(Stream);
+	if(!EFI_ERROR(Status))
+		Status = Stream->File->SetPosition(Stream->File, MAX_UINT64);
+	if(!EFI_ERROR(Status))
+		Status = Stream->File->GetPosition(Stream->File, Size);
+	if(!EFI_ERROR(Status))
+		Status = boot_stream_seek(Stream, Stream->FilePosition);
+
+	return Status;
+}
+
+/* Partition offset the file starts at, MAX_UINT64 when it is read through the driver */
+UINT64 boot_stream_disk_offset(BOOT_STREAM *Stream)
+{
+	return Stream->Disk.Extents ? Stream->Disk.Extents[0].Disk : MAX_UINT64;
+}
+
+/* Hash whatever of the file the reads did not cover and finish the digest */
+EFI_STATUS boot_stream_digest(BOOT_STREAM *Stream, UINT8 *Digest)
+{
+	EFI_STATUS Status = boot_stream_wait(Stream);
+
+	if(!EFI_ERROR(Status))
+		Status = boot_stream_hash_range(Stream, MAX_UINT64);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	if(Stream->Hashing == BOOT_HASH_BLAKE3)
+		boot_blake3_final(&Stream->Blake3, Digest);
+	else
+		boot_sha256_final(&Stream->Sha256, Digest);
+
+	return Status;
+}
+
+VOID boot_stream_close(CHAR16 *FileName, BOOT_STREAM *Stream)
+{
+	boot_stream_wait(Stream);
+
+#ifdef BOOT_BENCHMARK
+	UINT64 ReadUs = boot_timer_us(Stream->ReadTicks);
+	UINT64 DecodeUs = boot_timer_us(Stream->DecodeTicks);
+
+	Print(L"%S: read %lu KB, %lu us waiting (%lu MB/s)\n", FileName, Stream->ReadBytes / SIZE_1KB, ReadUs, ReadUs ? Stream->ReadBytes / ReadUs : 0);
+	if(Stream->Compressed)
+		Print(L"%S: %s %lu KB in %lu us (%lu MB/s) on %lu processors\n", FileName, Stream->Zstd ? L"Zstandard" : L"LZ4", Stream->DecodeBytes / SIZE_1KB, DecodeUs, DecodeUs ? Stream->DecodeBytes / DecodeUs : 0,
+		      Stream->Frames ? boot_mp_processors() : 1);
+	if(Stream->Disk.Extents)
+		Print(L"%S: read from the disk in %lu extents\n", FileName, Stream->Disk.NumberOfExtents);
+	if(Stream->Crcs)
+		Print(L"%S: CRC32C checked in %lu us\n", FileName, boot_timer_us(Stream->CrcTicks));
+	if(Stream->Hashing)
+		Print(L"%S: %s %lu KB in %lu us\n", FileName, Stream->Hashing == BOOT_HASH_BLAKE3 ? L"BLAKE3" : L"SHA-256",
+		      Stream->HashPosition / SIZE_1KB, boot_timer_us(Stream->HashTicks));
+#endif
+
+	if(Stream->Token.Event)
+		gBS->CloseEvent(Stream->Token.Event);
+	for(UINTN Slot = 0; Slot < BOOT_STREAM_DEPTH; Slot++) {
+		if(Stream->Reads[Slot].Token.Event)
+			gBS->CloseEvent(Stream->Reads[Slot].Token.Event);
+	}
+	if(Stream->Input[0])
+		gBS->FreePool(Stream->Input[0]);
+	if(Stream->Frames)
+		gBS->FreePool(Stream->Frames);
+	if(Stream->FrameCache)
+		gBS->FreePool(Stream->FrameCache);
+	if(Stream->Workspace)
+		gBS->FreePool(Stream->Workspace);
+	if(Stream->Crcs)
+		gBS->FreePool(Stream->Crcs);
+	if(Stream->Head)
+		gBS->FreePool(Stream->Head);
+	if(Stream->Tail)
+		gBS->FreePool(Stream->Tail);
+	boot_fat_close(&Stream->Disk);
+
+	Stream->File->Close(Stream->File);
+}
@@ -0,0 +1,192 @@
+/*
+ * Read size learned from how fast the boot device answers
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+#include <Library/DevicePathLib.h>
+#include <Library/PrintLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Boot.h"
+
+/* Read sizes tried, each one four times the one before */
+#define TUNE_CHUNK_MIN SIZE_64KB
+#define TUNE_CHUNK_MAX SIZE_8MB
+#define TUNE_CHUNK_DEFAULT SIZE_1MB
+
+/* A size is timed over this many bytes, or one piece of it when larger */
+#define TUNE_WINDOW SIZE_2MB
+
+/* A larger size has to be this many percent faster to be tried further */
+#define TUNE_GAIN 110
+
+#define TUNE_VARIABLE_ATTRIBUTES (EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS)
+
+/* Vendor of the variables holding the learned sizes */
+EFI_GUID BootTuneGuid = { 0x6b0f5a7e, 0x3c1d, 0x4e8a, { 0x9b, 0x52, 0x1f, 0x7d, 0x0c, 0x46, 0xa3, 0xe9 } };
+
+typedef struct {
+	UINTN Chunk;          /* Size reads are issued with */
+	BOOLEAN Tuning;       /* Chunk is being timed */
+	UINT64 Bytes;         /* Timed at Chunk so far */
+	UINT64 Ticks;
+	UINT64 BestRate;      /* Bytes per microsecond */
+	UINTN BestChunk;
+	UINTN SavedChunk;     /* BestChunk as the variable holds it */
+	CHAR16 Name[24];      /* Variable for the boot device, empty without one */
+} TUNE_STATE;
+
+/* Variable contents, Rate is 0 once the sizes above Chunk were found no faster */
+typedef struct {
+	UINT32 Chunk;
+	UINT32 Rate;
+} TUNE_VARIABLE;
+
+TUNE_STATE Tune = { TUNE_CHUNK_DEFAULT };
+
+/*
+ * Pick the read size for the boot device: the one boot.cfg sets, the
+ * one learned on an earlier boot, or else start timing the smallest.
+ * The learned size is kept in a variable named after a CRC32C of the
+ * device path, so another disk learns its own. A boot that ended before
+ * the timing did leaves its best size and rate, and the next boot goes
+ * on with the size above it.
+ */
+VOID boot_tune_init(EFI_HANDLE Device)
+{
+	EFI_DEVICE_PATH_PROTOCOL *DevicePath;
+	TUNE_VARIABLE Variable;
+	UINTN Size = sizeof(Variable);
+
+	if(BootConfig.ReadChunk) {
+		Tune.Chunk = (UINTN)MIN(MAX(BootConfig.ReadChunk, TUNE_CHUNK_MIN), TUNE_CHUNK_MAX) & ~(EFI_PAGE_SIZE - 1);
+		return;
+	}
+
+	if(EFI_ERROR(gBS->HandleProtocol(Device, &gEfiDevicePathProtocolGuid, (VOID**)&DevicePath)))
+		return;
+
+	UnicodeSPrint(Tune.Name, sizeof(Tune.Name), L"ReadChunk%08x", boot_crc32c(0, DevicePath, GetDevicePathSize(DevicePath)));
+
+	if(!EFI_ERROR(gRT->GetVariable(Tune.Name, &BootTuneGuid, NULL, &Size, &Variable)) && Size == sizeof(Variable) &&
+	   Variable.Chunk >= TUNE_CHUNK_MIN && Variable.Chunk <= TUNE_CHUNK_MAX && !(Variable.Chunk & (Variable.Chunk - 1))) {
+		Tune.Chunk = Variable.Chunk;
+		if(Variable.Rate == 0 || Variable.Chunk == TUNE_CHUNK_MAX)
+			return;
+
+		Tune.BestRate = Variable.Rate;
+		Tune.BestChunk = Variable.Chunk;
+		Tune.SavedChunk = Variable.Chunk;
+		Tune.Chunk = MIN(Variable.Chunk * 4, TUNE_CHUNK_MAX);
+		Tune.Tuning = TRUE;
+		return;
+	}
+
+	Tune.Chunk = TUNE_CHUNK_MIN;
+	Tune.Tuning = TRUE;
+}
+
+/* Size to issue the next read with */
+UINTN boot_tune_chunk()
+{
+	return Tune.Chunk;
+}
+
+/* Write BestChunk, with its rate while larger sizes are still to be timed */
+VOID boot_tune_store()
+{
+	EFI_STATUS Status;
+	TUNE_VARIABLE Variable = { (UINT32)Tune.BestChunk, Tune.Tuning ? (UINT32)MAX(Tune.BestRate, 1) : 0 };
+
+	Status = gRT->SetVariable(Tune.Name, &BootTuneGuid, TUNE_VARIABLE_ATTRIBUTES, sizeof(Variable), &Variable);
+	if(EFI_ERROR(Status))
+		Print(L"Error while saving %S: %lx\n", Tune.Name, Status);
+
+	Tune.SavedChunk = Tune.BestChunk;
+}
+
+/* The last size timed was not faster, keep the best one for this and later boots */
+VOID boot_tune_done()
+{
+	Tune.Chunk = Tune.BestChunk;
+	Tune.Tuning = FALSE;
+
+	boot_tune_store();
+
+#ifdef BOOT_BENCHMARK
+	Print(L"Read chunk: %lu KB at %lu MB/s\n", Tune.Chunk / SIZE_1KB, Tune.BestRate * 1000000 / SIZE_1MB);
+#endif
+}
+
+/*
+ * A run of Length bytes read in pieces of Chunk took Ticks to come in
+ * and be checked, Chunk is 0 when the size changed during the run. Once
+ * the current size has been timed long enough, move on to four times it
+ * while that pays off.
+ */
+VOID boot_tune_run(UINTN Chunk, UINTN Length, UINT64 Ticks)
+{
+	UINT64 Rate;
+
+	if(!Tune.Tuning || Chunk != Tune.Chunk)
+		return;
+
+	Tune.Bytes += Length;
+	Tune.Ticks += Ticks;
+	if(Tune.Bytes < MAX(TUNE_WINDOW, Tune.Chunk))
+		return;
+
+	Rate = Tune.Bytes / MAX(boot_timer_us(Tune.Ticks), 1);
+	if(Rate * 100 < Tune.BestRate * TUNE_GAIN || Tune.Chunk == TUNE_CHUNK_MAX) {
+		if(Rate > Tune.BestRate) {
+			Tune.BestRate = Rate;
+			Tune.BestChunk = Tune.Chunk;
+		}
+		boot_tune_done();
+		return;
+	}
+
+	Tune.BestRate = Rate;
+	Tune.BestChunk = Tune.Chunk;
+	Tune.Chunk = MIN(Tune.Chunk * 4, TUNE_CHUNK_MAX);
+	Tune.Bytes = 0;
+	Tune.Ticks = 0;
+}
+
+/* Loading is over with the timing unfinished, keep the best size so far for the next boot */
+VOID boot_tune_save()
+{
+	if(!Tune.Tuning || Tune.BestChunk == 0 || Tune.BestChunk == Tune.SavedChunk)
+		return;
+
+	boot_tune_store();
+}
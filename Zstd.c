@@ -0,0 +1,819 @@
+/*
+ * Zstandard frame decompression
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <Uefi.h>
+#include <Library/UefiLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include "Zstd.h"
+#include "Boot.h"
+
+/*
+ * Like the LZ4 decoder this only uses BaseMemoryLib, frames are decoded
+ * on application processors. A frame is decoded whole into memory, so
+ * matches find their history in the output and the window size does not
+ * matter. Checksums are not verified and dictionaries are not supported.
+ */
+
+/* Baselines and extra bits of the literal and match length codes */
+CONST UINT32 ZstdLiteralLengthBase[ZSTD_LITERAL_LENGTH_MAX + 1] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 18, 20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096,
+	8192, 16384, 32768, 65536
+};
+
+CONST UINT8 ZstdLiteralLengthBits[ZSTD_LITERAL_LENGTH_MAX + 1] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12,
+	13, 14, 15, 16
+};
+
+CONST UINT32 ZstdMatchLengthBase[ZSTD_MATCH_LENGTH_MAX + 1] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+	35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051,
+	4099, 8195, 16387, 32771, 65539
+};
+
+CONST UINT8 ZstdMatchLengthBits[ZSTD_MATCH_LENGTH_MAX + 1] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11,
+	12, 13, 14, 15, 16
+};
+
+/* Predefined distributions, -1 is a probability below one */
+CONST INT16 ZstdLiteralLengthCounts[ZSTD_LITERAL_LENGTH_MAX + 1] = {
+	4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+	-1, -1, -1, -1
+};
+
+CONST INT16 ZstdMatchLengthCounts[ZSTD_MATCH_LENGTH_MAX + 1] = {
+	1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1,
+	-1, -1, -1, -1, -1
+};
+
+CONST INT16 ZstdOffsetCounts[29] = {
+	1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1
+};
+
+/*
+ * Bit streams of the entropy coded parts are written forwards and read
+ * backwards, starting below the highest set bit of their last byte.
+ * Position counts the bits left, reads past the start give zeros and
+ * leave it negative. Table descriptions are read forwards instead.
+ */
+typedef struct {
+	UINT8 *Start;
+	UINTN Size;
+	INTN Position;
+} ZSTD_BITS;
+
+/* The bits of the stream from bit Low on */
+UINT64 boot_zstd_load(ZSTD_BITS *Bits, UINTN Low)
+{
+	UINTN Byte = Low >> 3;
+	UINT64 Value = 0;
+
+	if(Byte + 8 <= Bits->Size) {
+		Value = ReadUnaligned64((UINT64*)(Bits->Start + Byte));
+	} else {
+		for(UINTN Index = 0; Byte + Index < Bits->Size; Index++)
+			Value |= (UINT64)Bits->Start[Byte + Index] << (Index * 8);
+	}
+
+	return Value >> (Low & 7);
+}
+
+UINT32 boot_zstd_peek(ZSTD_BITS *Bits, UINTN Count)
+{
+	INTN Low = Bits->Position - (INTN)Count;
+
+	if(Count == 0 || Bits->Position <= 0)
+		return 0;
+
+	if(Low >= 0)
+		return (UINT32)(boot_zstd_load(Bits, Low) & ((1ULL << Count) - 1));
+
+	return (UINT32)((boot_zstd_load(Bits, 0) & ((1ULL << Bits->Position) - 1)) << -Low);
+}
+
+UINT32 boot_zstd_read(ZSTD_BITS *Bits, UINTN Count)
+{
+	UINT32 Value = boot_zstd_peek(Bits, Count);
+
+	Bits->Position -= Count;
+
+	return Value;
+}
+
+BOOLEAN boot_zstd_bits_init(ZSTD_BITS *Bits, UINT8 *Start, UINTN Size)
+{
+	if(Size == 0 || Start[Size - 1] == 0)
+		return FALSE;
+
+	Bits->Start = Start;
+	Bits->Size = Size;
+	Bits->Position = (Size - 1) * 8 + HighBitSet32(Start[Size - 1]);
+
+	return TRUE;
+}
+
+UINT32 boot_zstd_read_forward(ZSTD_BITS *Bits, UINTN Count)
+{
+	UINT32 Value = (UINT32)(boot_zstd_load(Bits, Bits->Position) & ((1ULL << Count) - 1));
+
+	Bits->Position += Count;
+
+	return Value;
+}
+
+/*
+ * Spread the symbols over the states of an FSE table by their counts,
+ * symbols below probability one take the states at the end.
+ */
+BOOLEAN boot_zstd_fse_build(ZSTD_FSE_TABLE *Table, CONST INT16 *Counts, UINTN Symbols, UINTN Log)
+{
+	UINT16 Next[ZSTD_FSE_SYMBOLS];
+	UINTN Size = (UINTN)1 << Log;
+	UINTN High = Size;
+	UINTN Step = (Size >> 1) + (Size >> 3) + 3;
+	UINTN Position = 0;
+
+	for(UINTN Symbol = 0; Symbol < Symbols; Symbol++) {
+		if(Counts[Symbol] == -1) {
+			Table->Entries[--High].Symbol = (UINT8)Symbol;
+			Next[Symbol] = 1;
+		}
+	}
+
+	for(UINTN Symbol = 0; Symbol < Symbols; Symbol++) {
+		if(Counts[Symbol] <= 0)
+			continue;
+
+		Next[Symbol] = Counts[Symbol];
+		for(INTN Count = 0; Count < Counts[Symbol]; Count++) {
+			Table->Entries[Position].Symbol = (UINT8)Symbol;
+			do {
+				Position = (Position + Step) & (Size - 1);
+			} while(Position >= High);
+		}
+	}
+
+	if(Position != 0)
+		return FALSE;
+
+	for(UINTN State = 0; State < Size; State++) {
+		ZSTD_FSE_ENTRY *Entry = &Table->Entries[State];
+		UINT16 Index = Next[Entry->Symbol]++;
+
+		Entry->Bits = (UINT8)(Log - HighBitSet32(Index));
+		Entry->Base = (UINT16)((Index << Entry->Bits) - Size);
+	}
+
+	Table->Log = Log;
+	Table->Valid = TRUE;
+
+	return TRUE;
+}
+
+/*
+ * Read an FSE table description: the accuracy log, then the count of
+ * each symbol in as few bits as the counts left allow, zero counts being
+ * followed by how many more zeros come. Returns the bytes it took, 0 if
+ * it is corrupted.
+ */
+UINTN boot_zstd_fse_read(UINT8 *Source, UINTN SourceSize, UINTN MaxSymbol, UINTN MaxLog, ZSTD_FSE_TABLE *Table)
+{
+	ZSTD_BITS Bits = { Source, SourceSize, 0 };
+	INT16 Counts[ZSTD_FSE_SYMBOLS];
+	UINTN Symbol = 0;
+	UINTN Log;
+	INTN Remaining;
+
+	if(SourceSize == 0)
+		return 0;
+
+	Log = boot_zstd_read_forward(&Bits, 4) + 5;
+	if(Log > MaxLog)
+		return 0;
+
+	Remaining = (INTN)1 << Log;
+	while(Remaining > 0 && Symbol <= MaxSymbol) {
+		UINTN Count = HighBitSet32((UINT32)Remaining + 1) + 1;
+		UINT32 Low = (1U << (Count - 1)) - 1;
+		UINT32 Threshold = (1U << Count) - 1 - ((UINT32)Remaining + 1);
+		UINT32 Value = (UINT32)(boot_zstd_load(&Bits, Bits.Position) & ((1U << Count) - 1));
+
+		/* Small values take one bit less */
+		if((Value & Low) < Threshold) {
+			Value &= Low;
+			Bits.Position += Count - 1;
+		} else {
+			if(Value > Low)
+				Value -= Threshold;
+			Bits.Position += Count;
+		}
+
+		Counts[Symbol++] = (INT16)Value - 1;
+		Remaining -= Value == 0 ? 1 : Value - 1;
+
+		if(Value == 1) {
+			UINT32 Repeat;
+
+			do {
+				Repeat = boot_zstd_read_forward(&Bits, 2);
+				for(UINT32 Index = 0; Index < Repeat; Index++) {
+					if(Symbol > MaxSymbol)
+						return 0;
+					Counts[Symbol++] = 0;
+				}
+			} while(Repeat == 3);
+		}
+
+		if((UINTN)Bits.Position > SourceSize * 8)
+			return 0;
+	}
+
+	if(Remaining != 0 || !boot_zstd_fse_build(Table, Counts, Symbol, Log))
+		return 0;
+
+	return ((UINTN)Bits.Position + 7) / 8;
+}
+
+/*
+ * Huffman tree description: the weight of every symbol but the last,
+ * FSE compressed or four bits each. The last weight is what makes the
+ * weights add up to a power of two, which gives the longest code.
+ * Returns the bytes it took, 0 if it is corrupted.
+ */
+UINTN boot_zstd_huffman_read(UINT8 *Source, UINTN SourceSize, ZSTD_WORKSPACE *Workspace)
+{
+	UINT8 Weights[256];
+	UINT32 RankStart[ZSTD_HUFFMAN_LOG_MAX + 1];
+	UINTN Count = 0;
+	UINTN Size;
+	UINT32 Total = 0;
+	UINTN MaxBits;
+	UINT32 Left;
+
+	if(SourceSize == 0)
+		return 0;
+
+	if(Source[0] >= 128) {
+		Count = Source[0] - 127;
+		Size = (Count + 1) / 2;
+		if(Size >= SourceSize)
+			return 0;
+
+		for(UINTN Index = 0; Index < Count; Index++)
+			Weights[Index] = (Index & 1) ? Source[1 + Index / 2] & 0xF : Source[1 + Index / 2] >> 4;
+	} else {
+		ZSTD_FSE_TABLE *Table = &Workspace->Weights;
+		ZSTD_BITS Bits;
+		UINTN Used;
+		UINTN State[2];
+
+		/* Two states take turns over one stream, until it runs out */
+		Size = Source[0];
+		if(Size >= SourceSize)
+			return 0;
+
+		Used = boot_zstd_fse_read(Source + 1, Size, ZSTD_HUFFMAN_LOG_MAX, ZSTD_WEIGHTS_LOG_MAX, Table);
+		if(Used == 0 || Used >= Size || !boot_zstd_bits_init(&Bits, Source + 1 + Used, Size - Used))
+			return 0;
+
+		State[0] = boot_zstd_read(&Bits, Table->Log);
+		State[1] = boot_zstd_read(&Bits, Table->Log);
+
+		for(UINTN Turn = 0;; Turn ^= 1) {
+			ZSTD_FSE_ENTRY *Entry = &Table->Entries[State[Turn]];
+
+			if(Count >= 255)
+				return 0;
+			Weights[Count++] = Entry->Symbol;
+			State[Turn] = Entry->Base + boot_zstd_read(&Bits, Entry->Bits);
+
+			if(Bits.Position < 0) {
+				if(Count >= 255)
+					return 0;
+				Weights[Count++] = Table->Entries[State[Turn ^ 1]].Symbol;
+				break;
+			}
+		}
+	}
+
+	for(UINTN Index = 0; Index < Count; Index++) {
+		if(Weights[Index] > ZSTD_HUFFMAN_LOG_MAX)
+			return 0;
+		if(Weights[Index])
+			Total += 1U << (Weights[Index] - 1);
+	}
+
+	if(Total == 0)
+		return 0;
+
+	MaxBits = HighBitSet32(Total) + 1;
+	Left = (1U << MaxBits) - Total;
+	if(MaxBits > ZSTD_HUFFMAN_LOG_MAX || (Left & (Left - 1)))
+		return 0;
+
+	Weights[Count++] = (UINT8)(HighBitSet32(Left) + 1);
+
+	/* Longest codes first, a symbol of weight W takes 2^(W-1) entries */
+	SetMem(RankStart, sizeof(RankStart), 0);
+	for(UINTN Index = 0; Index < Count; Index++) {
+		if(Weights[Index])
+			RankStart[Weights[Index]] += 1U << (Weights[Index] - 1);
+	}
+
+	for(UINT32 Weight = 1, Start = 0; Weight <= MaxBits; Weight++) {
+		UINT32 Length = RankStart[Weight];
+
+		RankStart[Weight] = Start;
+		Start += Length;
+	}
+
+	for(UINTN Index = 0; Index < Count; Index++) {
+		UINT8 Weight = Weights[Index];
+
+		if(!Weight)
+			continue;
+
+		for(UINT32 Entry = 0; Entry < 1U << (Weight - 1); Entry++) {
+			Workspace->Huffman[RankStart[Weight] + Entry].Symbol = (UINT8)Index;
+			Workspace->Huffman[RankStart[Weight] + Entry].Bits = (UINT8)(MaxBits + 1 - Weight);
+		}
+		RankStart[Weight] += 1U << (Weight - 1);
+	}
+
+	Workspace->HuffmanLog = MaxBits;
+
+	return 1 + Size;
+}
+
+/* Decode Count literals from one Huffman stream, which has to end with them */
+BOOLEAN boot_zstd_huffman_stream(UINT8 *Source, UINTN SourceSize, UINT8 *Output, UINTN Count, ZSTD_WORKSPACE *Workspace)
+{
+	ZSTD_BITS Bits;
+	UINTN Log = Workspace->HuffmanLog;
+
+	if(!boot_zstd_bits_init(&Bits, Source, SourceSize))
+		return FALSE;
+
+	for(UINTN Index = 0; Index < Count; Index++) {
+		ZSTD_HUFFMAN_ENTRY *Entry = &Workspace->Huffman[boot_zstd_peek(&Bits, Log)];
+
+		Output[Index] = Entry->Symbol;
+		Bits.Position -= Entry->Bits;
+	}
+
+	return Bits.Position == 0;
+}
+
+/*
+ * Literals section of a compressed block. Raw literals are used where
+ * they are, the others are decoded to the workspace. Returns the bytes
+ * the section took, 0 if it is corrupted.
+ */
+UINTN boot_zstd_literals(UINT8 *Source, UINTN SourceSize, ZSTD_WORKSPACE *Workspace, UINT8 **Literals, UINTN *LiteralsSize)
+{
+	UINTN Type;
+	UINTN Format;
+	UINTN HeaderSize;
+	UINTN Size;
+	UINTN CompressedSize;
+	UINT32 Header;
+	UINT8 *Input;
+
+	if(SourceSize == 0)
+		return 0;
+
+	Type = Source[0] & 3;
+	Format = (Source[0] >> 2) & 3;
+
+	/* Raw and RLE literals give only their size */
+	if(Type < 2) {
+		HeaderSize = (Format == 1) ? 2 : (Format == 3) ? 3 : 1;
+		if(SourceSize < HeaderSize)
+			return 0;
+
+		if(HeaderSize == 1)
+			Size = Source[0] >> 3;
+		else if(HeaderSize == 2)
+			Size = (Source[0] >> 4) | (Source[1] << 4);
+		else
+			Size = (Source[0] >> 4) | (Source[1] << 4) | (Source[2] << 12);
+
+		if(Size > ZSTD_BLOCK_MAX)
+			return 0;
+
+		*LiteralsSize = Size;
+
+		if(Type == 0) {
+			if(Size > SourceSize - HeaderSize)
+				return 0;
+			*Literals = Source + HeaderSize;
+			return HeaderSize + Size;
+		}
+
+		if(SourceSize < HeaderSize + 1)
+			return 0;
+		SetMem(Workspace->Literals, Size, Source[HeaderSize]);
+		*Literals = Workspace->Literals;
+		return HeaderSize + 1;
+	}
+
+	/* Huffman coded, with a new tree or the one of the block before */
+	HeaderSize = (Format < 2) ? 3 : Format + 2;
+	if(SourceSize < HeaderSize)
+		return 0;
+
+	Header = Source[0] | (Source[1] << 8) | (Source[2] << 16) | (HeaderSize > 3 ? (UINT32)Source[3] << 24 : 0);
+	if(HeaderSize == 3) {
+		Size = (Header >> 4) & 0x3FF;
+		CompressedSize = (Header >> 14) & 0x3FF;
+	} else if(HeaderSize == 4) {
+		Size = (Header >> 4) & 0x3FFF;
+		CompressedSize = Header >> 18;
+	} else {
+		Size = (Header >> 4) & 0x3FFFF;
+		CompressedSize = (Header >> 22) | (Source[4] << 10);
+	}
+
+	if(Size > ZSTD_BLOCK_MAX || CompressedSize > SourceSize - HeaderSize)
+		return 0;
+
+	Input = Source + HeaderSize;
+	*Literals = Workspace->Literals;
+	*LiteralsSize = Size;
+
+	if(Type == 2) {
+		UINTN Used = boot_zstd_huffman_read(Input, CompressedSize, Workspace);
+
+		if(Used == 0)
+			return 0;
+		Input += Used;
+		CompressedSize -= Used;
+	} else if(Workspace->HuffmanLog == 0) {
+		return 0;
+	}
+
+	if(Format == 0) {
+		if(!boot_zstd_huffman_stream(Input, CompressedSize, Workspace->Literals, Size, Workspace))
+			return 0;
+		Input += CompressedSize;
+	} else {
+		/* Four streams after a jump table of the first three sizes */
+		UINTN StreamSize[4];
+		UINTN Part = (Size + 3) / 4;
+
+		if(CompressedSize < 6 || Size < 3 * Part)
+			return 0;
+
+		StreamSize[0] = Input[0] | (Input[1] << 8);
+		StreamSize[1] = Input[2] | (Input[3] << 8);
+		StreamSize[2] = Input[4] | (Input[5] << 8);
+		if(StreamSize[0] + StreamSize[1] + StreamSize[2] > CompressedSize - 6)
+			return 0;
+		StreamSize[3] = CompressedSize - 6 - StreamSize[0] - StreamSize[1] - StreamSize[2];
+		Input += 6;
+
+		for(UINTN Stream = 0; Stream < 4; Stream++) {
+			if(!boot_zstd_huffman_stream(Input, StreamSize[Stream], Workspace->Literals + Stream * Part,
+						     Stream < 3 ? Part : Size - 3 * Part, Workspace))
+				return 0;
+			Input += StreamSize[Stream];
+		}
+	}
+
+	return Input - Source;
+}
+
+/* Set up a sequence table as its compression mode says */
+BOOLEAN boot_zstd_table(UINTN Mode, UINT8 **Input, UINT8 *InputEnd, CONST INT16 *Counts, UINTN Symbols, UINTN Log,
+			UINTN MaxSymbol, UINTN MaxLog, ZSTD_FSE_TABLE *Table)
+{
+	UINTN Used;
+
+	switch(Mode) {
+	case 0:
+		return boot_zstd_fse_build(Table, Counts, Symbols, Log);
+	case 1:
+		/* A single symbol, read no bits */
+		if(*Input >= InputEnd || **Input > MaxSymbol)
+			return FALSE;
+		Table->Entries[0].Symbol = *(*Input)++;
+		Table->Entries[0].Bits = 0;
+		Table->Entries[0].Base = 0;
+		Table->Log = 0;
+		Table->Valid = TRUE;
+		return TRUE;
+	case 2:
+		Used = boot_zstd_fse_read(*Input, InputEnd - *Input, MaxSymbol, MaxLog, Table);
+		*Input += Used;
+		return Used != 0;
+	default:
+		return Table->Valid;
+	}
+}
+
+/*
+ * Sequences section of a compressed block: every sequence copies some
+ * literals, then a match from the output. The literals left after the
+ * last one end the block.
+ */
+EFI_STATUS boot_zstd_sequences(UINT8 *Source, UINTN SourceSize, UINT8 *Literals, UINTN LiteralsSize, UINT8 *Frame, UINT8 **Output, UINT8 *OutputEnd, ZSTD_WORKSPACE *Workspace)
+{
+	UINT8 *Input = Source;
+	UINT8 *InputEnd = Source + SourceSize;
+	UINT8 *LiteralsEnd = Literals + LiteralsSize;
+	UINT8 *Out = *Output;
+	UINT32 *Repeat = Workspace->Repeat;
+	ZSTD_BITS Bits = { NULL, 0, 0 };
+	UINTN Number;
+	UINT8 Modes;
+	UINTN LiteralLengthState = 0;
+	UINTN OffsetState = 0;
+	UINTN MatchLengthState = 0;
+
+	if(Input >= InputEnd)
+		return EFI_VOLUME_CORRUPTED;
+
+	Number = *Input++;
+	if(Number >= 128) {
+		if(Input >= InputEnd)
+			return EFI_VOLUME_CORRUPTED;
+		if(Number < 255) {
+			Number = ((Number - 128) << 8) + *Input++;
+		} else {
+			if(InputEnd - Input < 2)
+				return EFI_VOLUME_CORRUPTED;
+			Number = Input[0] + (Input[1] << 8) + 0x7F00;
+			Input += 2;
+		}
+	}
+
+	if(Number) {
+		if(Input >= InputEnd)
+			return EFI_VOLUME_CORRUPTED;
+
+		Modes = *Input++;
+		if((Modes & 3) ||
+		   !boot_zstd_table(Modes >> 6, &Input, InputEnd, ZstdLiteralLengthCounts, ARRAY_SIZE(ZstdLiteralLengthCounts), 6,
+				    ZSTD_LITERAL_LENGTH_MAX, ZSTD_LITERAL_LENGTH_LOG_MAX, &Workspace->LiteralLengths) ||
+		   !boot_zstd_table((Modes >> 4) & 3, &Input, InputEnd, ZstdOffsetCounts, ARRAY_SIZE(ZstdOffsetCounts), 5,
+				    ZSTD_OFFSET_MAX, ZSTD_OFFSET_LOG_MAX, &Workspace->Offsets) ||
+		   !boot_zstd_table((Modes >> 2) & 3, &Input, InputEnd, ZstdMatchLengthCounts, ARRAY_SIZE(ZstdMatchLengthCounts), 6,
+				    ZSTD_MATCH_LENGTH_MAX, ZSTD_MATCH_LENGTH_LOG_MAX, &Workspace->MatchLengths) ||
+		   !boot_zstd_bits_init(&Bits, Input, InputEnd - Input))
+			return EFI_VOLUME_CORRUPTED;
+
+		LiteralLengthState = boot_zstd_read(&Bits, Workspace->LiteralLengths.Log);
+		OffsetState = boot_zstd_read(&Bits, Workspace->Offsets.Log);
+		MatchLengthState = boot_zstd_read(&Bits, Workspace->MatchLengths.Log);
+	} else if(Input != InputEnd) {
+		return EFI_VOLUME_CORRUPTED;
+	}
+
+	for(UINTN Index = 0; Index < Number; Index++) {
+		ZSTD_FSE_ENTRY *LiteralLength = &Workspace->LiteralLengths.Entries[LiteralLengthState];
+		ZSTD_FSE_ENTRY *Offset = &Workspace->Offsets.Entries[OffsetState];
+		ZSTD_FSE_ENTRY *MatchLength = &Workspace->MatchLengths.Entries[MatchLengthState];
+		UINT64 OffsetValue;
+		UINTN Literal;
+		UINTN Match;
+		UINTN Distance;
+		UINT8 *From;
+
+		/* Extra bits come offset first, then match and literal length */
+		OffsetValue = ((UINT64)1 << Offset->Symbol) + boot_zstd_read(&Bits, Offset->Symbol);
+		Match = ZstdMatchLengthBase[MatchLength->Symbol] + boot_zstd_read(&Bits, ZstdMatchLengthBits[MatchLength->Symbol]);
+		Literal = ZstdLiteralLengthBase[LiteralLength->Symbol] + boot_zstd_read(&Bits, ZstdLiteralLengthBits[LiteralLength->Symbol]);
+
+		/* Offset values up to 3 pick a repeat offset, shifted by one without literals */
+		if(OffsetValue > 3) {
+			Distance = (UINTN)(OffsetValue - 3);
+			Repeat[2] = Repeat[1];
+			Repeat[1] = Repeat[0];
+			Repeat[0] = (UINT32)Distance;
+		} else {
+			UINTN Which = (UINTN)OffsetValue - 1 + (Literal == 0 ? 1 : 0);
+
+			Distance = (Which == 3) ? Repeat[0] - 1 : Repeat[Which];
+			if(Which > 1)
+				Repeat[2] = Repeat[1];
+			if(Which > 0) {
+				Repeat[1] = Repeat[0];
+				Repeat[0] = (UINT32)Distance;
+			}
+		}
+
+		/* The states move on in literal length, match length, offset order */
+		if(Index + 1 < Number) {
+			LiteralLengthState = LiteralLength->Base + boot_zstd_read(&Bits, LiteralLength->Bits);
+			MatchLengthState = MatchLength->Base + boot_zstd_read(&Bits, MatchLength->Bits);
+			OffsetState = Offset->Base + boot_zstd_read(&Bits, Offset->Bits);
+		}
+
+		if(Literal > (UINTN)(LiteralsEnd - Literals) || Literal > (UINTN)(OutputEnd - Out))
+			return EFI_VOLUME_CORRUPTED;
+
+		CopyMem(Out, Literals, Literal);
+		Literals += Literal;
+		Out += Literal;
+
+		if(Distance == 0 || Distance > (UINTN)(Out - Frame) || Match > (UINTN)(OutputEnd - Out))
+			return EFI_VOLUME_CORRUPTED;
+
+		From = Out - Distance;
+		if(Distance >= Match) {
+			CopyMem(Out, From, Match);
+			Out += Match;
+		} else {
+			/* Overlapping matches repeat the last Distance bytes */
+			while(Match--)
+				*Out++ = *From++;
+		}
+	}
+
+	if(Number && Bits.Position != 0)
+		return EFI_VOLUME_CORRUPTED;
+
+	if((UINTN)(LiteralsEnd - Literals) > (UINTN)(OutputEnd - Out))
+		return EFI_VOLUME_CORRUPTED;
+
+	CopyMem(Out, Literals, LiteralsEnd - Literals);
+	*Output = Out + (LiteralsEnd - Literals);
+
+	return EFI_SUCCESS;
+}
+
+/*
+ * Parse the header of a Zstandard frame. ContentSize is MAX_UINT64 when
+ * the frame does not give it.
+ */
+EFI_STATUS boot_zstd_frame_header(UINT8 *Source, UINTN SourceSize, UINTN *HeaderSize, UINT64 *ContentSize)
+{
+	UINT8 Descriptor;
+	UINTN DictionarySize;
+	UINTN SizeSize;
+	UINT8 *Field;
+	UINT32 Dictionary = 0;
+
+	if(SourceSize < 5 || boot_lz4_le32(Source) != ZSTD_FRAME_MAGIC)
+		return EFI_VOLUME_CORRUPTED;
+
+	Descriptor = Source[4];
+	if(Descriptor & ZSTD_FHD_RESERVED)
+		return EFI_UNSUPPORTED;
+
+	DictionarySize = (Descriptor & 3) == 3 ? 4 : Descriptor & 3;
+	SizeSize = (Descriptor >> 6) ? (UINTN)1 << (Descriptor >> 6) : (Descriptor & ZSTD_FHD_SINGLE_SEGMENT) ? 1 : 0;
+
+	/* The window descriptor is left out of single segment frames */
+	*HeaderSize = 5 + ((Descriptor & ZSTD_FHD_SINGLE_SEGMENT) ? 0 : 1) + DictionarySize + SizeSize;
+	if(SourceSize < *HeaderSize)
+		return EFI_VOLUME_CORRUPTED;
+
+	Field = Source + *HeaderSize - SizeSize - DictionarySize;
+	for(UINTN Index = 0; Index < DictionarySize; Index++)
+		Dictionary |= (UINT32)Field[Index] << (Index * 8);
+	if(Dictionary)
+		return EFI_UNSUPPORTED;
+
+	Field += DictionarySize;
+	*ContentSize = SizeSize ? 0 : MAX_UINT64;
+	for(UINTN Index = 0; Index < SizeSize; Index++)
+		*ContentSize |= (UINT64)Field[Index] << (Index * 8);
+	if(SizeSize == 2)
+		*ContentSize += 256;
+
+	return EFI_SUCCESS;
+}
+
+/*
+ * Decompress a whole Zstandard frame held in memory, which has to end
+ * where Source does. Workspace is a ZSTD_WORKSPACE.
+ */
+EFI_STATUS boot_zstd_frame_decompress(UINT8 *Source, UINTN SourceSize, UINT8 *Destination, UINTN DestinationSize, VOID *Workspace, UINTN *DecompressedSize)
+{
+	EFI_STATUS Status = EFI_SUCCESS;
+	ZSTD_WORKSPACE *State = Workspace;
+	UINT8 *Input = Source;
+	UINT8 *InputEnd = Source + SourceSize;
+	UINT8 *Output = Destination;
+	UINT8 *OutputEnd = Destination + DestinationSize;
+	UINT64 ContentSize;
+	UINTN HeaderSize;
+	BOOLEAN Last = FALSE;
+
+	Status = boot_zstd_frame_header(Source, SourceSize, &HeaderSize, &ContentSize);
+	if(EFI_ERROR(Status))
+		return Status;
+
+	Input += HeaderSize;
+
+	/* Nothing carries over from another frame */
+	State->HuffmanLog = 0;
+	State->LiteralLengths.Valid = FALSE;
+	State->Offsets.Valid = FALSE;
+	State->MatchLengths.Valid = FALSE;
+	State->Repeat[0] = 1;
+	State->Repeat[1] = 4;
+	State->Repeat[2] = 8;
+
+	while(!Last) {
+		UINT32 Header;
+		UINTN Size;
+		UINT8 *Literals;
+		UINTN LiteralsSize;
+		UINTN Used;
+
+		if(InputEnd - Input < 3)
+			return EFI_VOLUME_CORRUPTED;
+
+		Header = Input[0] | (Input[1] << 8) | (Input[2] << 16);
+		Input += 3;
+		Last = Header & 1;
+		Size = Header >> 3;
+
+		switch((Header >> 1) & 3) {
+		case ZSTD_BLOCK_RAW:
+			if(Size > (UINTN)(InputEnd - Input) || Size > (UINTN)(OutputEnd - Output))
+				return EFI_VOLUME_CORRUPTED;
+			CopyMem(Output, Input, Size);
+			Input += Size;
+			Output += Size;
+			break;
+		case ZSTD_BLOCK_RLE:
+			if(Input >= InputEnd || Size > (UINTN)(OutputEnd - Output))
+				return EFI_VOLUME_CORRUPTED;
+			SetMem(Output, Size, *Input++);
+			Output += Size;
+			break;
+		case ZSTD_BLOCK_COMPRESSED:
+			if(Size > (UINTN)(InputEnd - Input) || Size > ZSTD_BLOCK_MAX)
+				return EFI_VOLUME_CORRUPTED;
+
+			Used = boot_zstd_literals(Input, Size, State, &Literals, &LiteralsSize);
+			if(Used == 0)
+				return EFI_VOLUME_CORRUPTED;
+
+			Status = boot_zstd_sequences(Input + Used, Size - Used, Literals, LiteralsSize, Destination, &Output, OutputEnd, State);
+			if(EFI_ERROR(Status))
+				return Status;
+
+			Input += Size;
+			break;
+		default:
+			return EFI_VOLUME_CORRUPTED;
+		}
+	}
+
+	if(Source[4] & ZSTD_FHD_CHECKSUM) {
+		if(InputEnd - Input < 4)
+			return EFI_VOLUME_CORRUPTED;
+		Input += 4;
+	}
+
+	if(Input != InputEnd || (ContentSize != MAX_UINT64 && ContentSize != (UINT64)(Output - Destination)))
+		return EFI_VOLUME_CORRUPTED;
+
+	*DecompressedSize = Output - Destination;
+
+	return Status;
+}
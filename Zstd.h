@@ -0,0 +1,112 @@
+/*
+ * Zstandard frame and seek table definitions
+ *
+ * Copyright (c) 2025 gabijaba.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __ZSTD_H__
+#define __ZSTD_H__
+
+#define ZSTD_FRAME_MAGIC 0xFD2FB528
+
+#define ZSTD_FHD_SINGLE_SEGMENT 0x20
+#define ZSTD_FHD_RESERVED       0x08
+#define ZSTD_FHD_CHECKSUM       0x04
+
+#define ZSTD_BLOCK_RAW          0
+#define ZSTD_BLOCK_RLE          1
+#define ZSTD_BLOCK_COMPRESSED   2
+#define ZSTD_BLOCK_MAX          SIZE_128KB
+
+/* Largest table logs and symbols the format allows */
+#define ZSTD_HUFFMAN_LOG_MAX    11
+#define ZSTD_WEIGHTS_LOG_MAX    6
+#define ZSTD_LITERAL_LENGTH_LOG_MAX 9
+#define ZSTD_MATCH_LENGTH_LOG_MAX 9
+#define ZSTD_OFFSET_LOG_MAX     8
+#define ZSTD_LITERAL_LENGTH_MAX 35
+#define ZSTD_MATCH_LENGTH_MAX   52
+#define ZSTD_OFFSET_MAX         31
+#define ZSTD_FSE_LOG_MAX        9
+#define ZSTD_FSE_SYMBOLS        64
+
+/*
+ * Multi-frame images end in a seek table using the Zstandard seekable
+ * format: a skippable frame holding one entry per frame followed by a
+ * footer, so the frame list is found by reading the end of the file.
+ * The frames are Zstandard frames, or LZ4 frames in the same table.
+ */
+#define SEEK_TABLE_SKIPPABLE_MAGIC 0x184D2A5E
+#define SEEK_TABLE_MAGIC 0x8F92EAB1
+#define SEEK_TABLE_CHECKSUM 0x80
+
+#pragma pack(1)
+typedef struct {
+	UINT32 CompressedSize;
+	UINT32 DecompressedSize;
+	/* UINT32 Checksum with SEEK_TABLE_CHECKSUM */
+} SEEK_TABLE_ENTRY;
+
+typedef struct {
+	UINT32 NumberOfFrames;
+	UINT8 Descriptor;
+	UINT32 Magic;
+} SEEK_TABLE_FOOTER;
+#pragma pack()
+
+typedef struct {
+	UINT16 Base;          /* Next state before the bits read are added */
+	UINT8 Symbol;
+	UINT8 Bits;
+} ZSTD_FSE_ENTRY;
+
+typedef struct {
+	ZSTD_FSE_ENTRY Entries[1 << ZSTD_FSE_LOG_MAX];
+	UINTN Log;
+	BOOLEAN Valid;        /* Set up by an earlier block, for the repeat mode */
+} ZSTD_FSE_TABLE;
+
+typedef struct {
+	UINT8 Symbol;
+	UINT8 Bits;
+} ZSTD_HUFFMAN_ENTRY;
+
+/*
+ * What a frame keeps from one block to the next. The decoder does not
+ * allocate, every processor decoding frames is given one of these.
+ */
+typedef struct {
+	UINT8 Literals[ZSTD_BLOCK_MAX];
+	ZSTD_HUFFMAN_ENTRY Huffman[1 << ZSTD_HUFFMAN_LOG_MAX];
+	UINTN HuffmanLog;     /* 0 until a block describes a tree */
+	ZSTD_FSE_TABLE Weights;
+	ZSTD_FSE_TABLE LiteralLengths;
+	ZSTD_FSE_TABLE Offsets;
+	ZSTD_FSE_TABLE MatchLengths;
+	UINT32 Repeat[3];     /* Repeat offsets, most recent first */
+} ZSTD_WORKSPACE;
+
+#endif /* __ZSTD_H__ */